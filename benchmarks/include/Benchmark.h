@@ -0,0 +1,49 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_BENCHMARK_H
+#define WRENCH_BENCHMARK_H
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+
+// Base fixture for the (opt-in) benchmarks, which are built as the "benchmarks" target
+// and are not part of the unit tests. Benchmarks time a piece of code with measure(),
+// which reports the elapsed wall-clock time on stderr (and which is public so that the
+// simulated processes of a benchmark, e.g., its WMS, can use it as well).
+
+class Benchmark : public ::testing::Test {
+
+public:
+
+    /**
+     * @brief Time a piece of code and report the elapsed wall-clock time
+     * @param label: what is being measured
+     * @param num_operations: the number of operations performed by the code (used to report a rate)
+     * @param code: the code to time
+     * @return the elapsed time (in seconds)
+     */
+    static double measure(const std::string &label, unsigned long num_operations, const std::function<void()> &code) {
+        auto start = std::chrono::steady_clock::now();
+        code();
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cerr << "[ " << label << ": " << elapsed << " sec";
+        if ((num_operations > 0) and (elapsed > 0)) {
+            std::cerr << ", " << (unsigned long) ((double) num_operations / elapsed) << " ops/sec";
+        }
+        std::cerr << " ]\n";
+        return elapsed;
+    }
+};
+
+#endif //WRENCH_BENCHMARK_H
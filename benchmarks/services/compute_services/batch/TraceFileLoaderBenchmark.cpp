@@ -0,0 +1,65 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include <wrench/util/TraceFileLoader.h>
+
+#include "../../../include/Benchmark.h"
+#include "../../../../test/include/TestWithFork.h"
+#include "../../../../test/include/UniqueTmpPathPrefix.h"
+
+#define NUM_TRACE_JOBS 500000
+#define NUM_TRACE_USERS 50
+
+/**********************************************************************/
+/**                    TraceFileLoaderBenchmark                      **/
+/**********************************************************************/
+
+class TraceFileLoaderBenchmark : public Benchmark {
+
+public:
+    void do_LoadSWF_benchmark();
+
+protected:
+    TraceFileLoaderBenchmark() {
+        FILE *trace_file = fopen(trace_file_path.c_str(), "w");
+        fprintf(trace_file, "; A generated trace\n");
+        for (unsigned long i = 0; i < NUM_TRACE_JOBS; i++) {
+            fprintf(trace_file, "%lu %lu 10 %lu %lu -1 -1 %lu %lu %lu 1 %lu 1 1 1 1 -1 -1\n",
+                    i + 1, 1000 + i * 10, 100 + i % 3600, 1 + i % 32, 1 + i % 32, 200 + i % 3600, i % 1024,
+                    1 + i % NUM_TRACE_USERS);
+        }
+        fclose(trace_file);
+    }
+
+    std::string trace_file_path = UNIQUE_TMP_PATH_PREFIX + "benchmark_trace.swf";
+};
+
+/**********************************************************************/
+/**  LoadSWF (500k generated jobs)                                   **/
+/**********************************************************************/
+
+void TraceFileLoaderBenchmark::do_LoadSWF_benchmark() {
+
+    std::shared_ptr<wrench::WorkloadTrace> trace;
+    measure("TraceFileLoader::loadWorkloadTrace()", NUM_TRACE_JOBS, [&]() {
+        ASSERT_NO_THROW(trace = wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, false, 0));
+    });
+    ASSERT_EQ(NUM_TRACE_JOBS, trace->size());
+
+    std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> tuples;
+    measure("TraceFileLoader::loadFromTraceFile()", NUM_TRACE_JOBS, [&]() {
+        ASSERT_NO_THROW(tuples = wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, false, 0));
+    });
+    ASSERT_EQ(NUM_TRACE_JOBS, tuples.size());
+}
+
+TEST_F(TraceFileLoaderBenchmark, LoadSWF) {
+    DO_TEST_WITH_FORK(do_LoadSWF_benchmark);
+}
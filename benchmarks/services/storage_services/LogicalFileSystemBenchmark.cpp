@@ -0,0 +1,121 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+
+#include "../../include/Benchmark.h"
+#include "../../../test/include/TestWithFork.h"
+#include "../../../test/include/UniqueTmpPathPrefix.h"
+
+#define NUM_FILES 1000000
+#define NUM_DIRECTORIES 1000
+
+/**********************************************************************/
+/**                   LogicalFileSystemBenchmark                     **/
+/**********************************************************************/
+
+class LogicalFileSystemBenchmark : public Benchmark {
+
+public:
+    void do_ManyFiles_benchmark();
+
+protected:
+    LogicalFileSystemBenchmark() {
+
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"Host\" speed=\"1f\"> "
+                          "          <disk id=\"large_disk1\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "             <prop id=\"size\" value=\"5000GiB\"/>"
+                          "             <prop id=\"mount\" value=\"/\"/>"
+                          "          </disk>"
+                          "          <disk id=\"large_disk2\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "             <prop id=\"size\" value=\"5000GiB\"/>"
+                          "             <prop id=\"mount\" value=\"/scratch\"/>"
+                          "          </disk>"
+                          "       </host>"
+                          "   </zone> "
+                          "</platform>";
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+
+        workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    std::unique_ptr<wrench::Workflow> workflow;
+};
+
+/**********************************************************************/
+/**   ManyFiles (1M files in 1k directories, staged and looked up)   **/
+/**********************************************************************/
+
+void LogicalFileSystemBenchmark::do_ManyFiles_benchmark() {
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("benchmarks");
+
+    auto simulation = std::unique_ptr<wrench::Simulation>(new wrench::Simulation());
+    simulation->init(&argc, argv);
+    simulation->instantiatePlatform(platform_file_path);
+
+    std::shared_ptr<wrench::StorageService> storage_service;
+    ASSERT_NO_THROW(storage_service = simulation->add(new wrench::SimpleStorageService("Host", {"/"})));
+    ASSERT_NO_THROW(simulation->add(new wrench::FileRegistryService("Host")));
+
+    std::vector<wrench::WorkflowFile *> files;
+    files.reserve(NUM_FILES);
+    for (int i = 0; i < NUM_FILES; i++) {
+        files.push_back(workflow->addFile("file_" + std::to_string(i), 1));
+    }
+
+    // Stage all files on the storage service, through the public API
+    measure("Simulation::stageFile()", NUM_FILES, [&]() {
+        for (int i = 0; i < NUM_FILES; i++) {
+            ASSERT_NO_THROW(simulation->stageFile(files[i], storage_service,
+                                                  "/dir_" + std::to_string(i % NUM_DIRECTORIES)));
+        }
+    });
+
+    // Store and look up all files on a logical file system directly
+    auto fs = std::unique_ptr<wrench::LogicalFileSystem>(
+            new wrench::LogicalFileSystem("Host", storage_service.get(), "/scratch"));
+    fs->init();
+
+    std::vector<std::string> directories;
+    for (int i = 0; i < NUM_DIRECTORIES; i++) {
+        directories.push_back("/dir_" + std::to_string(i) + "/");
+    }
+
+    measure("LogicalFileSystem::storeFileInDirectory()", NUM_FILES, [&]() {
+        for (int i = 0; i < NUM_FILES; i++) {
+            fs->storeFileInDirectory(files[i], directories[i % NUM_DIRECTORIES]);
+        }
+    });
+
+    measure("LogicalFileSystem::isFileInDirectory()", 2 * NUM_FILES, [&]() {
+        for (int i = 0; i < NUM_FILES; i++) {
+            ASSERT_TRUE(fs->isFileInDirectory(files[i], directories[i % NUM_DIRECTORIES]));
+            ASSERT_FALSE(fs->isFileInDirectory(files[i], directories[(i + 1) % NUM_DIRECTORIES]));
+        }
+    });
+
+    ASSERT_EQ(NUM_FILES / NUM_DIRECTORIES, fs->listFilesInDirectory("/dir_0").size());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+TEST_F(LogicalFileSystemBenchmark, ManyFiles) {
+    DO_TEST_WITH_FORK(do_ManyFiles_benchmark);
+}
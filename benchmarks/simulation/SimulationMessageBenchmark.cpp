@@ -0,0 +1,287 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include <wrench/simulation/SimulationMessageTypeSwitch.h>
+
+#include "../include/Benchmark.h"
+#include "../../test/include/TestWithFork.h"
+#include "../../test/include/UniqueTmpPathPrefix.h"
+
+#define NUM_DISPATCHED_MESSAGES 10000000
+#define NUM_REQUESTS_PER_SERVICE 10000
+
+/**********************************************************************/
+/**                   SimulationMessageBenchmark                     **/
+/**********************************************************************/
+
+class SimulationMessageBenchmark : public Benchmark {
+
+public:
+    std::shared_ptr<wrench::ComputeService> bare_metal_service = nullptr;
+    std::shared_ptr<wrench::ComputeService> batch_service = nullptr;
+    std::shared_ptr<wrench::ComputeService> cloud_service = nullptr;
+    std::shared_ptr<wrench::StorageService> storage_service = nullptr;
+    std::shared_ptr<wrench::FileRegistryService> file_registry_service = nullptr;
+
+    void do_TypeSwitch_benchmark();
+    void do_ServiceThroughput_benchmark();
+
+protected:
+    SimulationMessageBenchmark() {
+
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"WMSHost\" speed=\"1f\" core=\"1\"> "
+                          "         <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "                            <prop id=\"size\" value=\"5000GiB\"/>"
+                          "                            <prop id=\"mount\" value=\"/\"/>"
+                          "         </disk>"
+                          "       </host>"
+                          "       <host id=\"Host1\" speed=\"1f\" core=\"4\"> "
+                          "         <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "                            <prop id=\"size\" value=\"5000GiB\"/>"
+                          "                            <prop id=\"mount\" value=\"/\"/>"
+                          "         </disk>"
+                          "       </host>"
+                          "       <host id=\"Host2\" speed=\"1f\" core=\"4\"> "
+                          "         <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "                            <prop id=\"size\" value=\"5000GiB\"/>"
+                          "                            <prop id=\"mount\" value=\"/\"/>"
+                          "         </disk>"
+                          "       </host>"
+                          "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
+                          "       <route src=\"WMSHost\" dst=\"Host1\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"WMSHost\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+                          "   </zone> "
+                          "</platform>";
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+
+        workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    std::unique_ptr<wrench::Workflow> workflow;
+};
+
+/**********************************************************************/
+/**  TYPE SWITCH (dispatch vs. a chain of dynamic casts)             **/
+/**********************************************************************/
+
+/** Message classes local to this benchmark, in the style of a service's request messages */
+#define TEST_MESSAGE_CLASS(name) \
+class name : public wrench::SimulationMessage { \
+public: \
+    name() : wrench::SimulationMessage(#name, 0) {} \
+};
+
+TEST_MESSAGE_CLASS(TestMessage0)
+TEST_MESSAGE_CLASS(TestMessage1)
+TEST_MESSAGE_CLASS(TestMessage2)
+TEST_MESSAGE_CLASS(TestMessage3)
+TEST_MESSAGE_CLASS(TestMessage4)
+TEST_MESSAGE_CLASS(TestMessage5)
+TEST_MESSAGE_CLASS(TestMessage6)
+TEST_MESSAGE_CLASS(TestMessage7)
+TEST_MESSAGE_CLASS(TestMessage8)
+TEST_MESSAGE_CLASS(TestMessage9)
+TEST_MESSAGE_CLASS(TestMessage10)
+TEST_MESSAGE_CLASS(TestMessage11)
+
+typedef wrench::SimulationMessageTypeSwitch<TestMessage0, TestMessage1, TestMessage2, TestMessage3,
+        TestMessage4, TestMessage5, TestMessage6, TestMessage7,
+        TestMessage8, TestMessage9, TestMessage10, TestMessage11> TestMessageTypes;
+
+static int dispatchWithDynamicCasts(wrench::SimulationMessage *message) {
+    if (dynamic_cast<TestMessage0 *>(message)) {
+        return 0;
+    } else if (dynamic_cast<TestMessage1 *>(message)) {
+        return 1;
+    } else if (dynamic_cast<TestMessage2 *>(message)) {
+        return 2;
+    } else if (dynamic_cast<TestMessage3 *>(message)) {
+        return 3;
+    } else if (dynamic_cast<TestMessage4 *>(message)) {
+        return 4;
+    } else if (dynamic_cast<TestMessage5 *>(message)) {
+        return 5;
+    } else if (dynamic_cast<TestMessage6 *>(message)) {
+        return 6;
+    } else if (dynamic_cast<TestMessage7 *>(message)) {
+        return 7;
+    } else if (dynamic_cast<TestMessage8 *>(message)) {
+        return 8;
+    } else if (dynamic_cast<TestMessage9 *>(message)) {
+        return 9;
+    } else if (dynamic_cast<TestMessage10 *>(message)) {
+        return 10;
+    } else if (dynamic_cast<TestMessage11 *>(message)) {
+        return 11;
+    } else {
+        return -1;
+    }
+}
+
+static int dispatchWithTypeSwitch(TestMessageTypes &message_types, wrench::SimulationMessage *message) {
+    switch (message_types.lookup(message)) {
+        case TestMessageTypes::indexOf<TestMessage0>():
+            return 0;
+        case TestMessageTypes::indexOf<TestMessage1>():
+            return 1;
+        case TestMessageTypes::indexOf<TestMessage2>():
+            return 2;
+        case TestMessageTypes::indexOf<TestMessage3>():
+            return 3;
+        case TestMessageTypes::indexOf<TestMessage4>():
+            return 4;
+        case TestMessageTypes::indexOf<TestMessage5>():
+            return 5;
+        case TestMessageTypes::indexOf<TestMessage6>():
+            return 6;
+        case TestMessageTypes::indexOf<TestMessage7>():
+            return 7;
+        case TestMessageTypes::indexOf<TestMessage8>():
+            return 8;
+        case TestMessageTypes::indexOf<TestMessage9>():
+            return 9;
+        case TestMessageTypes::indexOf<TestMessage10>():
+            return 10;
+        case TestMessageTypes::indexOf<TestMessage11>():
+            return 11;
+        default:
+            return -1;
+    }
+}
+
+TEST_F(SimulationMessageBenchmark, TypeSwitch) {
+    DO_TEST_WITH_FORK(do_TypeSwitch_benchmark);
+}
+
+void SimulationMessageBenchmark::do_TypeSwitch_benchmark() {
+
+    // Messages that are late in the chain
+    std::vector<std::unique_ptr<wrench::SimulationMessage>> messages;
+    messages.emplace_back(new TestMessage9());
+    messages.emplace_back(new TestMessage10());
+    messages.emplace_back(new TestMessage11());
+
+    TestMessageTypes message_types;
+    unsigned long checksum_casts = 0, checksum_switch = 0;
+
+    measure("Chain of dynamic casts", NUM_DISPATCHED_MESSAGES, [&]() {
+        for (int i = 0; i < NUM_DISPATCHED_MESSAGES; i++) {
+            checksum_casts += dispatchWithDynamicCasts(messages[i % 3].get());
+        }
+    });
+
+    measure("SimulationMessageTypeSwitch", NUM_DISPATCHED_MESSAGES, [&]() {
+        for (int i = 0; i < NUM_DISPATCHED_MESSAGES; i++) {
+            checksum_switch += dispatchWithTypeSwitch(message_types, messages[i % 3].get());
+        }
+    });
+
+    ASSERT_EQ(checksum_casts, checksum_switch);
+}
+
+/**********************************************************************/
+/**  SERVICE THROUGHPUT (request messages processed per second)      **/
+/**********************************************************************/
+
+class MessageThroughputBenchmarkWMS : public wrench::WMS {
+
+public:
+    MessageThroughputBenchmarkWMS(SimulationMessageBenchmark *test,
+                             std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    SimulationMessageBenchmark *test;
+
+    int main() {
+
+        std::vector<std::pair<std::string, std::shared_ptr<wrench::ComputeService>>> compute_services = {
+                {"BareMetalComputeService", this->test->bare_metal_service},
+                {"BatchComputeService",     this->test->batch_service},
+                {"CloudComputeService",     this->test->cloud_service}};
+
+        for (auto const &cs : compute_services) {
+            SimulationMessageBenchmark::measure(cs.first, NUM_REQUESTS_PER_SERVICE, [&]() {
+                for (int i = 0; i < NUM_REQUESTS_PER_SERVICE; i++) {
+                    if (cs.second->getTotalNumCores() == 0) {
+                        throw std::runtime_error("Unexpected number of cores for " + cs.first);
+                    }
+                }
+            });
+        }
+
+        auto file = this->getWorkflow()->addFile("file", 10.0);
+        auto location = wrench::FileLocation::LOCATION(this->test->storage_service);
+
+        SimulationMessageBenchmark::measure("SimpleStorageService", NUM_REQUESTS_PER_SERVICE, [&]() {
+            for (int i = 0; i < NUM_REQUESTS_PER_SERVICE; i++) {
+                if (wrench::StorageService::lookupFile(file, location)) {
+                    throw std::runtime_error("Unexpected file on the storage service");
+                }
+            }
+        });
+
+        SimulationMessageBenchmark::measure("FileRegistryService", NUM_REQUESTS_PER_SERVICE, [&]() {
+            for (int i = 0; i < NUM_REQUESTS_PER_SERVICE; i++) {
+                if (not this->test->file_registry_service->lookupEntry(file).empty()) {
+                    throw std::runtime_error("Unexpected entry in the file registry service");
+                }
+            }
+        });
+
+        return 0;
+    }
+};
+
+TEST_F(SimulationMessageBenchmark, ServiceThroughput) {
+    DO_TEST_WITH_FORK(do_ServiceThroughput_benchmark);
+}
+
+void SimulationMessageBenchmark::do_ServiceThroughput_benchmark() {
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("benchmarks");
+
+    auto simulation = std::unique_ptr<wrench::Simulation>(new wrench::Simulation());
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    ASSERT_NO_THROW(bare_metal_service = simulation->add(
+            new wrench::BareMetalComputeService("Host1", (std::vector<std::string>){"Host1"}, "", {}, {})));
+    ASSERT_NO_THROW(batch_service = simulation->add(
+            new wrench::BatchComputeService("Host1", {"Host1", "Host2"}, "", {}, {})));
+    ASSERT_NO_THROW(cloud_service = simulation->add(
+            new wrench::CloudComputeService("Host2", (std::vector<std::string>){"Host2"}, "", {}, {})));
+    ASSERT_NO_THROW(storage_service = simulation->add(
+            new wrench::SimpleStorageService("Host1", {"/"})));
+    ASSERT_NO_THROW(file_registry_service = simulation->add(
+            new wrench::FileRegistryService("WMSHost")));
+
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(new MessageThroughputBenchmarkWMS(this, "WMSHost")));
+    ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
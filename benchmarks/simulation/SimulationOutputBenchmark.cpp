@@ -0,0 +1,100 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+
+#include "../include/Benchmark.h"
+#include "../../test/include/TestWithFork.h"
+#include "../../test/include/UniqueTmpPathPrefix.h"
+
+#define NUM_TASKS 100000
+
+/**********************************************************************/
+/**                   SimulationOutputBenchmark                      **/
+/**********************************************************************/
+
+class SimulationOutputBenchmark : public Benchmark {
+
+public:
+    void do_DumpWorkflowExecutionJSON_benchmark();
+
+protected:
+    SimulationOutputBenchmark() {
+
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"host1\" speed=\"1f\" core=\"10\"> "
+                          "         <prop id=\"ram\" value=\"10B\"/>"
+                          "         <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "                            <prop id=\"size\" value=\"5000GiB\"/>"
+                          "                            <prop id=\"mount\" value=\"/\"/>"
+                          "         </disk>"
+                          "       </host>"
+                          "   </zone> "
+                          "</platform>";
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+
+        workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    std::string execution_data_json_file_path = UNIQUE_TMP_PATH_PREFIX + "workflow_data.json";
+    std::unique_ptr<wrench::Workflow> workflow;
+};
+
+/**********************************************************************/
+/**      DumpWorkflowExecutionJSON (100k synthetic tasks)            **/
+/**********************************************************************/
+
+void SimulationOutputBenchmark::do_DumpWorkflowExecutionJSON_benchmark() {
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("benchmarks");
+
+    auto simulation = std::unique_ptr<wrench::Simulation>(new wrench::Simulation());
+    simulation->init(&argc, argv);
+    simulation->instantiatePlatform(platform_file_path);
+
+    std::shared_ptr<wrench::StorageService> storage_service;
+    ASSERT_NO_THROW(storage_service = simulation->add(new wrench::SimpleStorageService("host1", {"/"})));
+    auto location = wrench::FileLocation::LOCATION(storage_service);
+
+    // Synthetic trace: each task reads one file and writes one file
+    for (int i = 0; i < NUM_TASKS; i++) {
+        auto task = workflow->addTask("task_" + std::to_string(i), 1, 1, 1, 0);
+        auto input = workflow->addFile("input_" + std::to_string(i), 1);
+        auto output = workflow->addFile("output_" + std::to_string(i), 1);
+
+        task->setStartDate(i);
+        task->setEndDate(i + 1);
+        task->setExecutionHost("host1");
+        task->setNumCoresAllocated(1);
+
+        simulation->getOutput().addTimestampFileReadStart(input, location.get(), storage_service.get(), task);
+        simulation->getOutput().addTimestampFileReadCompletion(input, location.get(), storage_service.get(), task);
+        simulation->getOutput().addTimestampFileWriteStart(output, location.get(), storage_service.get(), task);
+        simulation->getOutput().addTimestampFileWriteCompletion(output, location.get(), storage_service.get(), task);
+    }
+
+    measure("dumpWorkflowExecutionJSON() with " + std::to_string(NUM_TASKS) + " tasks", 0, [&]() {
+        ASSERT_NO_THROW(simulation->getOutput().dumpWorkflowExecutionJSON(workflow.get(), execution_data_json_file_path));
+    });
+
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+TEST_F(SimulationOutputBenchmark, DumpWorkflowExecutionJSON) {
+    DO_TEST_WITH_FORK(do_DumpWorkflowExecutionJSON_benchmark);
+}
@@ -0,0 +1,15 @@
+# benchmarks (opt-in: "make benchmarks && ./benchmarks"), which time the library
+# on large inputs and are not part of the unit tests
+set(BENCHMARK_FILES
+        benchmarks/main.cpp
+        benchmarks/include/Benchmark.h
+        test/include/TestWithFork.h
+        test/include/UniqueTmpPathPrefix.h
+        benchmarks/simulation/SimulationOutputBenchmark.cpp
+        benchmarks/simulation/SimulationMessageBenchmark.cpp
+        benchmarks/services/storage_services/LogicalFileSystemBenchmark.cpp
+        benchmarks/services/compute_services/batch/TraceFileLoaderBenchmark.cpp
+        )
+
+add_executable(benchmarks EXCLUDE_FROM_ALL ${BENCHMARK_FILES})
+target_link_libraries(benchmarks ${GTEST_LIBRARY} wrench ${SimGrid_LIBRARY} ${PUGIXML_LIBRARY} -lpthread -lm)
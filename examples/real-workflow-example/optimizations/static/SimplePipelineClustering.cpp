@@ -31,7 +31,7 @@ namespace wrench {
                 std::string cluster_id = "PIPELINE_CLUSTER_" + std::to_string(id++);
 
                 // explore parent
-                WorkflowTask *parent = getTask(workflow->getTaskParents(task));
+                WorkflowTask *parent = getTask(workflow->getTaskParentsView(task));
                 while (parent && pipelined_tasks.find(parent->getID()) == pipelined_tasks.end()
                        && parent->getNumberOfChildren() == 1) {
 
@@ -39,11 +39,11 @@ namespace wrench {
                     parent->setClusterID(cluster_id);
 
                     // next parent
-                    parent = getTask(workflow->getTaskParents(parent));
+                    parent = getTask(workflow->getTaskParentsView(parent));
                 }
 
                 // explore child
-                WorkflowTask *child = getTask(workflow->getTaskChildren(task));
+                WorkflowTask *child = getTask(workflow->getTaskChildrenView(task));
                 while (child && pipelined_tasks.find(child->getID()) == pipelined_tasks.end()
                        && child->getNumberOfParents() == 1) {
 
@@ -51,7 +51,7 @@ namespace wrench {
                     child->setClusterID(cluster_id);
 
                     // next child
-                    child = getTask(workflow->getTaskChildren(child));
+                    child = getTask(workflow->getTaskChildrenView(child));
                 }
 
                 // create clustered task
@@ -64,13 +64,13 @@ namespace wrench {
     }
 
     /**
-     * @brief Get the first task from a vector of tasks
+     * @brief Get the task from a view of at most one task
      *
-     * @param tasks: a vector of WorkflowTask
+     * @param tasks: a view of WorkflowTask
      *
-     * @return The first task of the vector
+     * @return The only task of the view, or nullptr if the view has zero or several tasks
      */
-    WorkflowTask *SimplePipelineClustering::getTask(std::vector<WorkflowTask *> tasks) {
+    WorkflowTask *SimplePipelineClustering::getTask(WorkflowTaskView tasks) {
         if (tasks.size() <= 1) {
             return not tasks.empty() ? tasks[0] : nullptr;
         }
@@ -27,7 +27,7 @@ namespace wrench {
         void process(Workflow *workflow);
 
     private:
-        WorkflowTask *getTask(std::vector<WorkflowTask *> tasks);
+        WorkflowTask *getTask(WorkflowTaskView tasks);
         /***********************/
         /** \endcond           */
         /***********************/
@@ -31,9 +31,9 @@ namespace wrench {
       std::set<WorkflowTask *> root_tasks;
 
       for (auto task : workflow->getTasks()) {
-        flops = (std::max)(flops, task->getFlops() + this->getFlops(workflow, workflow->getTaskChildren(task)));
+        flops = (std::max)(flops, task->getFlops() + this->getFlops(workflow, workflow->getTaskChildrenView(task)));
 
-        if (workflow->getTaskParents(task).size() == 0) {
+        if (workflow->getTaskParentsView(task).empty()) {
           root_tasks.insert(task);
         }
       }
@@ -80,16 +80,16 @@ namespace wrench {
      * @brief Get the total number of flops recursively of the critical path for a given task
      *
      * @param workflow: a pointer to the workflow object
-     * @param tasks: a vector of children tasks
+     * @param tasks: a view of children tasks
      *
      * @return
      */
-    double CriticalPathPilotJobScheduler::getFlops(Workflow *workflow, const std::vector<WorkflowTask *> &tasks) {
+    double CriticalPathPilotJobScheduler::getFlops(Workflow *workflow, WorkflowTaskView tasks) {
       double max_flops = 0;
 
       for (auto task : tasks) {
         if (this->flopsMap.find(task) == this->flopsMap.end()) {
-          double flops = task->getFlops() + getFlops(workflow, workflow->getTaskChildren(task));
+          double flops = task->getFlops() + getFlops(workflow, workflow->getTaskChildrenView(task));
           this->flopsMap[task] = flops;
         }
         max_flops = (std::max)(this->flopsMap[task], max_flops);
@@ -111,8 +111,8 @@ namespace wrench {
       std::set<WorkflowTask *> children;
 
       for (auto task : tasks) {
-        std::vector<WorkflowTask *> children_vector = workflow->getTaskChildren(task);
-        std::copy(children_vector.begin(), children_vector.end(), std::inserter(children, children.end()));
+        auto children_view = workflow->getTaskChildrenView(task);
+        children.insert(children_view.begin(), children_view.end());
       }
       if (children.size() > 0) {
         count = (std::max)(count, getMaxParallelization(workflow, children));
@@ -33,7 +33,7 @@ namespace wrench {
         void schedulePilotJobs(const std::set<std::shared_ptr<ComputeService>> &compute_services) override;
 
     protected:
-        double getFlops(Workflow *, const std::vector<WorkflowTask *> &);
+        double getFlops(Workflow *, WorkflowTaskView);
 
         unsigned long getMaxParallelization(Workflow *, const std::set<WorkflowTask *> &);
         /***********************/
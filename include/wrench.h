@@ -45,6 +45,7 @@
 // Simulation Output Analysis
 #include "wrench/simulation/SimulationTimestamp.h"
 #include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/simulation/SimulationTraceFile.h"
 
 // Tools
 #include "wrench/tools/pegasus/PegasusWorkflowParser.h"
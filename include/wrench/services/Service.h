@@ -14,6 +14,9 @@
 
 #include <string>
 #include <map>
+#include <unordered_map>
+#include <stdexcept>
+#include <type_traits>
 
 #include <wrench/simgrid_S4U_util/S4U_Daemon.h>
 
@@ -42,10 +45,49 @@ namespace wrench {
 
         bool isUp();
 
-        std::string getPropertyValueAsString(std::string);
-        double getPropertyValueAsDouble(std::string);
-        unsigned long getPropertyValueAsUnsignedLong(std::string);
-        bool getPropertyValueAsBoolean(std::string);
+        std::string getPropertyValueAsString(const std::string &property);
+        double getPropertyValueAsDouble(const std::string &property);
+        unsigned long getPropertyValueAsUnsignedLong(const std::string &property);
+        bool getPropertyValueAsBoolean(const std::string &property);
+
+        /**
+         * @brief Get a property of the Service as a value of a given type (std::string, double,
+         *        unsigned long, or bool), which is checked at compile time
+         * @tparam T: the type of the value
+         * @param property: the property
+         * @return the property value
+         *
+         * @throw std::invalid_argument
+         */
+        template<typename T>
+        T getPropertyValue(const std::string &property) {
+            static_assert(std::is_same<T, std::string>::value or std::is_same<T, double>::value or
+                          std::is_same<T, unsigned long>::value or std::is_same<T, bool>::value,
+                          "Service::getPropertyValue(): a property value can only be retrieved as a "
+                          "std::string, a double, an unsigned long, or a bool");
+            return this->getTypedPropertyValue(property, (T *) nullptr);
+        }
+
+        /**
+         * @brief Get a property of the Service as a value of an enumeration, so that a property that
+         *        is used repeatedly can be resolved once (e.g., at construction time)
+         * @tparam E: the enumeration
+         * @param property: the property
+         * @param values: the enumeration value of each valid property value
+         * @return the enumeration value
+         *
+         * @throw std::invalid_argument
+         */
+        template<typename E>
+        E getPropertyValueAsEnum(const std::string &property, const std::map<std::string, E> &values) {
+            std::string string_value = this->getPropertyValueAsString(property);
+            auto value = values.find(string_value);
+            if (value == values.end()) {
+                throw std::invalid_argument(
+                        "Service::getPropertyValueAsEnum(): Invalid property value " + property + " " + string_value);
+            }
+            return value->second;
+        }
 
         void assertServiceIsUp();
 
@@ -60,7 +102,7 @@ namespace wrench {
         /** \cond INTERNAL     */
         /***********************/
 
-        double getMessagePayloadValue(std::string);
+        double getMessagePayloadValue(const std::string &message_payload);
 
         void setStateToDown();
 
@@ -114,6 +156,27 @@ namespace wrench {
         /** @brief The service's name */
         std::string name;
 
+        /** @brief A property value, parsed once (when the property is set) into all types it can be converted to */
+        struct ParsedPropertyValue {
+            /** @brief The value as a string */
+            std::string string_value;
+            /** @brief Whether the value is a valid double */
+            bool is_double = false;
+            /** @brief The value as a double */
+            double double_value = 0.0;
+            /** @brief Whether the value is a valid unsigned long */
+            bool is_unsigned_long = false;
+            /** @brief The value as an unsigned long */
+            unsigned long unsigned_long_value = 0;
+            /** @brief Whether the value is a valid boolean */
+            bool is_boolean = false;
+            /** @brief The value as a boolean */
+            bool boolean_value = false;
+        };
+
+        /** @brief The service's parsed property values */
+        std::unordered_map<std::string, ParsedPropertyValue> parsed_property_values;
+
         /** @brief The time (in seconds) after which a service that doesn't send back a reply (control) message causes
          *  a NetworkTimeOut exception. (default: 30 second; if <0 never timeout)
          */
@@ -162,6 +225,30 @@ namespace wrench {
 
         static unsigned long num_terminated_services;
 
+        static ParsedPropertyValue parsePropertyValue(const std::string &value);
+
+        const ParsedPropertyValue &getParsedPropertyValue(const std::string &property);
+
+        /** @brief getPropertyValue() implementation for strings @param property: the property @return the value */
+        std::string getTypedPropertyValue(const std::string &property, std::string *) {
+            return this->getPropertyValueAsString(property);
+        }
+
+        /** @brief getPropertyValue() implementation for doubles @param property: the property @return the value */
+        double getTypedPropertyValue(const std::string &property, double *) {
+            return this->getPropertyValueAsDouble(property);
+        }
+
+        /** @brief getPropertyValue() implementation for unsigned longs @param property: the property @return the value */
+        unsigned long getTypedPropertyValue(const std::string &property, unsigned long *) {
+            return this->getPropertyValueAsUnsignedLong(property);
+        }
+
+        /** @brief getPropertyValue() implementation for booleans @param property: the property @return the value */
+        bool getTypedPropertyValue(const std::string &property, bool *) {
+            return this->getPropertyValueAsBoolean(property);
+        }
+
 
         /***********************/
         /** \endcond           */
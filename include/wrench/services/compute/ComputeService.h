@@ -11,6 +11,7 @@
 #define SIMULATION_COMPUTESERVICE_H
 
 #include <map>
+#include <tuple>
 
 #include <iostream>
 #include <cfloat>
@@ -92,6 +93,8 @@ namespace wrench {
 
         std::map<std::string, double> getPerHostAvailableMemoryCapacity();
 
+        std::map<std::string, std::tuple<unsigned long, double>> getPerHostIdleResources();
+
         std::map<std::string, double> getCoreFlopRate();
 
         double getTTL();
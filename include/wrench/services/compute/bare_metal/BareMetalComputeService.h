@@ -12,6 +12,7 @@
 
 
 #include <queue>
+#include <unordered_map>
 
 #include "wrench/services/compute/ComputeService.h"
 #include "wrench/services/compute/standard_job_executor/StandardJobExecutor.h"
@@ -57,6 +58,7 @@ namespace wrench {
                 {BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS,                            "false"},
                 {BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD,                          "0.0"},
                 {BareMetalComputeServiceProperty::TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN,      "false"},
+                {BareMetalComputeServiceProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY,        "false"},
         };
 
         std::map<std::string, double> default_messagepayload_values = {
@@ -152,9 +154,24 @@ namespace wrench {
 
         std::map<std::string, std::tuple<unsigned long, double>> compute_resources;
 
-        // Core availabilities (for each hosts, how many cores and how many bytes of RAM are currently available on it)
-        std::map<std::string, double> ram_availabilities;
-        std::map<std::string, unsigned long> running_thread_counts;
+        // Per-host resource state, stored in a flat array (in the same host order as compute_resources)
+        // so that resource selection does not need to look up hosts by name
+        struct HostResourceState {
+            std::string hostname;
+            // The S4U host (a physical host or a VM), whose on/off state and speed may change over time, and
+            // which is resolved whenever the service starts (a restarted VM is a new S4U host)
+            simgrid::s4u::Host *host;
+            unsigned long num_cores;
+            // How many bytes of RAM are currently available, and how many threads are currently running, on the host
+            double ram_availability;
+            unsigned long running_thread_count;
+        };
+        std::vector<HostResourceState> host_states;
+        std::unordered_map<std::string, unsigned long> host_state_indices;
+
+        void initializeHostStates();
+
+        HostResourceState &getHostState(const std::string &hostname);
 
         unsigned long total_num_cores;
 
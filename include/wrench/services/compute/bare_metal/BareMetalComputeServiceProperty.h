@@ -28,6 +28,9 @@ namespace wrench {
         DECLARE_PROPERTY_NAME(TASK_STARTUP_OVERHEAD);
         /** @brief Whether the service should terminate when all hosts are down **/
         DECLARE_PROPERTY_NAME(TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN);
+        /** @brief Whether a multicore task computation should be simulated as a single multi-threaded activity
+         *         rather than with one compute thread per core ("true" or "false") **/
+        DECLARE_PROPERTY_NAME(SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY);
 
     };
 
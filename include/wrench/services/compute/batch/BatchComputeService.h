@@ -30,6 +30,8 @@
 namespace wrench {
 
     class WorkloadTraceFileReplayer; // forward
+    class WorkloadTrace; // forward
+    class AvailableCoresIndex; // forward
 
     /**
      * @brief A batch-scheduled compute service that manages a set of compute hosts and
@@ -73,8 +75,10 @@ namespace wrench {
                 {BatchComputeServiceProperty::USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE,     "false"},
                 {BatchComputeServiceProperty::IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE,     "false"},
                 {BatchComputeServiceProperty::SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE,                          "-1"},
+                {BatchComputeServiceProperty::SIMULATE_JOBS_IN_WORKLOAD_TRACE_FILE_AS_RESERVATIONS,     "false"},
                 {BatchComputeServiceProperty::OUTPUT_CSV_JOB_LOG,                          ""},
                 {BatchComputeServiceProperty::SIMULATE_COMPUTATION_AS_SLEEP,               "false"},
+                {BatchComputeServiceProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY,     "false"},
                 {BatchComputeServiceProperty::BATSCHED_LOGGING_MUTED,                      "true"},
                 {BatchComputeServiceProperty::BATSCHED_CONTIGUOUS_ALLOCATION,              "false"}
         };
@@ -135,6 +139,7 @@ namespace wrench {
         friend class FCFSBatchScheduler;
         friend class CONSERVATIVEBFBatchScheduler;
         friend class CONSERVATIVEBFBatchSchedulerCoreLevel;
+        friend class EASYBFBatchScheduler;
 
         friend class BatschedBatchScheduler;
 
@@ -151,6 +156,10 @@ namespace wrench {
         // helper function
         void submitWorkflowJob(std::shared_ptr<WorkflowJob> job, const std::map<std::string, std::string> &batch_job_args);
 
+        // submits a reservation-only background job (replayed from a workload trace file)
+        void submitBackgroundJob(const std::string &answer_mailbox, const std::string &username,
+                                 unsigned long num_nodes, unsigned long time_in_minutes, double runtime);
+
         //submits a standard job
         void submitStandardJob(std::shared_ptr<StandardJob> job, const std::map<std::string, std::string> &batch_job_args) override;
 
@@ -166,7 +175,7 @@ namespace wrench {
         // terminate a pilot job
         void terminatePilotJob(std::shared_ptr<PilotJob> job) override;
 
-        std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> workload_trace;
+        std::shared_ptr<WorkloadTrace> workload_trace;
         std::shared_ptr<WorkloadTraceFileReplayer> workload_trace_replayer;
 
         bool clean_exit = false;
@@ -183,10 +192,15 @@ namespace wrench {
         std::map<std::string, unsigned long> nodes_to_cores_map;
         std::vector<double> timeslots;
         std::map<std::string, unsigned long> available_nodes_to_cores;
+        std::unique_ptr<AvailableCoresIndex> available_cores_index;
         std::map<unsigned long, std::string> host_id_to_names;
         std::vector<std::string> compute_hosts;
         /* End Resources information in batch */
 
+        void allocateCoresOnHost(const std::string &hostname, unsigned long num_cores);
+
+        void releaseCoresOnHost(const std::string &hostname, unsigned long num_cores);
+
         // Vector of standard job executors
         std::set<std::shared_ptr<StandardJobExecutor>> running_standard_job_executors;
 
@@ -227,7 +241,7 @@ namespace wrench {
 
         };
 #else
-        std::set<std::string> scheduling_algorithms = {"fcfs", "conservative_bf", "conservative_bf_core_level"
+        std::set<std::string> scheduling_algorithms = {"fcfs", "conservative_bf", "conservative_bf_core_level", "easy_bf"
         };
 
         //Batch queue ordering options
@@ -32,6 +32,7 @@ namespace wrench {
          *      - "fcfs": First Come First Serve (default)
          *      - "conservative_bf": a home-grown implementation of FCFS with conservative backfilling, which only allocates resources at the node level (i.e., two jobs can never run on the same node even if that node has enough cores to support both jobs)
          *      - "conservative_bf_core_level": a home-grown implementation of FCFS with conservative backfilling, which only allocates resources at the core level (i.e., two jobs may run on the same node  if that node has enough cores to support both jobs)
+         *      - "easy_bf": a home-grown implementation of FCFS with EASY backfilling (i.e., only the job at the head of the queue holds a reservation), which only allocates resources at the node level (i.e., two jobs can never run on the same node even if that node has enough cores to support both jobs)
          *
          *    - If ENABLE_BATSCHED is set to on:
          *      - whatever scheduling algorithm is supported by Batsched
@@ -110,6 +111,15 @@ namespace wrench {
          */
         DECLARE_PROPERTY_NAME(SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE);
 
+        /**
+         * @brief Whether, when simulating a workload trace file, to replay the jobs in it as mere
+         * node reservations, i.e., jobs that occupy their nodes for their (actual) runtimes without
+         * running any task, which is much less costly to simulate for long background workloads:
+         *      - "true": replay jobs as reservations (jobs are not visible as workflow jobs, and do not compute)
+         *      - "false": replay jobs as standard jobs that compute on all their cores
+         */
+        DECLARE_PROPERTY_NAME(SIMULATE_JOBS_IN_WORKLOAD_TRACE_FILE_AS_RESERVATIONS);
+
         /**
          * @brief Path to a to-be-generated Batsim-style CSV trace file (e.g. for b3atch schedule visualization purposes).
          *      - If ENABLE_BATSCHED is set to off or not set: ignored
@@ -141,6 +151,14 @@ namespace wrench {
         */
         DECLARE_PROPERTY_NAME(SIMULATE_COMPUTATION_AS_SLEEP);
 
+        /** @brief Simulate a multicore computation as a single multi-threaded activity instead of with one compute
+         *         thread per core. This is for scalability reasons, and does not change the simulated execution time
+         *         of a task (except that all thread startup overheads are incurred before the computation starts)
+         *           - "true": simulate computation as a single activity
+         *           - "false": simulate computation with one compute thread per core (default)
+         */
+        DECLARE_PROPERTY_NAME(SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY);
+
         /** @brief Controls Batsched logging
          *      - If ENABLE_BATSCHED is set to off or not set: ignored
          *      - If ENABLE_BATSCHED is set to on:
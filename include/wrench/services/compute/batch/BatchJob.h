@@ -19,6 +19,10 @@ namespace wrench {
         BatchJob(std::shared_ptr<WorkflowJob> job, unsigned long job_id, unsigned long time_in_minutes, unsigned long number_nodes,
                  unsigned long cores_per_node, std::string username, double ending_time_stamp, double arrival_time_stamp);
 
+        //jobid, -t, -N, -c, runtime (for a reservation-only background job)
+        BatchJob(unsigned long job_id, unsigned long time_in_minutes, unsigned long number_nodes,
+                 unsigned long cores_per_node, std::string username, double runtime, double arrival_time_stamp);
+
 
         unsigned long getJobID();
         unsigned long getRequestedTime();
@@ -32,6 +36,8 @@ namespace wrench {
         double getArrivalTimestamp();
         unsigned long getRequestedNumNodes();
         std::shared_ptr<WorkflowJob> getWorkflowJob();
+        bool isBackgroundJob();
+        double getBackgroundRuntime();
         void setEndingTimestamp(double time_stamp);
         std::map<std::string, std::tuple<unsigned long, double>> getResourcesAllocated();
         void setAllocatedResources(std::map<std::string, std::tuple<unsigned long, double>> resources);
@@ -64,6 +70,7 @@ namespace wrench {
         unsigned long requested_num_nodes;
         unsigned long  requested_time;
         std::shared_ptr<WorkflowJob> job;
+        double background_runtime;
         unsigned long requested_cores_per_node;
         std::string username;
         double begin_time_stamp;
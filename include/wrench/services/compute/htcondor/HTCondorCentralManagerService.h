@@ -16,6 +16,9 @@
 #include "wrench/services/compute/htcondor/HTCondorCentralManagerServiceMessagePayload.h"
 
 namespace wrench {
+
+    class HTCondorNegotiatorService;
+
     /***********************/
     /** \cond INTERNAL    */
     /***********************/
@@ -38,7 +41,8 @@ namespace wrench {
                 {HTCondorCentralManagerServiceMessagePayload::RESOURCE_DESCRIPTION_ANSWER_MESSAGE_PAYLOAD,  1024},
                 {HTCondorCentralManagerServiceMessagePayload::STANDARD_JOB_DONE_MESSAGE_PAYLOAD,            1024},
                 {HTCondorCentralManagerServiceMessagePayload::PILOT_JOB_STARTED_MESSAGE_PAYLOAD,            1024},
-                {HTCondorCentralManagerServiceMessagePayload::PILOT_JOB_EXPIRED_MESSAGE_PAYLOAD,            1024}
+                {HTCondorCentralManagerServiceMessagePayload::PILOT_JOB_EXPIRED_MESSAGE_PAYLOAD,            1024},
+                {HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_CYCLE_REQUEST_MESSAGE_PAYLOAD, 1024}
         };
 
     public:
@@ -97,6 +101,8 @@ namespace wrench {
         std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> pending_jobs;
         /** running workflow jobs **/
         std::map<std::shared_ptr<WorkflowJob>, std::shared_ptr<ComputeService>> running_jobs;
+        /** the (persistent) negotiator **/
+        std::shared_ptr<HTCondorNegotiatorService> negotiator;
         /** whether a negotiator is dispatching jobs **/
         bool dispatching_jobs = false;
         /** whether a negotiator could not dispatch jobs **/
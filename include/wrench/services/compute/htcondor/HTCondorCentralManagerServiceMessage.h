@@ -11,9 +11,13 @@
 #define WRENCH_HTCONDORCENTRALMANAGERSERVICEMESSAGE_H
 
 #include "wrench/services/ServiceMessage.h"
+#include "wrench/services/compute/ComputeService.h"
 #include "wrench/workflow/job/StandardJob.h"
 #include "wrench/workflow/job/WorkflowJob.h"
 
+#include <map>
+#include <set>
+#include <tuple>
 #include <vector>
 
 namespace wrench {
@@ -42,6 +46,21 @@ namespace wrench {
         std::vector<std::shared_ptr<WorkflowJob>> scheduled_jobs;
     };
 
+    /**
+     * @brief A message received by a HTCondorNegotiatorService so that it starts a negotiation cycle
+     */
+    class NegotiatorCycleRequestMessage : public HTCondorCentralManagerServiceMessage {
+    public:
+        NegotiatorCycleRequestMessage(std::set<std::shared_ptr<ComputeService>> compute_services,
+                                      std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> pending_jobs,
+                                      double payload);
+
+        /** @brief The compute services available to the HTCondor pool */
+        std::set<std::shared_ptr<ComputeService>> compute_services;
+        /** @brief The pending jobs */
+        std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> pending_jobs;
+    };
+
     /**
      * @brief A message received by a HTCondorCentralManagerService so that it wakes up and
      * tries to dispatch jobs again
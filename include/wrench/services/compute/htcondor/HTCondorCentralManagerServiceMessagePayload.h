@@ -23,6 +23,8 @@ namespace wrench {
      */
     class HTCondorCentralManagerServiceMessagePayload : public ComputeServiceMessagePayload {
     public:
+        /** @brief The number of bytes in the control message sent by the daemon to the negotiator to start a negotiation cycle **/
+        DECLARE_MESSAGEPAYLOAD_NAME(HTCONDOR_NEGOTIATOR_CYCLE_REQUEST_MESSAGE_PAYLOAD);
         /** @brief The number of bytes in the control message sent by the daemon to state that the negotiator has been completed **/
         DECLARE_MESSAGEPAYLOAD_NAME(HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD);
     };
@@ -21,7 +21,8 @@ namespace wrench {
     /** \cond INTERNAL     */
     /***********************/
     /**
-     * @brief A HTCondor negotiator service
+     * @brief A HTCondor negotiator service, i.e., a daemon that runs a negotiation cycle
+     *        (matching pending jobs to compute services) each time it is asked to
      */
     class HTCondorNegotiatorService : public Service {
     private:
@@ -35,9 +36,6 @@ namespace wrench {
 
         HTCondorNegotiatorService(std::string &hostname,
                                   double startup_overhead,
-                                  std::set<std::shared_ptr<ComputeService>> &compute_services,
-                                  std::map<std::shared_ptr<WorkflowJob>, std::shared_ptr<ComputeService>> &running_jobs,
-                                  std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> &pending_jobs,
                                   std::string &reply_mailbox);
 
         ~HTCondorNegotiatorService();
@@ -45,6 +43,11 @@ namespace wrench {
     private:
         int main() override;
 
+        bool processNextMessage();
+
+        void runNegotiationCycle(std::set<std::shared_ptr<ComputeService>> &compute_services,
+                                 std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> &pending_jobs);
+
         struct JobPriorityComparator {
             bool operator()(std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>> &lhs,
                             std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>> &rhs);
@@ -54,16 +57,14 @@ namespace wrench {
         std::shared_ptr<ComputeService> pickTargetComputeServiceGridUniverse(std::shared_ptr<WorkflowJob> job, std::map<std::string, std::string> service_specific_arguments);
         std::shared_ptr<ComputeService> pickTargetComputeServiceNonGridUniverse(std::shared_ptr<WorkflowJob> job, std::map<std::string, std::string> service_specific_arguments);
 
-        /** startup overhead **/
+        /** startup overhead (of each negotiation cycle) **/
         double startup_overhead;
         /** mailbox to reply **/
         std::string reply_mailbox;
-        /** set of compute resources **/
+        /** set of compute resources (for the current negotiation cycle) **/
         std::set<std::shared_ptr<ComputeService>> compute_services;
-        /**map of ongoing jobs **/
-        std::map<std::shared_ptr<WorkflowJob>, std::shared_ptr<ComputeService>> running_jobs;
-        /** queue of pending jobs **/
-        std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> pending_jobs;
+        /** per-host <idle cores, available RAM> snapshots of compute services, fetched at most once per negotiation cycle **/
+        std::map<std::shared_ptr<ComputeService>, std::map<std::string, std::tuple<unsigned long, double>>> resource_snapshots;
     };
 
     /***********************/
@@ -115,6 +115,7 @@ namespace wrench {
                 {StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM, "maximum_flops"},
                 {StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM, "best_fit"},
                 {StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SLEEP, "false"},
+                {StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY, "false"},
         };
 
         std::map<std::string, double> default_messagepayload_values = {
@@ -122,6 +123,29 @@ namespace wrench {
                 {StandardJobExecutorMessagePayload::STANDARD_JOB_FAILED_MESSAGE_PAYLOAD, 1024},
         };
 
+        /** @brief The supported core allocation algorithms (StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM) */
+        enum class CoreAllocationAlgorithm {
+            MAXIMUM,
+            MINIMUM
+        };
+
+        /** @brief The supported task selection algorithms (StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM) */
+        enum class TaskSelectionAlgorithm {
+            MAXIMUM_FLOPS,
+            MAXIMUM_MINIMUM_CORES,
+            MINIMUM_TOP_LEVEL
+        };
+
+        /** @brief The supported host selection algorithms (StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM) */
+        enum class HostSelectionAlgorithm {
+            BEST_FIT
+        };
+
+        // Algorithm properties, resolved at construction time
+        CoreAllocationAlgorithm core_allocation_algorithm;
+        TaskSelectionAlgorithm task_selection_algorithm;
+        HostSelectionAlgorithm host_selection_algorithm;
+
         std::shared_ptr<HostStateChangeDetector> host_state_monitor;
 
         int main() override;
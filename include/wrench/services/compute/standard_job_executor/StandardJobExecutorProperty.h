@@ -60,6 +60,12 @@ namespace wrench {
          */
         DECLARE_PROPERTY_NAME(SIMULATE_COMPUTATION_AS_SLEEP);
 
+        /** @brief Simulate a multicore computation as a single multi-threaded activity instead of with one compute
+         *         thread per core. This is for scalability reasons (fewer simulated actors and messages). Possible
+         *         values are "true" or "false"
+         */
+        DECLARE_PROPERTY_NAME(SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY);
+
     };
 
     /***********************/
@@ -50,7 +50,8 @@ namespace wrench {
                      std::shared_ptr<StorageService> scratch_space,
                      std::shared_ptr<StandardJob>  job,
                      double thread_startup_overhead,
-                     bool simulate_computation_as_sleep);
+                     bool simulate_computation_as_sleep,
+                     bool simulate_computation_as_single_activity = false);
 
         void kill(bool job_termination);
 
@@ -78,6 +79,8 @@ namespace wrench {
 
         void runMulticoreComputationForTask(WorkflowTask *task, bool simulate_computation_as_sleep);
 
+        void runMulticoreComputationAsSingleActivity(const std::vector<double> &work_per_thread);
+
         bool isUseOfScratchSpaceOK();
         bool areFileLocationsOK(WorkflowFile **offending_file);
 
@@ -86,6 +89,7 @@ namespace wrench {
         double ram_utilization;
         double thread_startup_overhead;
         bool simulate_computation_as_sleep;
+        bool simulate_computation_as_single_activity;
 
         std::shared_ptr<StorageService> scratch_space;
 
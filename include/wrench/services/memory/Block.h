@@ -31,7 +31,7 @@ namespace wrench {
 
         Block(Block *blk);
 
-        std::string getFileId();
+        const std::string &getFileId() const;
 
         void setFileId(std::string &fid);
 
@@ -60,6 +60,8 @@ namespace wrench {
         Block* split(double remaining);
 
     private:
+        friend class MemoryManager;
+
         std::string file_id;
 //        std::string mountpoint;
         std::shared_ptr<FileLocation> location;
@@ -68,6 +70,14 @@ namespace wrench {
         bool dirty;
         double dirty_time;
 
+        // Intrusive links, maintained by the MemoryManager: the block's neighbors in its LRU list,
+        // and in the list of the blocks of the same file in that LRU list
+        Block *lru_prev = nullptr;
+        Block *lru_next = nullptr;
+        Block *file_prev = nullptr;
+        Block *file_next = nullptr;
+        bool in_active_list = false;
+
         /***********************/
         /** \endcond           */
         /***********************/
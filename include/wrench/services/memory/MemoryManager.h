@@ -12,6 +12,9 @@
 #define WRENCH_MEMORYMANAGER_H
 
 #include <string>
+#include <deque>
+#include <queue>
+#include <unordered_map>
 #include <wrench/services/Service.h>
 #include <wrench/simulation/Simulation.h>
 #include "Block.h"
@@ -35,8 +38,38 @@ namespace wrench {
         double dirty_ratio;
         int interval;
         int expired_time;
-        std::vector<Block *> inactive_list;
-        std::vector<Block *> active_list;
+
+        /** @brief The head and tail of the list of the blocks of a file in an LRU list */
+        struct FileBlocks {
+            Block *head = nullptr;
+            Block *tail = nullptr;
+        };
+
+        /**
+         * @brief An LRU list of blocks (least recently used first), implemented as an intrusive doubly-linked
+         *        list, along with a per-file index of its blocks (which are in the same order as in the LRU list)
+         */
+        struct LruList {
+            Block *head = nullptr;
+            Block *tail = nullptr;
+            double size = 0;
+            std::unordered_map<std::string, FileBlocks> files;
+        };
+
+        LruList inactive_list;
+        LruList active_list;
+
+        // Block storage: blocks are recycled (through the free list) rather than individually allocated
+        std::deque<Block> block_pool;
+        std::vector<Block *> free_blocks;
+
+        // Dirty times of the blocks that were written dirty to cache and that may not have been flushed yet
+        // (earliest first), so that periodical flushing only wakes up when some dirty data has expired
+        std::priority_queue<double, std::vector<double>, std::greater<double>> dirty_times;
+        // Used to wake up periodical flushing when dirty data is written while there was none
+        simgrid::s4u::MutexPtr flusher_mutex;
+        simgrid::s4u::ConditionVariablePtr flusher_condition;
+
         double total;
 
         // We keep track of these properties since we don't want to traverse through two LRU lists to get them.
@@ -58,11 +91,28 @@ namespace wrench {
 
         double pdflush();
 
-        double flushExpiredData(std::vector<Block *> &list);
+        double getNextFlushTime(double tick);
+
+        double flushExpiredData(LruList &list);
+
+        double flushLruList(LruList &list, double amount, const std::string &excluded_filename);
+
+        double evictLruList(LruList &lru_list, double amount, const std::string &excluded_filename);
+
+        Block *newBlock(const std::string &fid, const std::shared_ptr<FileLocation> &location, double sz,
+                        double last_access, bool is_dirty, double dirty_time);
+
+        void deleteBlock(Block *blk);
+
+        void pushBack(LruList &list, Block *blk);
+
+        void unlink(Block *blk);
+
+        void moveToBack(LruList &list, Block *blk);
 
-        double flushLruList(std::vector<Block *> &list, double amount, std::string excluded_filename);
+        void resizeBlock(Block *blk, double size);
 
-        double evictLruList(std::vector<Block *> &lru_list, double amount, std::string excluded_filename);
+        double getCachedAmountInList(const LruList &list, const std::string &filename);
 
     public:
 
@@ -13,6 +13,7 @@
 #include <cfloat>
 #include <complex>
 #include <random>
+#include <unordered_map>
 #include "wrench/services/Service.h"
 #include "wrench/services/network_proximity/NetworkProximityServiceProperty.h"
 #include "wrench/services/network_proximity/NetworkProximityDaemon.h"
@@ -99,9 +100,31 @@ namespace wrench {
 
         void addEntryToDatabase(std::pair<std::string, std::string> pair_hosts, double proximity_value);
 
-        std::map<std::pair<std::string, std::string>, std::pair<double, double>> entries;
+        long getHostID(const std::string &hostname);
 
-        std::map<std::string, std::pair<std::complex<double>, double>> coordinate_lookup_table;
+        /** @brief Whether this is a 'vivaldi' (rather than 'alltoall') network proximity service */
+        bool is_vivaldi;
+
+        /** @brief Host IDs (i.e., indices in hosts_in_network), indexed by hostname */
+        std::unordered_map<std::string, unsigned long> host_ids;
+
+        /** @brief Latest proximity values ('alltoall' only), indexed by sender host ID * num hosts + peer host ID */
+        std::vector<double> proximity_values;
+        /** @brief Dates of the latest proximity values ('alltoall' only), indexed like proximity_values */
+        std::vector<double> proximity_dates;
+
+        /** @brief Coordinates ('vivaldi' only), indexed by host ID */
+        std::vector<std::complex<double>> coordinates;
+        /** @brief Dates of the latest coordinate updates ('vivaldi' only), indexed by host ID */
+        std::vector<double> coordinate_dates;
+
+        /** @brief Network daemon indices (i.e., indices in network_daemons) */
+        std::unordered_map<NetworkProximityDaemon *, unsigned long> daemon_indices;
+        /** @brief Per network daemon, the <multiplier, offset> of the affine permutation of the other
+         *         daemons whose first peer_pool_size elements are that daemon's potential peers */
+        std::vector<std::pair<unsigned long, unsigned long>> peer_permutations;
+        /** @brief The number of potential peers of each network daemon */
+        unsigned long peer_pool_size;
 
         std::shared_ptr<NetworkProximityDaemon>
         getCommunicationPeer(const std::shared_ptr<NetworkProximityDaemon> sender_daemon);
@@ -37,8 +37,9 @@ namespace wrench {
      *        to fully sequential executions (first a network receive/send, and then a disk write/read).
      *        Setting the buffer size to "0" corresponds to a fully fluid model in which individual
      *        data chunk operations are not simulated, thus achieving both accuracy (unless one specifically wishes
-     *        to study the effects of buffering) and quick simulation times. For now, setting the buffer
-     *        size to "0" is not implemented. The default buffer size is 10 MiB (note that the user can
+     *        to study the effects of buffering) and quick simulation times: each file transfer then
+     *        consists of a single message, with the disk I/O and the network transfer occurring concurrently.
+     *        The default buffer size is 10 MiB (note that the user can
      *        always declare a disk with arbitrary bandwidth in the platform description XML).
      */
     class SimpleStorageService : public StorageService {
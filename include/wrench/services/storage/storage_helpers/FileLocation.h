@@ -11,6 +11,9 @@
 #define WRENCH_FILELOCATION_H
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+#include <deque>
 
 
 namespace wrench {
@@ -69,6 +72,10 @@ namespace wrench {
         static std::string sanitizePath(std::string path);
         static bool properPathPrefix(std::string path1, std::string path2);
 
+        static unsigned long internPath(const std::string &path);
+        static const std::string &getInternedPath(unsigned long path_id);
+        static unsigned long getNumInternedPaths();
+
     private:
 
         friend class LogicalFileSystem;
@@ -79,12 +86,24 @@ namespace wrench {
          * @param ap: the absolute path
          */
         FileLocation(std::shared_ptr<StorageService> ss, std::string mp, std::string apamp) :
-                storage_service(ss), mount_point(mp), absolute_path_at_mount_point(apamp) { }
+                storage_service(ss), mount_point(mp), absolute_path_at_mount_point(apamp) {
+            if (ss != nullptr) {
+                this->full_absolute_path = sanitizePath(this->mount_point + "/" + this->absolute_path_at_mount_point);
+            }
+        }
+
+        static std::string doSanitizePath(std::string path);
 
         std::shared_ptr<StorageService> storage_service;
         std::shared_ptr<StorageService> server_storage_service;
         std::string mount_point;
         std::string absolute_path_at_mount_point;
+        std::string full_absolute_path;
+
+        /** @brief Interned (i.e., sanitized) paths, indexed by path ID */
+        static std::deque<std::string> interned_paths;
+        /** @brief Path IDs, indexed by path (both sanitized paths and paths as passed to sanitizePath()) */
+        static std::unordered_map<std::string, unsigned long> interned_path_ids;
 
 
     };
@@ -14,9 +14,12 @@
 #include <string>
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 
 #include "wrench/workflow/WorkflowFile.h"
+#include "wrench/services/storage/storage_helpers/FileLocation.h"
 
 namespace wrench {
 
@@ -63,14 +66,16 @@ namespace wrench {
 
         static std::map<std::string, StorageService*> mount_points;
 
-        std::map<std::string, std::set<WorkflowFile*>> content;
+        /** @brief The files in each directory, indexed by interned path ID (see FileLocation::internPath()) */
+        std::unordered_map<unsigned long, std::unordered_set<WorkflowFile*>> content;
 
         std::string hostname;
         StorageService *storage_service;
         std::string mount_point;
         double total_capacity;
         double occupied_space;
-        std::map<std::string, double> reserved_space;
+        /** @brief The files for which space is reserved in each directory, indexed by interned path ID */
+        std::unordered_map<unsigned long, std::unordered_set<WorkflowFile*>> reserved_space;
 
         bool initialized;
 
@@ -79,30 +84,20 @@ namespace wrench {
                 throw std::runtime_error("LogicalFileSystem::assertInitHasBeenCalled(): A logical file system needs to be initialized before it's been called");
             }
         }
-        void assertDirectoryExist(std::string absolute_path) {
-            if (not this->doesDirectoryExist(absolute_path)) {
-                throw std::invalid_argument("LogicalFileSystem::assertDirectoryExists(): directory " + absolute_path + " does not exist");
-            }
-        }
-
-        void assertDirectoryDoesNotExist(std::string absolute_path) {
-            if (this->doesDirectoryExist(absolute_path)) {
-                throw std::invalid_argument("LogicalFileSystem::assertDirectoryExists(): directory " + absolute_path + " already exists");
-            }
-        }
 
-        void assertDirectoryIsEmpty(std::string absolute_path) {
-            assertDirectoryExist(absolute_path);
-            if (not this->isDirectoryEmpty(absolute_path)) {
-                throw std::invalid_argument("LogicalFileSystem::assertDirectoryIsEmpty(): directory " + absolute_path + "is not empty");
+        std::unordered_set<WorkflowFile*> &getDirectoryContent(unsigned long directory_id) {
+            auto it = this->content.find(directory_id);
+            if (it == this->content.end()) {
+                throw std::invalid_argument("LogicalFileSystem::assertDirectoryExists(): directory " +
+                                            FileLocation::getInternedPath(directory_id) + " does not exist");
             }
+            return it->second;
         }
 
-        void assertFileIsInDirectory(WorkflowFile *file, std::string absolute_path) {
-            assertDirectoryExist(absolute_path);
-            if (this->content[absolute_path].find(file) == this->content[absolute_path].end()) {
-                throw std::invalid_argument("LogicalFileSystem::assertFileIsInDirectory(): File " + file->getID() +
-                " is not in directory " + absolute_path);
+        void assertDirectoryDoesNotExist(unsigned long directory_id) {
+            if (this->content.find(directory_id) != this->content.end()) {
+                throw std::invalid_argument("LogicalFileSystem::assertDirectoryExists(): directory " +
+                                            FileLocation::getInternedPath(directory_id) + " already exists");
             }
         }
 
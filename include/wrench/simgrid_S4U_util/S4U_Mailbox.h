@@ -15,6 +15,7 @@
 #include <string>
 #include <map>
 #include <set>
+#include <vector>
 
 #include <simgrid/s4u.hpp>
 
@@ -41,11 +42,23 @@ namespace wrench {
 				static std::shared_ptr<S4U_PendingCommunication> igetMessage(std::string mailbox_name);
 //				static void clear_dputs();
 
+				static std::unique_ptr<SimulationMessage> putRequestAndGetAnswer(std::string mailbox_name,
+				                                                                 SimulationMessage *request,
+				                                                                 const std::string &answer_mailbox,
+				                                                                 double timeout = -1);
+
 				static std::string generateUniqueMailboxName(std::string);
 				static unsigned long generateUniqueSequenceNumber();
 
+				static std::string getTemporaryMailbox();
+				static void retireTemporaryMailbox(const std::string &mailbox_name);
+				static unsigned long getNumTemporaryMailboxes();
+
 		private:
 
+				static std::vector<std::string> free_temporary_mailboxes;
+				static unsigned long num_temporary_mailboxes;
+
 //				static std::map<simgrid::s4u::ActorPtr , std::set<simgrid::s4u::CommPtr>> dputs;
 
 		};
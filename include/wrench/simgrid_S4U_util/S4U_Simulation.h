@@ -12,6 +12,7 @@
 #define WRENCH_S4U_SIMULATION_H
 
 #include <set>
+#include <unordered_map>
 #include <simgrid/s4u.hpp>
 #include <simgrid/kernel/routing/ClusterZone.hpp>
 
@@ -31,6 +32,20 @@ namespace wrench {
         /** @brief The ram capacity of a physical host whenever not specified in the platform description file */
         static constexpr double DEFAULT_RAM = (1024.0 * 1024.0 * 1024.0 * 1024.0 * 1024.0); // 1 PiB
 
+        /** @brief Static attributes of a physical host, cached when the platform is set up */
+        struct HostInfo {
+            /** @brief The host's name */
+            std::string name;
+            /** @brief The S4U host */
+            simgrid::s4u::Host *host;
+            /** @brief The host's number of cores */
+            unsigned int num_cores;
+            /** @brief The host's RAM capacity in bytes (negative if the platform specification is invalid) */
+            double memory_capacity;
+            /** @brief The host's disks, with their (sanitized) mount points */
+            std::vector<std::pair<std::string, simgrid::s4u::Disk *>> disks;
+        };
+
     public:
         void initialize(int *argc, char **argv);
         void setupPlatform(std::string&);
@@ -39,6 +54,10 @@ namespace wrench {
         static double getClock();
         static std::string getHostName();
         static bool hostExists(std::string hostname);
+        static unsigned long getNumHosts();
+        static unsigned long getHostID(const std::string &hostname);
+        static const HostInfo &getHostInfo(unsigned long host_id);
+        static simgrid::s4u::Host *getHost(const std::string &hostname);
         static bool linkExists(std::string linkname);
         static std::vector<std::string> getRoute(std::string &src_host, std::string &dst_host);
         static unsigned int getHostNumCores(std::string hostname);
@@ -54,6 +73,7 @@ namespace wrench {
         static double getHostMemoryCapacity(std::string hostname);
         static double getMemoryCapacity();
         static void compute(double);
+        static void computeMultiThreaded(unsigned long num_threads, double flops_per_thread);
         static void sleep(double);
         static void computeZeroFlop();
         static void writeToDisk(double num_bytes, std::string hostname, std::string mount_point);
@@ -94,6 +114,15 @@ namespace wrench {
 
     private:
         static double getHostMemoryCapacity(simgrid::s4u::Host *host);
+        static void buildHostRegistry();
+        static const HostInfo *findHostInfo(const std::string &hostname);
+        static simgrid::s4u::Host *getHostOrNull(const std::string &hostname);
+        static simgrid::s4u::Disk *getDiskOrNull(const std::string &hostname, const std::string &mount_point);
+
+        // The dense host registry: physical hosts, indexed by host ID (VMs are not in it)
+        static std::vector<HostInfo> host_infos;
+        static std::unordered_map<std::string, unsigned long> host_ids;
+
         simgrid::s4u::Engine *engine;
         bool initialized = false;
         bool platform_setup = false;
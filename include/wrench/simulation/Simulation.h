@@ -12,6 +12,7 @@
 #define WRENCH_SIMULATION_H
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <nlohmann/json.hpp>
 #include "Version.h"
@@ -143,7 +144,7 @@ namespace wrench {
         void readWithMemoryCache(WorkflowFile *file, double n_bytes, std::shared_ptr<FileLocation> location);
         void writebackWithMemoryCache(WorkflowFile *file, double n_bytes, std::shared_ptr<FileLocation> location, bool is_dirty);
         void writeThroughWithMemoryCache(WorkflowFile *file, double n_bytes, std::shared_ptr<FileLocation> location);
-        MemoryManager* getMemoryManagerByHost(std::string hostname);
+        MemoryManager* getMemoryManagerByHost(const std::string &hostname);
 
         static double getMemoryCapacity();
         static unsigned long getNumCores();
@@ -182,6 +183,7 @@ namespace wrench {
         std::set<std::shared_ptr<StorageService>> storage_services;
 
         std::set<std::shared_ptr<MemoryManager>> memory_managers;
+        std::unordered_map<std::string, MemoryManager *> memory_managers_by_host;
 
         static int unique_disk_sequence_number;
 
@@ -14,6 +14,8 @@
 #include <string>
 #include <map>
 #include <iostream>
+#include <typeinfo>
+#include <unordered_map>
 
 namespace wrench {
 
@@ -33,10 +35,35 @@ namespace wrench {
 
         virtual std::string getName();
 
+        unsigned int getTypeTag();
+        static unsigned int getTypeTag(const std::type_info &type);
+
+        /**
+         * @brief Get the type tag of a message class
+         * @tparam T: the message class
+         * @return the type tag
+         */
+        template <class T>
+        static unsigned int getTypeTag() {
+            static const unsigned int tag = getTypeTag(typeid(T));
+            return tag;
+        }
+
+        static void *operator new(size_t size);
+        static void operator delete(void *ptr, size_t size);
+
+        static std::map<std::string, unsigned long> getAllocationCounts();
+
         /** @brief The message name */
         std::string name;
         /** @brief The message size in bytes */
         double payload;
+
+    private:
+        static std::unordered_map<std::string, unsigned long> allocation_counts;
+
+        /** @brief The message's type tag (0 until it has been looked up) */
+        unsigned int type_tag;
     };
 
 
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONMESSAGETYPESWITCH_H
+#define WRENCH_SIMULATIONMESSAGETYPESWITCH_H
+
+#include <type_traits>
+#include <vector>
+
+#include "wrench/simulation/SimulationMessage.h"
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A helper class to dispatch messages based on their types with a switch statement,
+     *        i.e., through a jump table, instead of through a chain of dynamic casts. A message
+     *        is resolved to the index of the first type in the list of which it is an instance (which
+     *        is what a chain of dynamic casts would find), and that resolution is done only
+     *        once per message class, after which it is looked up by the message's type tag.
+     *
+     *        Typical use:
+     *
+     *        typedef SimulationMessageTypeSwitch<FooMessage, BarMessage> MessageTypes;
+     *        static MessageTypes message_types;
+     *        switch (message_types.lookup(message.get())) {
+     *            case MessageTypes::indexOf<FooMessage>(): {
+     *                auto msg = static_cast<FooMessage *>(message.get());
+     *                ...
+     *            }
+     *            ...
+     *            default:
+     *                throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+     *        }
+     *
+     * @tparam MessageTypes: the message types, in the order in which they should be matched
+     */
+    template<class... MessageTypes>
+    class SimulationMessageTypeSwitch {
+
+    public:
+
+        /** @brief The index returned for messages that are not instances of any of the types */
+        static constexpr int NO_MATCH = -1;
+
+        /**
+         * @brief Get the index of a message type in the list
+         * @tparam T: the message type
+         * @return an index
+         */
+        template<class T>
+        static constexpr int indexOf() {
+            static_assert(contains<T>(), "SimulationMessageTypeSwitch::indexOf(): type is not in the list");
+            constexpr bool is_same[] = {std::is_same<T, MessageTypes>::value...};
+            for (int i = 0; i < (int) sizeof...(MessageTypes); i++) {
+                if (is_same[i]) {
+                    return i;
+                }
+            }
+            return NO_MATCH;
+        }
+
+        /**
+         * @brief Find the index of the first type in the list of which a message is an instance
+         * @param message: the message
+         * @return an index, or NO_MATCH
+         */
+        int lookup(SimulationMessage *message) {
+            unsigned int tag = message->getTypeTag();
+            if (tag >= this->indices.size()) {
+                this->indices.resize(tag + 1, UNRESOLVED);
+            }
+            if (this->indices[tag] == UNRESOLVED) {
+                this->indices[tag] = resolve(message);
+            }
+            return this->indices[tag];
+        }
+
+    private:
+
+        /** @brief The index of message classes that have not been seen yet */
+        static constexpr int UNRESOLVED = -2;
+
+        /** @brief The indices of message classes, indexed by type tag */
+        std::vector<int> indices;
+
+        template<class T>
+        static constexpr bool contains() {
+            constexpr bool is_same[] = {std::is_same<T, MessageTypes>::value...};
+            for (int i = 0; i < (int) sizeof...(MessageTypes); i++) {
+                if (is_same[i]) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        static int resolve(SimulationMessage *message) {
+            const bool is_instance[] = {(dynamic_cast<MessageTypes *>(message) != nullptr)...};
+            for (int i = 0; i < (int) sizeof...(MessageTypes); i++) {
+                if (is_instance[i]) {
+                    return i;
+                }
+            }
+            return NO_MATCH;
+        }
+    };
+
+    template<class... MessageTypes>
+    constexpr int SimulationMessageTypeSwitch<MessageTypes...>::NO_MATCH;
+
+    template<class... MessageTypes>
+    constexpr int SimulationMessageTypeSwitch<MessageTypes...>::UNRESOLVED;
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+}
+
+#endif //WRENCH_SIMULATIONMESSAGETYPESWITCH_H
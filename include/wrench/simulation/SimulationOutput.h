@@ -13,6 +13,7 @@
 #include <typeinfo>
 #include <typeindex>
 #include <iostream>
+#include <unordered_map>
 
 #include "wrench/simulation/SimulationTimestamp.h"
 #include "wrench/simulation/SimulationTrace.h"
@@ -20,6 +21,7 @@
 
 namespace wrench {
     class Simulation;
+    class JSONStreamWriter;
 
     /**
      * @brief A class that contains post-mortem simulation-generated data
@@ -36,21 +38,27 @@ namespace wrench {
          */
         template<class T>
         std::vector<SimulationTimestamp<T> *> getTrace() {
-            std::type_index type_index = std::type_index(typeid(T));
-
-            // Is the trace empty?
-            if (this->traces.find(type_index) == this->traces.end()) {
-                return {};
-            }
-
+            auto view = this->getTraceView<T>();
             std::vector<SimulationTimestamp<T> *> non_generic_vector;
-            auto trace = (SimulationTrace<T> *) (this->traces[type_index]);
-            for (auto ts : trace->getTrace()) {
-                non_generic_vector.push_back((SimulationTimestamp<T> *) ts);
+            non_generic_vector.reserve(view.size());
+            for (auto ts : view) {
+                non_generic_vector.push_back(ts);
             }
             return non_generic_vector;
         }
 
+        /**
+         * @brief Retrieve a view of a simulation output trace, which unlike getTrace() does
+         *        not copy the trace (and thus does not allocate memory)
+         *
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return a view over pointers to SimulationTimestampXXXX instances
+         */
+        template<class T>
+        SimulationTraceView<T> getTraceView() {
+            return SimulationTraceView<T>(&(this->getSimulationTrace<T>()->getTimestamps()));
+        }
+
         void dumpWorkflowExecutionJSON(Workflow *workflow, std::string file_path,
                                        bool generate_host_utilization_layout = false, bool writing_file = true);
 
@@ -73,6 +81,18 @@ namespace wrench {
                              bool include_disk = false,
                              bool include_bandwidth = false);
 
+        void dumpUnifiedJSON(Workflow *workflow, std::ostream &output,
+                             bool include_platform = false,
+                             bool include_workflow_exec = true,
+                             bool include_workflow_graph = false,
+                             bool include_energy = false,
+                             bool generate_host_utilization_layout = false,
+                             bool include_disk = false,
+                             bool include_bandwidth = false,
+                             bool pretty_print = true);
+
+        void dumpBinaryTrace(std::string file_path);
+
         void enableWorkflowTaskTimestamps(bool enabled);
 
         void enableFileReadWriteCopyTimestamps(bool enabled);
@@ -154,11 +174,7 @@ namespace wrench {
         */
         template<class T>
         void addTimestamp(T *timestamp) {
-            std::type_index type_index = std::type_index(typeid(T));
-            if (this->traces.find(type_index) == this->traces.end()) {
-                this->traces[type_index] = new SimulationTrace<T>();
-            }
-            ((SimulationTrace<T> *) (this->traces[type_index]))->addTimestamp(new SimulationTimestamp<T>(timestamp));
+            this->getSimulationTrace<T>()->addTimestamp(timestamp);
         }
 
         /***********************/
@@ -179,15 +195,42 @@ namespace wrench {
 
     private:
         std::map<std::type_index, GenericSimulationTrace *> traces;
-        nlohmann::json platform_json_part;
-        nlohmann::json workflow_exec_json_part;
-        nlohmann::json workflow_graph_json_part;
-        nlohmann::json energy_json_part;
-        nlohmann::json disk_json_part;
-        nlohmann::json bandwidth_json_part;
 
         std::map<std::type_index, bool> enabledStatus;
 
+        /** @brief Per-task index of file read start timestamps (keyed by task ID), built as timestamps are added */
+        std::unordered_map<std::string, std::vector<SimulationTimestampFileReadStart *>> file_read_starts_by_task;
+        /** @brief Per-task index of file write start timestamps (keyed by task ID), built as timestamps are added */
+        std::unordered_map<std::string, std::vector<SimulationTimestampFileWriteStart *>> file_write_starts_by_task;
+
+        void writeWorkflowExecutionJSON(JSONStreamWriter &writer, Workflow *workflow);
+
+        void writeWorkflowGraphJSON(JSONStreamWriter &writer, Workflow *workflow);
+
+        void writeHostEnergyConsumptionJSON(JSONStreamWriter &writer);
+
+        void writeDiskOperationsJSON(JSONStreamWriter &writer);
+
+        void writeLinkUsageJSON(JSONStreamWriter &writer);
+
+        nlohmann::json generatePlatformGraphJSON();
+
+        void generateHostUtilizationLayout(Workflow *workflow);
+
+        /**
+         * @brief  Retrieve a simulation output trace, creating it if needed
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return the trace
+         */
+        template<class T>
+        SimulationTrace<T> *getSimulationTrace() {
+            auto &trace = this->traces[std::type_index(typeid(T))];
+            if (trace == nullptr) {
+                trace = new SimulationTrace<T>();
+            }
+            return (SimulationTrace<T> *) trace;
+        }
+
         /**
          * @brief  Determines whether a time stamp time is enabled
          * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
@@ -11,10 +11,12 @@
 #define WRENCH_SIMULATIONTRACE_H
 
 #include <vector>
+#include <deque>
 #include <map>
 #include <cmath>
 #include <cfloat>
 #include <algorithm>
+#include <iterator>
 
 #include "wrench/simulation/SimulationTimestamp.h"
 
@@ -36,12 +38,150 @@ namespace wrench {
     /** \endcond           */
     /***********************/
 
+    /**
+     * @brief A lightweight, read-only view over the timestamps stored in a simulation output trace,
+     *        which provides typed iteration, size, and random access without copying the trace. A view
+     *        remains valid, and sees timestamps added after its creation, as long as the SimulationOutput exists.
+     *
+     * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+     */
+    template <class T> class SimulationTraceView {
+
+    public:
+
+        /**
+         * @brief A read-only random access iterator over the timestamps of a view. Dereferencing
+         *        the iterator yields a pointer to a timestamp (as in the vector returned by getTrace()),
+         *        so that non-modifying algorithms (std::advance, std::lower_bound, std::find_if, etc.)
+         *        can be used on a view
+         */
+        class iterator {
+        public:
+            /** @brief Iterator category */
+            typedef std::random_access_iterator_tag iterator_category;
+            /** @brief Value type */
+            typedef SimulationTimestamp<T> *value_type;
+            /** @brief Difference type */
+            typedef std::ptrdiff_t difference_type;
+            /** @brief Pointer type */
+            typedef SimulationTimestamp<T> **pointer;
+            /** @brief Reference type (timestamps are returned by pointer) */
+            typedef SimulationTimestamp<T> *reference;
+
+            /** @brief Default constructor */
+            iterator() = default;
+
+            /**
+             * @brief Constructor
+             * @param it: an iterator in the underlying storage
+             */
+            explicit iterator(typename std::deque<SimulationTimestamp<T>>::iterator it) : it(it) {}
+
+            /** @brief Dereference operator @return a pointer to the timestamp */
+            SimulationTimestamp<T> *operator*() const { return &(*this->it); }
+            /** @brief Member access operator @return a pointer to the timestamp */
+            SimulationTimestamp<T> *operator->() const { return &(*this->it); }
+            /** @brief Subscript operator @param n: an offset @return a pointer to the timestamp at that offset */
+            SimulationTimestamp<T> *operator[](difference_type n) const { return &(this->it[n]); }
+
+            /** @brief Pre-increment operator @return the iterator */
+            iterator &operator++() { ++this->it; return *this; }
+            /** @brief Post-increment operator @return the iterator before the increment */
+            iterator operator++(int) { iterator tmp = *this; ++this->it; return tmp; }
+            /** @brief Pre-decrement operator @return the iterator */
+            iterator &operator--() { --this->it; return *this; }
+            /** @brief Post-decrement operator @return the iterator before the decrement */
+            iterator operator--(int) { iterator tmp = *this; --this->it; return tmp; }
+
+            /** @brief Compound addition operator @param n: an offset @return the iterator */
+            iterator &operator+=(difference_type n) { this->it += n; return *this; }
+            /** @brief Compound subtraction operator @param n: an offset @return the iterator */
+            iterator &operator-=(difference_type n) { this->it -= n; return *this; }
+            /** @brief Addition operator @param n: an offset @return a new iterator */
+            iterator operator+(difference_type n) const { return iterator(this->it + n); }
+            /** @brief Addition operator @param n: an offset @param other: an iterator @return a new iterator */
+            friend iterator operator+(difference_type n, const iterator &other) { return other + n; }
+            /** @brief Subtraction operator @param n: an offset @return a new iterator */
+            iterator operator-(difference_type n) const { return iterator(this->it - n); }
+            /** @brief Difference operator @param other: an iterator @return the distance between the iterators */
+            difference_type operator-(const iterator &other) const { return this->it - other.it; }
+
+            /** @brief Equality operator @param other: an iterator @return true if equal */
+            bool operator==(const iterator &other) const { return this->it == other.it; }
+            /** @brief Inequality operator @param other: an iterator @return true if not equal */
+            bool operator!=(const iterator &other) const { return this->it != other.it; }
+            /** @brief Less-than operator @param other: an iterator @return true if before other */
+            bool operator<(const iterator &other) const { return this->it < other.it; }
+            /** @brief Greater-than operator @param other: an iterator @return true if after other */
+            bool operator>(const iterator &other) const { return this->it > other.it; }
+            /** @brief Less-than-or-equal operator @param other: an iterator @return true if not after other */
+            bool operator<=(const iterator &other) const { return this->it <= other.it; }
+            /** @brief Greater-than-or-equal operator @param other: an iterator @return true if not before other */
+            bool operator>=(const iterator &other) const { return this->it >= other.it; }
+
+        private:
+            typename std::deque<SimulationTimestamp<T>>::iterator it;
+        };
+
+        /**
+         * @brief Constructor
+         * @param timestamps: the underlying timestamp storage
+         */
+        explicit SimulationTraceView(std::deque<SimulationTimestamp<T>> *timestamps) : timestamps(timestamps) {}
+
+        /**
+         * @brief Get an iterator to the first timestamp
+         * @return an iterator
+         */
+        iterator begin() const {
+            return iterator(this->timestamps->begin());
+        }
+
+        /**
+         * @brief Get an iterator past the last timestamp
+         * @return an iterator
+         */
+        iterator end() const {
+            return iterator(this->timestamps->end());
+        }
+
+        /**
+         * @brief Get the number of timestamps
+         * @return a number of timestamps
+         */
+        size_t size() const {
+            return this->timestamps->size();
+        }
+
+        /**
+         * @brief Determine whether the trace is empty
+         * @return true if the trace has no timestamp
+         */
+        bool empty() const {
+            return this->size() == 0;
+        }
+
+        /**
+         * @brief Access a timestamp by index
+         * @param index: an index (must be smaller than size())
+         * @return a pointer to the timestamp
+         */
+        SimulationTimestamp<T> *operator[](size_t index) const {
+            return &((*this->timestamps)[index]);
+        }
+
+    private:
+        std::deque<SimulationTimestamp<T>> *timestamps;
+    };
+
     /***********************/
     /** \cond INTERNAL    */
     /***********************/
 
     /**
-     * @brief A template class to represent a trace of timestamps
+     * @brief A template class to represent a trace of timestamps. Timestamps are stored by value in
+     *        a chunked arena (so that adding a timestamp does not require a separate allocation for its
+     *        SimulationTimestamp<T> wrapper, and that pointers to stored timestamps remain valid)
      *
      * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
      */
@@ -52,11 +192,11 @@ namespace wrench {
         /**
          * @brief Append a timestamp to the trace
          *
-         * @param timestamp: a pointer to a SimulationTimestamp<T> object
+         * @param content: a pointer to a SimulationTimestampXXXX object, which is then owned by the trace
          * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
          */
-        void addTimestamp(SimulationTimestamp<T> *timestamp) {
-          this->trace.push_back(timestamp);
+        void addTimestamp(T *content) {
+          this->trace.emplace_back(content);
         }
 
 
@@ -67,21 +207,26 @@ namespace wrench {
          * @return a vector of pointers to SimulationTimestamp<T> objects
          */
         std::vector<SimulationTimestamp<T> *> getTrace() {
-          return this->trace;
+          std::vector<SimulationTimestamp<T> *> timestamps;
+          timestamps.reserve(this->trace.size());
+          for (auto &timestamp : this->trace) {
+            timestamps.push_back(&timestamp);
+          }
+          return timestamps;
         }
 
         /**
-         * @brief Destructor
+         * @brief Retrieve the underlying timestamp storage (without copying it)
+         *
+         * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+         * @return the timestamps
          */
-        ~SimulationTrace<T>() {
-          for (auto &timestamp : this->trace) {
-            delete timestamp;
-          }
+        std::deque<SimulationTimestamp<T>> &getTimestamps() {
+          return this->trace;
         }
 
-
     private:
-        std::vector<SimulationTimestamp<T> *> trace;
+        std::deque<SimulationTimestamp<T>> trace;
     };
 
 
@@ -94,35 +239,31 @@ namespace wrench {
 
         /**
          * @brief Append a SimulationTimestampPstateSet timestamp to the trace
-         * @param new_timestamp: pointer to the timestamp
+         * @param content: pointer to the timestamp content, which is then owned by the trace
          */
-        void addTimestamp(SimulationTimestamp<SimulationTimestampPstateSet> *new_timestamp) {
-            auto hostname = new_timestamp->getContent()->getHostname();
+        void addTimestamp(SimulationTimestampPstateSet *content) {
+            auto hostname = content->getHostname();
 
             auto hostname_search = latest_timestamps_by_host.find(hostname);
             if (hostname_search == latest_timestamps_by_host.end()) {
                 // no pstate timestamps associated to this hostname have been added yet
-                this->trace.push_back(new_timestamp);
+                this->trace.emplace_back(content);
                 this->latest_timestamps_by_host[hostname] = this->trace.size() - 1;
             } else {
                 // a pstate timestamp associated to this host already exists
-                SimulationTimestamp<SimulationTimestampPstateSet> *& latest_timestamp = this->trace[this->latest_timestamps_by_host[hostname]];
-
-                // if the new_timestamp has the same date as the latest_timestamp, then the new_timestamp replaces
-                // the latest_timestamp in the trace, else the new time_stamp is added to the trace and the map of latest
-                // timestamps is updated to reflect this change
-                if (std::fabs(new_timestamp->getDate() - latest_timestamp->getDate()) < DBL_EPSILON) {
-                    std::swap(new_timestamp, latest_timestamp);
-
-                    // now, latest_timestamp points to the contents of new_timestamp
-                    // and new_timestamp points to the contents of latest_timestamp so
-                    // we need to delete new_timestamp
-                    delete new_timestamp;
+                SimulationTimestamp<SimulationTimestampPstateSet> &latest_timestamp = this->trace[hostname_search->second];
+
+                // if the new timestamp has the same date as the latest_timestamp, then the new timestamp replaces
+                // the latest_timestamp in the trace (which deletes the replaced content), else the new time_stamp
+                // is added to the trace and the map of latest timestamps is updated to reflect this change
+                if (std::fabs(content->getDate() - latest_timestamp.getDate()) < DBL_EPSILON) {
+                    latest_timestamp = SimulationTimestamp<SimulationTimestampPstateSet>(content);
                 } else {
-                    if (new_timestamp->getDate() > latest_timestamp->getDate()) {
-                        this->trace.push_back(new_timestamp);
+                    if (content->getDate() > latest_timestamp.getDate()) {
+                        this->trace.emplace_back(content);
                         this->latest_timestamps_by_host[hostname] = this->trace.size() - 1;
                     } else {
+                        delete content;
                         throw std::runtime_error(
                                 "SimulationTrace<SimulationTimestampPstateSet>::addTimestamp() timestamps out of order");
                     }
@@ -135,21 +276,25 @@ namespace wrench {
          * @return a vector of pointers to SimulationTimestamp<SimulationTimestampPstateSet> objects
          */
         std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *> getTrace() {
-            return this->trace;
+            std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *> timestamps;
+            timestamps.reserve(this->trace.size());
+            for (auto &timestamp : this->trace) {
+                timestamps.push_back(&timestamp);
+            }
+            return timestamps;
         }
 
         /**
-         * @brief Destructor
+         * @brief Retrieve the underlying timestamp storage (without copying it)
+         * @return the timestamps
          */
-        ~SimulationTrace<SimulationTimestampPstateSet>() {
-            for (auto &timestamp: this->trace) {
-                delete timestamp;
-            }
+        std::deque<SimulationTimestamp<SimulationTimestampPstateSet>> &getTimestamps() {
+            return this->trace;
         }
 
     private:
         std::map<std::string, size_t> latest_timestamps_by_host;
-        std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *> trace;
+        std::deque<SimulationTimestamp<SimulationTimestampPstateSet>> trace;
     };
 
     /***********************/
@@ -0,0 +1,181 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_SIMULATIONTRACEFILE_H
+#define WRENCH_SIMULATIONTRACEFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace wrench {
+
+    /**
+     * @brief A read-only, memory-mapped view of a binary simulation trace file, as written
+     *        by SimulationOutput::dumpBinaryTrace().
+     *
+     *        The file stores one event per simulation timestamp, in a columnar layout (one
+     *        contiguous array per field), so that analysis tools can access the trace without
+     *        parsing or copying it:
+     *          - a 64-byte header (see below)
+     *          - dates: double[num_events]
+     *          - values: double[num_events] (bytes for disk operations, pstate for pstate changes,
+     *            joules for energy consumption, bytes per second for link usage, 0 otherwise)
+     *          - endpoints: int64_t[num_events] (index of the associated start/end event, or -1)
+     *          - subjects: uint32_t[num_events] (index in the string table of the task ID for task
+     *            events, of the file ID for file events, of the hostname for disk/pstate/energy
+     *            events, of the link name for link usage events)
+     *          - kinds: uint8_t[num_events] (a SimulationTraceFile::Kind value)
+     *          - string table offsets: uint64_t[num_strings + 1]
+     *          - string table characters: char[string_bytes]
+     *        Each array starts at an 8-byte aligned offset. Events are grouped by kind, and are
+     *        in insertion order within a kind. All numbers are in the host's byte order.
+     */
+    class SimulationTraceFile {
+
+    public:
+
+        /** @brief The kind of a trace event, i.e., the type of the simulation timestamp it represents */
+        enum Kind : uint8_t {
+            /** @brief A SimulationTimestampTaskStart */
+            TASK_START,
+            /** @brief A SimulationTimestampTaskFailure */
+            TASK_FAILURE,
+            /** @brief A SimulationTimestampTaskCompletion */
+            TASK_COMPLETION,
+            /** @brief A SimulationTimestampTaskTermination */
+            TASK_TERMINATION,
+            /** @brief A SimulationTimestampFileReadStart */
+            FILE_READ_START,
+            /** @brief A SimulationTimestampFileReadFailure */
+            FILE_READ_FAILURE,
+            /** @brief A SimulationTimestampFileReadCompletion */
+            FILE_READ_COMPLETION,
+            /** @brief A SimulationTimestampFileWriteStart */
+            FILE_WRITE_START,
+            /** @brief A SimulationTimestampFileWriteFailure */
+            FILE_WRITE_FAILURE,
+            /** @brief A SimulationTimestampFileWriteCompletion */
+            FILE_WRITE_COMPLETION,
+            /** @brief A SimulationTimestampFileCopyStart */
+            FILE_COPY_START,
+            /** @brief A SimulationTimestampFileCopyFailure */
+            FILE_COPY_FAILURE,
+            /** @brief A SimulationTimestampFileCopyCompletion */
+            FILE_COPY_COMPLETION,
+            /** @brief A SimulationTimestampDiskReadStart */
+            DISK_READ_START,
+            /** @brief A SimulationTimestampDiskReadFailure */
+            DISK_READ_FAILURE,
+            /** @brief A SimulationTimestampDiskReadCompletion */
+            DISK_READ_COMPLETION,
+            /** @brief A SimulationTimestampDiskWriteStart */
+            DISK_WRITE_START,
+            /** @brief A SimulationTimestampDiskWriteFailure */
+            DISK_WRITE_FAILURE,
+            /** @brief A SimulationTimestampDiskWriteCompletion */
+            DISK_WRITE_COMPLETION,
+            /** @brief A SimulationTimestampPstateSet */
+            PSTATE_SET,
+            /** @brief A SimulationTimestampEnergyConsumption */
+            ENERGY_CONSUMPTION,
+            /** @brief A SimulationTimestampLinkUsage */
+            LINK_USAGE
+        };
+
+        explicit SimulationTraceFile(const std::string &file_path);
+
+        ~SimulationTraceFile();
+
+        SimulationTraceFile(const SimulationTraceFile &) = delete;
+
+        SimulationTraceFile &operator=(const SimulationTraceFile &) = delete;
+
+        size_t getNumEvents() const;
+
+        const double *getDates() const;
+
+        const double *getValues() const;
+
+        const int64_t *getEndpoints() const;
+
+        const uint32_t *getSubjects() const;
+
+        const Kind *getKinds() const;
+
+        size_t getNumStrings() const;
+
+        std::string getString(uint32_t index) const;
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        /** @brief The file's magic number */
+        static constexpr char MAGIC[8] = {'W', 'R', 'E', 'N', 'C', 'H', 'T', 'R'};
+
+        /** @brief The file format version */
+        static constexpr uint32_t VERSION = 1;
+
+        /** @brief The file header */
+        struct Header {
+            /** @brief The magic number */
+            char magic[8];
+            /** @brief The file format version */
+            uint32_t version;
+            /** @brief Unused */
+            uint32_t reserved;
+            /** @brief The number of events */
+            uint64_t num_events;
+            /** @brief The number of strings in the string table */
+            uint64_t num_strings;
+            /** @brief The number of characters in the string table */
+            uint64_t string_bytes;
+            /** @brief Unused (pads the header to 64 bytes) */
+            uint64_t padding[3];
+        };
+
+        /** @brief The offsets of each section of a trace file */
+        struct Layout {
+            /** @brief Offset of the dates array */
+            size_t dates;
+            /** @brief Offset of the values array */
+            size_t values;
+            /** @brief Offset of the endpoints array */
+            size_t endpoints;
+            /** @brief Offset of the subjects array */
+            size_t subjects;
+            /** @brief Offset of the kinds array */
+            size_t kinds;
+            /** @brief Offset of the string table offsets array */
+            size_t string_offsets;
+            /** @brief Offset of the string table characters */
+            size_t strings;
+            /** @brief Total size of the file */
+            size_t size;
+        };
+
+        static Layout computeLayout(uint64_t num_events, uint64_t num_strings, uint64_t string_bytes);
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+    private:
+        int fd = -1;
+        void *mapping = nullptr;
+        size_t mapping_size = 0;
+
+        const Header *header = nullptr;
+        Layout layout;
+    };
+
+};
+
+#endif //WRENCH_SIMULATIONTRACEFILE_H
@@ -12,6 +12,7 @@
 
 #include <string>
 #include <wrench/workflow/WorkflowTask.h>
+#include <wrench/util/WorkloadTrace.h>
 
 namespace wrench {
 
@@ -22,17 +23,21 @@ namespace wrench {
 
     /**
      * @brief A class that can load a job submission trace (a.k.a. supercomputer workload) in the SWF format
-     *        (see http://www.cs.huji.ac.il/labs/parallel/workload/swf.html)
-     *        and store it as a vector of simulation-relevant fields
+     *        (see http://www.cs.huji.ac.il/labs/parallel/workload/swf.html) or in the Batsim JSON format,
+     *        and store it as a columnar WorkloadTrace (or as a vector of simulation-relevant fields)
      */
     class TraceFileLoader {
     public:
         static std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>>
            loadFromTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
+
+        static std::shared_ptr<WorkloadTrace>
+           loadWorkloadTrace(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
+
     private:
-        static std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>>
+        static std::shared_ptr<WorkloadTrace>
         loadFromTraceFileSWF(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
-        static std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>>
+        static std::shared_ptr<WorkloadTrace>
         loadFromTraceFileJSON(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job);
     };
 
@@ -0,0 +1,135 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_WORKLOADTRACE_H
+#define WRENCH_WORKLOADTRACE_H
+
+#include <iterator>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A job in a workload trace
+     */
+    struct WorkloadTraceJob {
+        /** @brief The job's id in the trace file (only JSON traces provide job ids, and it is empty otherwise) */
+        std::string job_id;
+        /** @brief The username of the submitter */
+        std::string username;
+        /** @brief The submission time (in seconds) */
+        double submit_time;
+        /** @brief The actual run time (in seconds) */
+        double time;
+        /** @brief The requested run time (in seconds) */
+        double requested_time;
+        /** @brief The requested RAM (in bytes) */
+        double requested_ram;
+        /** @brief The requested number of nodes */
+        unsigned int num_nodes;
+    };
+
+    /**
+     * @brief A job submission trace (as loaded by a TraceFileLoader) stored in columnar form, i.e.,
+     *        one array per job field and usernames interned as indices in a table of distinct usernames,
+     *        and from which jobs are pulled one at a time through an iterator
+     */
+    class WorkloadTrace {
+
+    public:
+
+        /**
+         * @brief An iterator that goes through the jobs of a trace in order
+         */
+        class Iterator : public std::iterator<std::forward_iterator_tag, WorkloadTraceJob> {
+        public:
+            /**
+             * @brief Constructor
+             * @param trace: the trace
+             * @param index: the index of the job
+             */
+            Iterator(const WorkloadTrace *trace, size_t index) : trace(trace), index(index) {}
+
+            /** @brief Get the job at the current position
+             *  @return a job
+             */
+            WorkloadTraceJob operator*() const { return this->trace->getJob(this->index); }
+
+            /** @brief Move to the next job
+             *  @return the iterator
+             */
+            Iterator &operator++() {
+                this->index++;
+                return *this;
+            }
+
+            /** @brief Compare two iterators
+             *  @param other: the other iterator
+             *  @return true if equal
+             */
+            bool operator==(const Iterator &other) const { return (this->index == other.index); }
+
+            /** @brief Compare two iterators
+             *  @param other: the other iterator
+             *  @return true if different
+             */
+            bool operator!=(const Iterator &other) const { return (this->index != other.index); }
+
+        private:
+            const WorkloadTrace *trace;
+            size_t index;
+        };
+
+        size_t size() const;
+        bool empty() const;
+        WorkloadTraceJob getJob(size_t index) const;
+        Iterator begin() const;
+        Iterator end() const;
+
+        void capNumNodes(unsigned int max_num_nodes);
+        void capRequestedRam(double max_ram);
+
+    private:
+
+        friend class TraceFileLoader;
+
+        unsigned int internUsername(const std::string &username);
+        void addJob(unsigned int user_id, double submit_time, double time, double requested_time,
+                    double requested_ram, unsigned int num_nodes);
+        void addJob(unsigned long job_id, unsigned int user_id, double submit_time, double time,
+                    double requested_time, double requested_ram, unsigned int num_nodes);
+        void reserve(size_t num_jobs);
+
+        /** @brief The job ids (empty if the trace file does not provide them) */
+        std::vector<unsigned long> job_ids;
+        std::vector<unsigned int> user_ids;
+        std::vector<double> submit_times;
+        std::vector<double> times;
+        std::vector<double> requested_times;
+        std::vector<double> requested_rams;
+        std::vector<unsigned int> num_nodes;
+
+        /** @brief The distinct usernames, indexed by user id */
+        std::vector<std::string> usernames;
+        std::unordered_map<std::string, unsigned int> username_to_user_id;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+}
+
+#endif //WRENCH_WORKLOADTRACE_H
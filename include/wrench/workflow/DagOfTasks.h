@@ -10,34 +10,69 @@
 #ifndef WRENCH_DAGOFTASKS_H
 #define WRENCH_DAGOFTASKS_H
 
-#include <boost/graph/adjacency_list.hpp>
-#include <boost/graph/breadth_first_search.hpp>
 #include <iostream>
+#include <vector>
+#include <unordered_map>
 
 #include <wrench/workflow/WorkflowTask.h>
 
 namespace wrench {
 
-/***********************/
-/** \cond INTERNAL     */
-/***********************/
-
     class WorkflowTask;
 
     /**
-     * @brief Data structure to store vertex properties
+     * @brief A lightweight, read-only view over a contiguous sequence of tasks (e.g., the children
+     *        or the parents of a task), which does not copy the sequence. A view is only valid until
+     *        the workflow's structure (tasks or dependencies) is next modified.
      */
-    struct VertexProperties {
-//    std::size_t index;
-//    boost::default_color_type color;
-        /** @brief Task attached to the vertex */
-        const WorkflowTask *task;
+    class WorkflowTaskView {
+
+    public:
+        /** @brief Iterator type */
+        typedef WorkflowTask *const *const_iterator;
+
+        /***********************/
+        /** \cond INTERNAL     */
+        /***********************/
+
+        /**
+         * @brief Constructor
+         * @param first: a pointer to the first task of the sequence
+         * @param size: the number of tasks in the sequence
+         */
+        WorkflowTaskView(WorkflowTask *const *first, size_t size) : first(first), count(size) {}
+
+        /***********************/
+        /** \endcond           */
+        /***********************/
+
+        /** @brief Get an iterator to the first task @return an iterator */
+        const_iterator begin() const { return this->first; }
+        /** @brief Get an iterator past the last task @return an iterator */
+        const_iterator end() const { return this->first + this->count; }
+        /** @brief Get the number of tasks @return a number of tasks */
+        size_t size() const { return this->count; }
+        /** @brief Determine whether the view is empty @return true if there is no task */
+        bool empty() const { return this->count == 0; }
+        /** @brief Access a task by index @param index: an index (must be smaller than size()) @return a task */
+        WorkflowTask *operator[](size_t index) const { return this->first[index]; }
+
+        /**
+         * @brief Copy the tasks into a vector
+         * @return a vector of tasks
+         */
+        operator std::vector<WorkflowTask *>() const {
+            return std::vector<WorkflowTask *>(this->begin(), this->end());
+        }
+
+    private:
+        WorkflowTask *const *first;
+        size_t count;
     };
 
-    /**
-     * @brief Convenient DAG typedef
-     */
-    typedef boost::adjacency_list<boost::listS, boost::vecS, boost::bidirectionalS, VertexProperties> DAG;
+/***********************/
+/** \cond INTERNAL     */
+/***********************/
 
     /**
      * @brief Convenient vertext_t typedef
@@ -45,7 +80,10 @@ namespace wrench {
     typedef unsigned long vertex_t;  // To clean up some day...
 
     /**
-     * @brief An internal class that uses the Boost Graph Library to implement a DAG of WorkflowTask objects
+     * @brief An internal class to implement a DAG of WorkflowTask objects. Each task stores its (dense)
+     *        vertex index. Edges are stored in per-vertex adjacency vectors while the DAG is being
+     *        built/modified, and in a compact CSR (compressed sparse row) representation once the DAG
+     *        has been frozen (freezing is undone by the next modification)
      */
     class DagOfTasks {
 
@@ -66,36 +104,55 @@ namespace wrench {
 
         std::vector<WorkflowTask *> getChildren(const WorkflowTask *task);
 
+        WorkflowTaskView getChildrenView(const WorkflowTask *task);
+
         long getNumberOfParents(const WorkflowTask *task);
 
         std::vector<WorkflowTask *> getParents(const WorkflowTask *task);
 
+        WorkflowTaskView getParentsView(const WorkflowTask *task);
+
+        std::vector<WorkflowTask *> getTopologicalOrder();
+
+        void removeRedundantEdges(const std::vector<std::pair<WorkflowTask *, WorkflowTask *>> &edges);
+
+        void freeze();
+
     private:
 
-        /**
-         * @brief Nested class that's used for the BFS algorithm in the BGL
-         */
-        class custom_bfs_visitor : public boost::default_bfs_visitor {
-        public:
+        vertex_t getVertex(const WorkflowTask *task, const std::string &error_message);
+
+        WorkflowTaskView childrenOf(vertex_t vertex);
+
+        WorkflowTaskView parentsOf(vertex_t vertex);
+
+        void thaw();
+
+        bool searchPath(vertex_t src_vertex, vertex_t dst_vertex, bool skip_direct_edge,
+                        const std::vector<unsigned long> *topological_positions);
 
-            const WorkflowTask *target_task;
+        std::vector<vertex_t> getTopologicalVertexOrder();
 
-            explicit custom_bfs_visitor(const WorkflowTask *target_task) : boost::default_bfs_visitor() {
-                this->target_task = target_task;
-            }
+        // Tasks, indexed by vertex
+        std::vector<WorkflowTask *> tasks;
 
-            template<typename Vertex, typename Graph>
-            void discover_vertex(Vertex u,  Graph &g) {
-                if (g[u].task == target_task) {
-                    throw std::runtime_error("path found");
-                }
-            }
-        };
+        // Adjacency vectors (when not frozen)
+        std::vector<std::vector<WorkflowTask *>> children;
+        std::vector<std::vector<WorkflowTask *>> parents;
 
-        std::vector<const WorkflowTask*> task_list;
-        std::unordered_map<const WorkflowTask *, unsigned long> task_map;
+        // CSR adjacency (when frozen): the children of vertex v are
+        // children_csr[children_offsets[v]] to children_csr[children_offsets[v + 1] - 1]
+        bool frozen = false;
+        std::vector<size_t> children_offsets;
+        std::vector<WorkflowTask *> children_csr;
+        std::vector<size_t> parents_offsets;
+        std::vector<WorkflowTask *> parents_csr;
 
-        DAG dag;
+        // Scratch state reused across path searches, so that searches do not allocate:
+        // a vertex has been visited by the current search iff its mark equals the current generation
+        std::vector<unsigned long> search_marks;
+        unsigned long search_generation = 0;
+        std::vector<vertex_t> search_stack;
 
     };
 
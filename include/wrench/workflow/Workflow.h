@@ -56,6 +56,9 @@ namespace wrench {
         void addControlDependency(WorkflowTask *src, WorkflowTask *dest, bool redundant_dependencies = false);
         void removeControlDependency(WorkflowTask *src, WorkflowTask *dest);
 
+        void beginBulkConstruction();
+        void endBulkConstruction();
+
         unsigned long getNumberOfTasks();
 
         unsigned long getNumLevels();
@@ -79,8 +82,10 @@ namespace wrench {
         std::vector<WorkflowTask *> getExitTasks() const;
 
         std::vector<WorkflowTask *> getTaskParents(const WorkflowTask *task);
+        WorkflowTaskView getTaskParentsView(const WorkflowTask *task);
         long getTaskNumberOfParents(const  WorkflowTask *task);
         std::vector<WorkflowTask *> getTaskChildren(const WorkflowTask *task);
+        WorkflowTaskView getTaskChildrenView(const WorkflowTask *task);
         long getTaskNumberOfChildren(const WorkflowTask *task);
 
         bool pathExists(const WorkflowTask *src, const WorkflowTask *dst);
@@ -131,6 +136,20 @@ namespace wrench {
         std::map<std::string, std::unique_ptr<WorkflowTask>> tasks;
         std::map<std::string, std::unique_ptr<WorkflowFile>> files;
 
+        std::map<std::string, WorkflowTask *> ready_tasks; // tasks in the READY visible state, indexed by ID
+        std::map<std::string, std::map<std::string, WorkflowTask *>> clustered_tasks; // tasks with a cluster ID, indexed by cluster ID and ID
+        unsigned long num_completed_tasks = 0; // number of tasks in the COMPLETED visible state
+
+        bool toplevels_are_up_to_date = true; // whether task top-levels are up to date (see updateTopLevels())
+        void updateTopLevels();
+
+        bool bulk_construction = false; // whether the workflow is in bulk construction mode
+        std::vector<std::pair<WorkflowTask *, WorkflowTask *>> bulk_prunable_dependencies; // dependencies to prune if redundant
+
+        void updateTaskState(WorkflowTask *task, WorkflowTask::State previous_state);
+        void updateTaskClusterID(WorkflowTask *task, const std::string &previous_cluster_id);
+        static void addToReadyClusters(std::map<std::string, std::vector<WorkflowTask *>> &task_map, WorkflowTask *task);
+
 
         std::string callback_mailbox;
         ComputeService *parent_compute_service; // The compute service to which the job was submitted, if any
@@ -276,6 +276,7 @@ namespace wrench {
         InternalState internal_state;      // Not to be exposed to developer level
 
         Workflow *workflow;                // Containing workflow
+        unsigned long dag_index = -1;      // Index of the task's vertex in the workflow's DAG
 
         std::map<std::string, WorkflowFile *> output_files;   // List of output files
         std::map<std::string, WorkflowFile *> input_files;    // List of input files
@@ -18,6 +18,7 @@
 #include "wrench/simulation/SimulationMessage.h"
 #include "wrench/services/storage/StorageService.h"
 #include "wrench/simgrid_S4U_util/S4U_Simulation.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 #include "wrench/exceptions/WorkflowExecutionException.h"
 #include "wrench/workflow/job/PilotJob.h"
 #include "StandardJobExecutorMessage.h"
@@ -185,6 +186,20 @@ namespace wrench {
         this->setProperties(this->default_property_values, property_list);
         this->setMessagePayloads(this->default_messagepayload_values, messagepayload_list);
 
+        // Resolve algorithm properties once and for all
+        this->core_allocation_algorithm = this->getPropertyValueAsEnum<CoreAllocationAlgorithm>(
+                StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM,
+                {{"maximum", CoreAllocationAlgorithm::MAXIMUM},
+                 {"minimum", CoreAllocationAlgorithm::MINIMUM}});
+        this->task_selection_algorithm = this->getPropertyValueAsEnum<TaskSelectionAlgorithm>(
+                StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM,
+                {{"maximum_flops",         TaskSelectionAlgorithm::MAXIMUM_FLOPS},
+                 {"maximum_minimum_cores", TaskSelectionAlgorithm::MAXIMUM_MINIMUM_CORES},
+                 {"minimum_top_level",     TaskSelectionAlgorithm::MINIMUM_TOP_LEVEL}});
+        this->host_selection_algorithm = this->getPropertyValueAsEnum<HostSelectionAlgorithm>(
+                StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM,
+                {{"best_fit", HostSelectionAlgorithm::BEST_FIT}});
+
         // Compute the total number of cores and set initial core availabilities
         this->total_num_cores = 0;
         for (auto host : compute_resources) {
@@ -373,18 +388,10 @@ namespace wrench {
             desired_num_cores = 1;
 
         } else {
-            std::string core_allocation_algorithm =
-                    this->getPropertyValueAsString(StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM);
-
-            if (core_allocation_algorithm == "maximum") {
+            if (this->core_allocation_algorithm == CoreAllocationAlgorithm::MAXIMUM) {
                 desired_num_cores = wu->task->getMaxNumCores();
-            } else if (core_allocation_algorithm == "minimum") {
-                desired_num_cores = wu->task->getMinNumCores();
             } else {
-                throw std::runtime_error(
-                        "StandardjobExecutor::computeWorkUnitDesiredNumCores(): Unknown "
-                        "StandardJobExecutorProperty::CORE_ALLOCATION_ALGORITHM property '"
-                        + core_allocation_algorithm + "'");
+                desired_num_cores = wu->task->getMinNumCores();
             }
         }
 
@@ -456,12 +463,7 @@ namespace wrench {
                     "Looking for a host to run a work unit that needs at least %ld cores, and would like %ld cores, "
                     "and requires %.2ef bytes of RAM",
                     minimum_num_cores, desired_num_cores, required_ram);
-            std::string host_selection_algorithm =
-                    this->getPropertyValueAsString(StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM);
-
-//        std::cerr << "** FINDING A HOST USING " << host_selection_algorithm << "\n";
-
-            if (host_selection_algorithm == "best_fit") {
+            if (this->host_selection_algorithm == HostSelectionAlgorithm::BEST_FIT) {
                 unsigned long target_slack = 0;
 
                 for (auto const &h : this->core_availabilities) {
@@ -506,10 +508,6 @@ namespace wrench {
                         target_slack = tentative_target_slack;
                     }
                 }
-            } else {
-                this->releaseDaemonLock();
-                throw std::runtime_error("Unknown StandardJobExecutorProperty::HOST_SELECTION_ALGORITHM property '"
-                                         + host_selection_algorithm + "'");
             }
 
             if (target_host.empty()) { // didn't find a suitable host
@@ -535,7 +533,9 @@ namespace wrench {
                                          this->getPropertyValueAsDouble(
                                                  StandardJobExecutorProperty::TASK_STARTUP_OVERHEAD),
                                          this->getPropertyValueAsBoolean(
-                                                 StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SLEEP)
+                                                 StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SLEEP),
+                                         this->getPropertyValueAsBoolean(
+                                                 StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY)
                     ));
 
             workunit_executor->simulation = this->simulation;
@@ -608,30 +608,46 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<HostHasTurnedOnMessage *>(message.get())) {
-            // Do nothing, just wake up
-            return true;
-        } else if (auto msg = dynamic_cast<HostHasChangedSpeedMessage *>(message.get())) {
-            // Do nothing, just wake up
-            return true;
-        } else if (auto msg = dynamic_cast<WorkunitExecutorDoneMessage *>(message.get())) {
-            processWorkunitExecutorCompletion(msg->workunit_executor, msg->workunit);
-            return true;
-        } else if (auto msg = dynamic_cast<WorkunitExecutorFailedMessage *>(message.get())) {
-            processWorkunitExecutorFailure(msg->workunit_executor, msg->workunit, msg->cause);
-            return false; // We should exit since we've killed everything
-
-        } else if (auto msg = dynamic_cast<ServiceHasCrashedMessage *>(message.get())) {
-            auto service = msg->service;
-            auto workunit_executor = std::dynamic_pointer_cast<WorkunitExecutor>(service);
-            if (not workunit_executor) {
-                throw std::runtime_error(
-                        "Received a FailureDetectorServiceHasFailedMessage message, but that service is not a WorkUnitExecutor!");
+        typedef SimulationMessageTypeSwitch<HostHasTurnedOnMessage,
+                HostHasChangedSpeedMessage,
+                WorkunitExecutorDoneMessage,
+                WorkunitExecutorFailedMessage,
+                ServiceHasCrashedMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<HostHasTurnedOnMessage>(): {
+                // Do nothing, just wake up
+                return true;
+            }
+            case MessageTypes::indexOf<HostHasChangedSpeedMessage>(): {
+                // Do nothing, just wake up
+                return true;
+            }
+            case MessageTypes::indexOf<WorkunitExecutorDoneMessage>(): {
+                auto msg = static_cast<WorkunitExecutorDoneMessage *>(message.get());
+                processWorkunitExecutorCompletion(msg->workunit_executor, msg->workunit);
+                return true;
+            }
+            case MessageTypes::indexOf<WorkunitExecutorFailedMessage>(): {
+                auto msg = static_cast<WorkunitExecutorFailedMessage *>(message.get());
+                processWorkunitExecutorFailure(msg->workunit_executor, msg->workunit, msg->cause);
+                return false; // We should exit since we've killed everything
+            }
+            case MessageTypes::indexOf<ServiceHasCrashedMessage>(): {
+                auto msg = static_cast<ServiceHasCrashedMessage *>(message.get());
+                auto service = msg->service;
+                auto workunit_executor = std::dynamic_pointer_cast<WorkunitExecutor>(service);
+                if (not workunit_executor) {
+                    throw std::runtime_error(
+                            "Received a FailureDetectorServiceHasFailedMessage message, but that service is not a WorkUnitExecutor!");
+                }
+                processWorkunitExecutorCrash(workunit_executor);
+                return true;
+            }
+            default: {
+                throw std::runtime_error("Unexpected [" + message->getName() + "] message");
             }
-            processWorkunitExecutorCrash(workunit_executor);
-            return true;
-        } else {
-            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
         }
     }
 
@@ -888,8 +904,7 @@ namespace wrench {
 
 //      std::cerr << "SORTED LENGTH = " << sorted_workunits.size() << "\n";
 
-        std::string selection_algorithm =
-                this->getPropertyValueAsString(StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM);
+        auto selection_algorithm = this->task_selection_algorithm;
 
 //      std::cerr << "SELECT ALG = " << selection_algorithm << "\n";
 
@@ -911,27 +926,23 @@ namespace wrench {
                           return false;
                       }
 
-                      if (selection_algorithm == "maximum_flops") {
+                      if (selection_algorithm == TaskSelectionAlgorithm::MAXIMUM_FLOPS) {
                           if (wu1->task->getFlops() == wu2->task->getFlops()) {
                               return (wu1->task->getID() > wu2->task->getID());
                           }
                           return (wu1->task->getFlops() > wu2->task->getFlops());
 
-                      } else if (selection_algorithm == "maximum_minimum_cores") {
+                      } else if (selection_algorithm == TaskSelectionAlgorithm::MAXIMUM_MINIMUM_CORES) {
                           if (wu1->task->getMinNumCores() == wu2->task->getMinNumCores()) {
                               return (wu1->task->getID() > wu2->task->getID());
                           }
                           return (wu1->task->getMinNumCores() > wu2->task->getMinNumCores());
 
-                      } else if (selection_algorithm == "minimum_top_level") {
+                      } else {
                           if (wu1->task->getTopLevel() == wu2->task->getTopLevel()) {
                               return (wu1->task->getID() > wu2->task->getID());
                           }
                           return (wu1->task->getTopLevel() < wu2->task->getTopLevel());
-                      } else {
-                          throw std::runtime_error(
-                                  "Unknown StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM property '"
-                                  + selection_algorithm + "'");
                       }
                   });
 
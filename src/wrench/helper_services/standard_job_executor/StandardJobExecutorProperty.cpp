@@ -20,4 +20,5 @@ namespace wrench {
     SET_PROPERTY_NAME(StandardJobExecutorProperty, HOST_SELECTION_ALGORITHM);
 
     SET_PROPERTY_NAME(StandardJobExecutorProperty, SIMULATE_COMPUTATION_AS_SLEEP);
+    SET_PROPERTY_NAME(StandardJobExecutorProperty, SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY);
 };
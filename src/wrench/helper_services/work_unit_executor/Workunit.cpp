@@ -203,7 +203,7 @@ namespace wrench {
             WorkflowTask *task = task_work_unit->task;
 
             if (task->getInternalState() != WorkflowTask::InternalState::TASK_READY) {
-                std::vector<WorkflowTask *> current_task_parents = task->getWorkflow()->getTaskParents(task);
+                auto current_task_parents = task->getWorkflow()->getTaskParentsView(task);
 
                 for (auto const &potential_parent_task_work_unit : task_work_units) {
                     if (std::find(current_task_parents.begin(), current_task_parents.end(),
@@ -54,6 +54,8 @@ namespace wrench {
      * @param job: the SandardJob the workunit corresponds to
      * @param thread_startup_overhead: the thread_startup overhead, in seconds
      * @param simulate_computation_as_sleep: simulate computation as a sleep instead of an actual compute thread (for simulation scalability reasons)
+     * @param simulate_computation_as_single_activity: simulate a multicore computation as a single multi-threaded
+     *        activity instead of with one compute thread per core (for simulation scalability reasons)
      */
     WorkunitExecutor::WorkunitExecutor(
             std::string hostname,
@@ -64,7 +66,8 @@ namespace wrench {
             std::shared_ptr <StorageService> scratch_space,
             std::shared_ptr <StandardJob> job,
             double thread_startup_overhead,
-            bool simulate_computation_as_sleep) :
+            bool simulate_computation_as_sleep,
+            bool simulate_computation_as_single_activity) :
             Service(hostname, "workunit_executor", "workunit_executor") {
         if (num_cores < 1) {
             throw std::invalid_argument("WorkunitExecutor::WorkunitExecutor(): num_cores must be >= 1");
@@ -83,6 +86,7 @@ namespace wrench {
         this->workunit = workunit;
         this->thread_startup_overhead = thread_startup_overhead;
         this->simulate_computation_as_sleep = simulate_computation_as_sleep;
+        this->simulate_computation_as_single_activity = simulate_computation_as_single_activity;
         this->num_cores = num_cores;
         this->ram_utilization = ram_utilization;
         this->scratch_space = scratch_space;
@@ -522,9 +526,9 @@ namespace wrench {
             task->setEndDate(S4U_Simulation::getClock());
 
             // Deal with Children
-            for (auto child : task->getWorkflow()->getTaskChildren(task)) {
+            for (auto child : task->getWorkflow()->getTaskChildrenView(task)) {
                 bool all_parents_completed = true;
-                for (auto parent : child->getWorkflow()->getTaskParents(child)) {
+                for (auto parent : child->getWorkflow()->getTaskParentsView(child)) {
                     if (parent->getInternalState() != WorkflowTask::InternalState::TASK_COMPLETED) {
                         all_parents_completed = false;
                         break;
@@ -597,6 +601,21 @@ namespace wrench {
             double sleep_time = (max_work_per_thread) / Simulation::getFlopRate();
             Simulation::sleep(sleep_time);
 
+        } else if (this->simulate_computation_as_single_activity) {
+            /** Simulate computation as a multi-threaded activity **/
+            // Nobody kills me while I am "starting threads"
+            this->acquireDaemonLock();
+            try {
+                S4U_Simulation::sleep(this->num_cores * this->thread_startup_overhead);
+            } catch (std::exception &e) {
+                WRENCH_INFO("Got an exception while sleeping... perhaps I am being killed?");
+                this->releaseDaemonLock();
+                throw WorkflowExecutionException(std::shared_ptr<FailureCause>(new FatalFailure()));
+            }
+            this->releaseDaemonLock();  // People can kill me now
+
+            runMulticoreComputationAsSingleActivity(work_per_thread);
+
         } else {
             /** Simulate computation with actual compute threads **/
             // Nobody kills me while I am starting compute threads!
@@ -681,6 +700,32 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Simulate a multicore computation without compute threads. In the common case in which all
+     *        threads perform the same amount of work this is a single multi-threaded activity. Otherwise,
+     *        there is one activity per distinct amount of work (e.g., two for an Amdahl's law task), each
+     *        of which runs on the threads that still have work to do.
+     *
+     * @param work_per_thread: the amount of work (in flops) performed by each thread
+     */
+    void WorkunitExecutor::runMulticoreComputationAsSingleActivity(const std::vector<double> &work_per_thread) {
+        std::vector<double> sorted_work_per_thread = work_per_thread;
+        std::sort(sorted_work_per_thread.begin(), sorted_work_per_thread.end());
+
+        WRENCH_INFO("Running a %ld-thread computation", sorted_work_per_thread.size());
+
+        double work_done_per_thread = 0;
+        for (unsigned long i = 0; i < sorted_work_per_thread.size(); i++) {
+            if (sorted_work_per_thread[i] <= work_done_per_thread) {
+                continue;
+            }
+            // Threads i, i+1, ... all still have (at least) that much work to do
+            S4U_Simulation::computeMultiThreaded(sorted_work_per_thread.size() - i,
+                                                 sorted_work_per_thread[i] - work_done_per_thread);
+            work_done_per_thread = sorted_work_per_thread[i];
+        }
+    }
+
     /**
      * @brief Returns the number of cores the service has been allocated
      * @return a number of cores
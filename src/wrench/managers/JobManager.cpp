@@ -19,6 +19,7 @@
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simgrid_S4U_util/S4U_Simulation.h"
 #include "wrench/simulation/SimulationMessage.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 #include "wrench/workflow/WorkflowTask.h"
 #include "wrench/workflow/job/StandardJob.h"
 #include "wrench/workflow/job/PilotJob.h"
@@ -543,7 +544,7 @@ namespace wrench {
             for (auto task : sjob->tasks) {
                 if (task->getState() == WorkflowTask::State::NOT_READY) {
                     bool ready = true;
-                    for (auto parent : task->getWorkflow()->getTaskParents(task)) {
+                    for (auto parent : task->getWorkflow()->getTaskParentsView(task)) {
                         if (parent->getState() != WorkflowTask::State::COMPLETED) {
                             ready = false;
                         }
@@ -696,23 +697,41 @@ namespace wrench {
 
         WRENCH_INFO("Job Manager got a %s message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            // There shouldn't be any need to clean up any state
-            return false;
-        } else if (auto msg = dynamic_cast<ComputeServiceStandardJobDoneMessage *>(message.get())) {
-            processStandardJobCompletion(msg->job, msg->compute_service);
-            return true;
-        } else if (auto msg = dynamic_cast<ComputeServiceStandardJobFailedMessage *>(message.get())) {
-            processStandardJobFailure(msg->job, msg->compute_service, msg->cause);
-            return true;
-        } else if (auto msg = dynamic_cast<ComputeServicePilotJobStartedMessage *>(message.get())) {
-            processPilotJobStart(msg->job, msg->compute_service);
-            return true;
-        } else if (auto msg = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
-            processPilotJobExpiration(msg->job, msg->compute_service);
-            return true;
-        } else {
-            throw std::runtime_error("JobManager::main(): Unexpected [" + message->getName() + "] message");
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                ComputeServiceStandardJobDoneMessage,
+                ComputeServiceStandardJobFailedMessage,
+                ComputeServicePilotJobStartedMessage,
+                ComputeServicePilotJobExpiredMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                // There shouldn't be any need to clean up any state
+                return false;
+            }
+            case MessageTypes::indexOf<ComputeServiceStandardJobDoneMessage>(): {
+                auto msg = static_cast<ComputeServiceStandardJobDoneMessage *>(message.get());
+                processStandardJobCompletion(msg->job, msg->compute_service);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceStandardJobFailedMessage>(): {
+                auto msg = static_cast<ComputeServiceStandardJobFailedMessage *>(message.get());
+                processStandardJobFailure(msg->job, msg->compute_service, msg->cause);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServicePilotJobStartedMessage>(): {
+                auto msg = static_cast<ComputeServicePilotJobStartedMessage *>(message.get());
+                processPilotJobStart(msg->job, msg->compute_service);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServicePilotJobExpiredMessage>(): {
+                auto msg = static_cast<ComputeServicePilotJobExpiredMessage *>(message.get());
+                processPilotJobExpiration(msg->job, msg->compute_service);
+                return true;
+            }
+            default: {
+                throw std::runtime_error("JobManager::main(): Unexpected [" + message->getName() + "] message");
+            }
         }
     }
 
@@ -745,7 +764,7 @@ namespace wrench {
                                          task->getID() + " does not have a TASK_COMPLETED internal state (" +
                                          WorkflowTask::stateToString(task->getInternalState()) + ")");
             }
-            auto children = task->getWorkflow()->getTaskChildren(task);
+            auto children = task->getWorkflow()->getTaskChildrenView(task);
             for (auto child : children) {
                 switch (child->getInternalState()) {
                     case WorkflowTask::InternalState::TASK_NOT_READY:
@@ -765,7 +784,7 @@ namespace wrench {
                     case WorkflowTask::InternalState::TASK_READY:
                         if (child->getState() == WorkflowTask::State::NOT_READY) {
                             bool all_parents_visibly_completed = true;
-                            for (auto parent : child->getWorkflow()->getTaskParents(child)) {
+                            for (auto parent : child->getWorkflow()->getTaskParentsView(child)) {
                                 if (parent->getState() == WorkflowTask::State::COMPLETED) {
                                     continue; // COMPLETED FROM BEFORE
                                 }
@@ -844,7 +863,7 @@ namespace wrench {
                 } else {
                     necessary_state_changes[t] = WorkflowTask::State::COMPLETED;
                 }
-                for (auto child : this->wms->getWorkflow()->getTaskChildren(t)) {
+                for (auto child : this->wms->getWorkflow()->getTaskChildrenView(t)) {
                     switch (child->getInternalState()) {
                         case WorkflowTask::InternalState::TASK_NOT_READY:
                         case WorkflowTask::InternalState::TASK_RUNNING:
@@ -873,7 +892,7 @@ namespace wrench {
 
             } else if (t->getInternalState() == WorkflowTask::InternalState::TASK_FAILED) {
                 bool ready = true;
-                for (auto parent : this->wms->getWorkflow()->getTaskParents(t)) {
+                for (auto parent : this->wms->getWorkflow()->getTaskParentsView(t)) {
                     if ((parent->getInternalState() != WorkflowTask::InternalState::TASK_COMPLETED) and
                         (parent->getUpcomingState() != WorkflowTask::State::COMPLETED)) {
                         ready = false;
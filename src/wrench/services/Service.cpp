@@ -8,6 +8,9 @@
  */
 
 
+#include <cfloat>
+#include <climits>
+
 #include <wrench/simgrid_S4U_util/S4U_Mailbox.h>
 #include <wrench/simulation/SimulationMessage.h>
 #include "wrench/services/ServiceMessage.h"
@@ -99,11 +102,35 @@ namespace wrench {
       * @param value: the property value
       */
     void Service::setProperty(std::string property, std::string value) {
-        if (this->property_list.find(property) != this->property_list.end()) {
-            this->property_list[property] = value;
+        this->parsed_property_values[property] = Service::parsePropertyValue(value);
+        this->property_list[property] = std::move(value);
+    }
+
+    /**
+     * @brief Parse a property value into all types it can be converted to
+     * @param value: the property value
+     * @return the parsed property value
+     */
+    Service::ParsedPropertyValue Service::parsePropertyValue(const std::string &value) {
+        ParsedPropertyValue parsed_value;
+        parsed_value.string_value = value;
+
+        if (value == "infinity") {
+            parsed_value.is_double = true;
+            parsed_value.double_value = DBL_MAX;
+            parsed_value.is_unsigned_long = true;
+            parsed_value.unsigned_long_value = ULONG_MAX;
         } else {
-            this->property_list.insert(std::make_pair(property, value));
+            parsed_value.is_double = (sscanf(value.c_str(), "%lf", &parsed_value.double_value) == 1);
+            parsed_value.is_unsigned_long = (sscanf(value.c_str(), "%lu", &parsed_value.unsigned_long_value) == 1);
+        }
+
+        if ((value == "true") or (value == "false")) {
+            parsed_value.is_boolean = true;
+            parsed_value.boolean_value = (value == "true");
         }
+
+        return parsed_value;
     }
 
 
@@ -125,19 +152,31 @@ namespace wrench {
     }
 
     /**
-     * @brief Get a property of the Service as a string
+     * @brief Get the parsed value of a property of the Service
      * @param property: the property
-     * @return the property value as a string
+     * @return the parsed property value
      *
      * @throw std::invalid_argument
      */
-    std::string Service::getPropertyValueAsString(std::string property) {
-        if (this->property_list.find(property) == this->property_list.end()) {
+    const Service::ParsedPropertyValue &Service::getParsedPropertyValue(const std::string &property) {
+        auto parsed_value = this->parsed_property_values.find(property);
+        if (parsed_value == this->parsed_property_values.end()) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsString(): Cannot find value for property " + property +
                     " (perhaps a derived service class does not provide a default value?)");
         }
-        return this->property_list[property];
+        return parsed_value->second;
+    }
+
+    /**
+     * @brief Get a property of the Service as a string
+     * @param property: the property
+     * @return the property value as a string
+     *
+     * @throw std::invalid_argument
+     */
+    std::string Service::getPropertyValueAsString(const std::string &property) {
+        return this->getParsedPropertyValue(property).string_value;
     }
 
     /**
@@ -147,23 +186,14 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    double Service::getPropertyValueAsDouble(std::string property) {
-        double value;
-        std::string string_value;
-        try {
-            string_value = this->getPropertyValueAsString(property);
-        } catch (std::invalid_argument &e) {
-            throw;
-        }
-        if (string_value == "infinity") {
-            return DBL_MAX;
-        }
-        if (sscanf(string_value.c_str(), "%lf", &value) != 1) {
+    double Service::getPropertyValueAsDouble(const std::string &property) {
+        auto const &parsed_value = this->getParsedPropertyValue(property);
+        if (not parsed_value.is_double) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsDouble(): Invalid double property value " + property + " " +
-                    this->getPropertyValueAsString(property));
+                    parsed_value.string_value);
         }
-        return value;
+        return parsed_value.double_value;
     }
 
     /**
@@ -173,24 +203,14 @@ namespace wrench {
     *
     * @throw std::invalid_argument
     */
-    unsigned long Service::getPropertyValueAsUnsignedLong(std::string property) {
-        unsigned long value;
-        std::string string_value;
-        try {
-            string_value = this->getPropertyValueAsString(property);
-        } catch (std::invalid_argument &e) {
-            throw;
-        }
-        if (string_value == "infinity") {
-            return ULONG_MAX;
-        }
-        if (sscanf(string_value.c_str(), "%lu", &value) != 1) {
+    unsigned long Service::getPropertyValueAsUnsignedLong(const std::string &property) {
+        auto const &parsed_value = this->getParsedPropertyValue(property);
+        if (not parsed_value.is_unsigned_long) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsUnsignedLong(): Invalid unsigned long property value " + property +
-                    " " +
-                    this->getPropertyValueAsString(property));
+                    " " + parsed_value.string_value);
         }
-        return value;
+        return parsed_value.unsigned_long_value;
     }
 
     /**
@@ -200,13 +220,14 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    double Service::getMessagePayloadValue(std::string message_payload) {
-        if (this->messagepayload_list.find(message_payload) == this->messagepayload_list.end()) {
+    double Service::getMessagePayloadValue(const std::string &message_payload) {
+        auto value = this->messagepayload_list.find(message_payload);
+        if (value == this->messagepayload_list.end()) {
             throw std::invalid_argument(
                     "Service::getMessagePayloadValue(): Cannot find value for message_payload " + message_payload +
                     " (perhaps a derived service class does not provide a default value?)");
         }
-        return this->messagepayload_list[message_payload];
+        return value->second;
     }
 
 
@@ -217,23 +238,14 @@ namespace wrench {
      *
      * @throw std::invalid_argument
      */
-    bool Service::getPropertyValueAsBoolean(std::string property) {
-        bool value;
-        std::string string_value;
-        try {
-            string_value = this->getPropertyValueAsString(property);
-        } catch (std::invalid_argument &e) {
-            throw;
-        }
-        if (string_value == "true") {
-            return true;
-        } else if (string_value == "false") {
-            return false;
-        } else {
+    bool Service::getPropertyValueAsBoolean(const std::string &property) {
+        auto const &parsed_value = this->getParsedPropertyValue(property);
+        if (not parsed_value.is_boolean) {
             throw std::invalid_argument(
                     "Service::getPropertyValueAsBoolean(): Invalid boolean property value " + property + " " +
-                    this->getPropertyValueAsString(property));
+                    parsed_value.string_value);
         }
+        return parsed_value.boolean_value;
     }
 
     /**
@@ -294,7 +306,7 @@ namespace wrench {
         WRENCH_INFO("Telling the daemon listening on (%s) to terminate", this->mailbox_name.c_str());
 
         // Send a termination message to the daemon's mailbox_name - SYNCHRONOUSLY
-        std::string ack_mailbox = S4U_Mailbox::generateUniqueMailboxName("stop");
+        std::string ack_mailbox = S4U_Mailbox::getTemporaryMailbox();
         try {
             S4U_Mailbox::putMessage(this->mailbox_name,
                                     new ServiceStopDaemonMessage(
@@ -316,6 +328,8 @@ namespace wrench {
             throw WorkflowExecutionException(cause);
         }
 
+        S4U_Mailbox::retireTemporaryMailbox(ack_mailbox);
+
         if (auto msg = dynamic_cast<ServiceDaemonStoppedMessage*>(message.get())) {
             this->state = Service::DOWN;
         } else {
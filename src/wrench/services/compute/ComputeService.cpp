@@ -326,6 +326,38 @@ namespace wrench {
         return to_return;
     }
 
+    /**
+     * @brief Get idle core counts and ram availability for each of the compute service's host,
+     *        with a single request to the service
+     * @return a map of <idle core count, available ram> tuples, indexed by hostname (could be empty)
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::runtime_error
+     */
+    std::map<std::string, std::tuple<unsigned long, double>> ComputeService::getPerHostIdleResources() {
+
+        std::map<std::string, std::map<std::string, double>> dict;
+        try {
+            dict = this->getServiceResourceInformation();
+        } catch (WorkflowExecutionException &e) {
+            throw;
+        }
+
+        std::map<std::string, std::tuple<unsigned long, double>> to_return;
+
+        if ((dict.find("num_idle_cores") != dict.end()) and (dict.find("ram_availabilities") != dict.end())) {
+            auto &ram_availabilities = dict["ram_availabilities"];
+            for (auto const &x : dict["num_idle_cores"]) {
+                auto ram = ram_availabilities.find(x.first);
+                if (ram != ram_availabilities.end()) {
+                    to_return.insert(std::make_pair(x.first, std::make_tuple((unsigned long) x.second, ram->second)));
+                }
+            }
+        }
+
+        return to_return;
+    }
+
     /**
      * @brief Get the total idle core count for all hosts of the compute service
      * @return total idle core count
@@ -363,23 +395,19 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "info request" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("get_service_info");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
-        try {
-            S4U_Mailbox::putMessage(this->mailbox_name, new ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage(
-                    answer_mailbox,
-                    num_cores,
-                    ram,
-                    this->getMessagePayloadValue(
-                            ComputeServiceMessagePayload::IS_THERE_AT_LEAST_ONE_HOST_WITH_AVAILABLE_RESOURCES_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Get the reply
         std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+            message = S4U_Mailbox::putRequestAndGetAnswer(
+                    this->mailbox_name,
+                    new ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage(
+                            answer_mailbox,
+                            num_cores,
+                            ram,
+                            this->getMessagePayloadValue(
+                                    ComputeServiceMessagePayload::IS_THERE_AT_LEAST_ONE_HOST_WITH_AVAILABLE_RESOURCES_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -475,21 +503,17 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "info request" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("get_service_info");
-
-        try {
-            S4U_Mailbox::putMessage(this->mailbox_name, new ComputeServiceResourceInformationRequestMessage(
-                    answer_mailbox,
-                    this->getMessagePayloadValue(
-                            ComputeServiceMessagePayload::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
-        // Get the reply
         std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+            message = S4U_Mailbox::putRequestAndGetAnswer(
+                    this->mailbox_name,
+                    new ComputeServiceResourceInformationRequestMessage(
+                            answer_mailbox,
+                            this->getMessagePayloadValue(
+                                    ComputeServiceMessagePayload::RESOURCE_DESCRIPTION_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
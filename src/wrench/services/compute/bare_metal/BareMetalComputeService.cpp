@@ -24,6 +24,7 @@
 #include "wrench/logging/TerminalOutput.h"
 #include "wrench/services/storage/StorageService.h"
 #include "wrench/simulation/Simulation.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 #include "wrench/workflow/job/PilotJob.h"
 #include "wrench/workflow/job/StandardJob.h"
 #include "wrench/services/helpers/ServiceTerminationDetector.h"
@@ -54,9 +55,6 @@ namespace wrench {
         // Clean up state in case of a restart
         for (auto host : this->compute_resources) {
             this->total_num_cores += std::get<0>(host.second);
-            this->ram_availabilities.insert(
-                    std::make_pair(host.first, S4U_Simulation::getHostMemoryCapacity(host.first)));
-            this->running_thread_counts.insert(std::make_pair(host.first, 0));
         }
 
         this->running_jobs.clear();
@@ -189,23 +187,18 @@ namespace wrench {
         // be handled later (and a WorkflowExecutionError with a "not enough resources" FailureCause
         // may be generated).
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         //  send a "run a standard job" message to the daemon's mailbox_name
-        try {
-            S4U_Mailbox::putMessage(this->mailbox_name,
-                                    new ComputeServiceSubmitStandardJobRequestMessage(
-                                            answer_mailbox, job, service_specific_args,
-                                            this->getMessagePayloadValue(
-                                                    ComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Get the answer
         std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+            message = S4U_Mailbox::putRequestAndGetAnswer(
+                    this->mailbox_name,
+                    new ComputeServiceSubmitStandardJobRequestMessage(
+                            answer_mailbox, job, service_specific_args,
+                            this->getMessagePayloadValue(
+                                    ComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -237,24 +230,17 @@ namespace wrench {
             const std::map<std::string, std::string> &service_specific_args) {
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         // Send a "run a pilot job" message to the daemon's mailbox_name
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new ComputeServiceSubmitPilotJobRequestMessage(
                             answer_mailbox, job, service_specific_args, this->getMessagePayloadValue(
-                                    BareMetalComputeServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Wait for a reply
-        std::unique_ptr<SimulationMessage> message = nullptr;
-
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+                                    BareMetalComputeServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -480,16 +466,46 @@ namespace wrench {
         this->total_num_cores = 0;
         for (auto host : this->compute_resources) {
             this->total_num_cores += std::get<0>(host.second);
-            this->ram_availabilities.insert(
-                    std::make_pair(host.first, S4U_Simulation::getHostMemoryCapacity(host.first)));
-            this->running_thread_counts.insert(std::make_pair(host.first, 0));
         }
+        this->initializeHostStates();
 
         this->ttl = ttl;
         this->has_ttl = (this->ttl != DBL_MAX);
         this->containing_pilot_job = pj;
     }
 
+    /**
+     * @brief Build the per-host resource state (all RAM available, no running threads)
+     */
+    void BareMetalComputeService::initializeHostStates() {
+        this->host_states.clear();
+        this->host_state_indices.clear();
+        this->host_states.reserve(this->compute_resources.size());
+        for (auto const &host : this->compute_resources) {
+            this->host_state_indices[host.first] = this->host_states.size();
+            this->host_states.push_back({host.first,
+                                         S4U_Simulation::getHost(host.first),
+                                         std::get<0>(host.second),
+                                         S4U_Simulation::getHostMemoryCapacity(host.first),
+                                         0});
+        }
+    }
+
+    /**
+     * @brief Get the resource state of one of the service's hosts
+     * @param hostname: the hostname
+     * @return the host's resource state
+     *
+     * @throws std::invalid_argument
+     */
+    BareMetalComputeService::HostResourceState &BareMetalComputeService::getHostState(const std::string &hostname) {
+        auto it = this->host_state_indices.find(hostname);
+        if (it == this->host_state_indices.end()) {
+            throw std::invalid_argument("BareMetalComputeService::getHostState(): unknown host " + hostname);
+        }
+        return this->host_states[it->second];
+    }
+
     /**
      * @brief Main method of the daemon
      *
@@ -512,6 +528,11 @@ namespace wrench {
                    " GB of RAM\n";
         }WRENCH_INFO("%s", msg.c_str());
 
+        // Resolve the S4U hosts anew, as a host that is a VM is re-created each time the VM is (re)started
+        for (auto &h : this->host_states) {
+            h.host = S4U_Simulation::getHost(h.hostname);
+        }
+
         // Create and start the host state monitor if necessary
         if (Simulation::isEnergySimulationEnabled() or Simulation::isHostShutdownSimulationEnabled()) {
             // Create the host state monitor
@@ -565,50 +586,51 @@ namespace wrench {
             unsigned long required_num_cores,
             double required_ram,
             std::set<std::string> &hosts_to_avoid) {
-        // Compute possible hosts
-        std::set<std::string> possible_hosts;
+        // Compute possible hosts (as indices in host_states)
+        std::vector<unsigned long> possible_hosts;
         std::string new_host_to_avoid = "";
         double new_host_to_avoid_ram_capacity = 0;
-        for (auto const &r : this->compute_resources) {
+        for (unsigned long i = 0; i < this->host_states.size(); i++) {
+            auto const &r = this->host_states[i];
             // If there is a required host, then don't even look at others
-            if (not required_host.empty() and (r.first != required_host)) {
+            if (not required_host.empty() and (r.hostname != required_host)) {
                 continue;
             }
 
             // If the host is down, then don't look at it
-            if (not Simulation::isHostOn(r.first)) {
+            if (not r.host->is_on()) {
                 continue;
             }
 
             // If the host has compute speed zero, then don't look at it
-            if (Simulation::getHostFlopRate(r.first) <= 0.0) {
+            if (r.host->get_speed() <= 0.0) {
                 continue;
             }
 
-            if ((required_num_cores == 0) and (std::get<0>(r.second) < task->getMinNumCores())) {
+            if ((required_num_cores == 0) and (r.num_cores < task->getMinNumCores())) {
                 continue;
             }
-            if ((required_num_cores != 0) and (std::get<0>(r.second) < required_num_cores)) {
+            if ((required_num_cores != 0) and (r.num_cores < required_num_cores)) {
                 continue;
             }
-            if ((required_ram > 0) and (hosts_to_avoid.find(r.first) != hosts_to_avoid.end())) {
+            if ((required_ram > 0) and (hosts_to_avoid.find(r.hostname) != hosts_to_avoid.end())) {
                 continue;
             }
-            if ((required_ram > 0) and (this->ram_availabilities[r.first] < required_ram)) {
+            if ((required_ram > 0) and (r.ram_availability < required_ram)) {
                 if (new_host_to_avoid.empty()) {
-                    new_host_to_avoid = r.first;
-                    new_host_to_avoid_ram_capacity = this->ram_availabilities[r.first];
+                    new_host_to_avoid = r.hostname;
+                    new_host_to_avoid_ram_capacity = r.ram_availability;
                 } else {
-                    if (this->ram_availabilities[r.first] > new_host_to_avoid_ram_capacity) {
+                    if (r.ram_availability > new_host_to_avoid_ram_capacity) {
                         // Make sure we "Avoid" the host with the most RAM (as it might becomes usable sooner
-                        new_host_to_avoid = r.first;
-                        new_host_to_avoid_ram_capacity = this->ram_availabilities[r.first];
+                        new_host_to_avoid = r.hostname;
+                        new_host_to_avoid_ram_capacity = r.ram_availability;
                     }
                 }
                 continue;
             }
 
-            possible_hosts.insert(r.first);
+            possible_hosts.push_back(i);
         }
 
         // If none, then reply with an empty tuple
@@ -624,10 +646,11 @@ namespace wrench {
         double lowest_load = DBL_MAX;
         std::string picked_host = "";
         unsigned long picked_num_cores = 0;
-        for (auto const &h : possible_hosts) {
-            unsigned long num_running_threads = this->running_thread_counts[h];
-            unsigned long num_cores = std::get<0>(this->compute_resources[h]);
-            double flop_rate = S4U_Simulation::getHostFlopRate(h);
+        for (auto const &i : possible_hosts) {
+            auto const &h = this->host_states[i];
+            unsigned long num_running_threads = h.running_thread_count;
+            unsigned long num_cores = h.num_cores;
+            double flop_rate = h.host->get_speed();
             unsigned long used_num_cores;
             if (required_num_cores == 0) {
                 used_num_cores = std::min(num_cores, task->getMaxNumCores()); // as many cores as possible
@@ -639,7 +662,7 @@ namespace wrench {
                           (flop_rate / (1000.0 * 1000.0 * 1000.0));
             if (load < lowest_load) {
                 lowest_load = load;
-                picked_host = h;
+                picked_host = h.hostname;
                 picked_num_cores = used_num_cores;
             }
         }
@@ -703,7 +726,9 @@ namespace wrench {
                                          job,
                                          this->getPropertyValueAsDouble(
                                                  BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD),
-                                         false
+                                         false,
+                                         this->getPropertyValueAsBoolean(
+                                                 BareMetalComputeServiceProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY)
                     ));
 
             workunit_executor->simulation = this->simulation;
@@ -726,8 +751,9 @@ namespace wrench {
             this->workunit_executors[job].insert(workunit_executor);
 
             // Update core and RAM availability
-            this->ram_availabilities[target_host] -= required_ram;
-            this->running_thread_counts[target_host] += target_num_cores;
+            auto &target_host_state = this->getHostState(target_host);
+            target_host_state.ram_availability -= required_ram;
+            target_host_state.running_thread_count += target_num_cores;
 
             dispatched_wus_for_job.insert(wu);
         }
@@ -767,107 +793,132 @@ namespace wrench {
         }
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
-        if (auto msg = dynamic_cast<HostHasTurnedOnMessage *>(message.get())) {
-            // Do nothing, just wake up
-            return true;
-
-        } else if (auto msg = dynamic_cast<HostHasChangedSpeedMessage *>(message.get())) {
-            // Do nothing, just wake up
-            return true;
-
-        } else if (auto msg = dynamic_cast<HostHasTurnedOffMessage *>(message.get())) {
-            // If all hosts being off should not cause the service to terminate, then nevermind
-            if (this->getPropertyValueAsString(
-                    BareMetalComputeServiceProperty::TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN) == "false") {
+        typedef SimulationMessageTypeSwitch<HostHasTurnedOnMessage,
+                HostHasChangedSpeedMessage,
+                HostHasTurnedOffMessage,
+                ServiceStopDaemonMessage,
+                ComputeServiceSubmitStandardJobRequestMessage,
+                ComputeServiceSubmitPilotJobRequestMessage,
+                ComputeServiceResourceInformationRequestMessage,
+                ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage,
+                ComputeServiceTerminateStandardJobRequestMessage,
+                WorkunitExecutorDoneMessage,
+                WorkunitExecutorFailedMessage,
+                ServiceHasCrashedMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<HostHasTurnedOnMessage>(): {
+                // Do nothing, just wake up
                 return true;
-
-            } else {
-                // If not all resources are down or somebody is still running, nevermind
-                // we may have gotten the "Host down" message before the "This WUE has crashed" message.
-                // So we don't want to just quit right now. We'll
-                //  get a WUE Crash message, at which point we'll check whether all hosts are down again
-                if (not this->areAllComputeResourcesDownWithNoWUERunning()) { WRENCH_INFO(
-                            "Not terminating as there are still non-down resources and/or WUE executors that "
-                            "haven't reported back yet");
+            }
+            case MessageTypes::indexOf<HostHasChangedSpeedMessage>(): {
+                // Do nothing, just wake up
+                return true;
+            }
+            case MessageTypes::indexOf<HostHasTurnedOffMessage>(): {
+                // If all hosts being off should not cause the service to terminate, then nevermind
+                if (this->getPropertyValueAsString(
+                        BareMetalComputeServiceProperty::TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN) == "false") {
                     return true;
-                }
 
-                this->terminate(true);
-                this->exit_code = 1; // Exit code to signify that this is, in essence a crash (in case somebody cares)
-                return false;
-            }
+                } else {
+                    // If not all resources are down or somebody is still running, nevermind
+                    // we may have gotten the "Host down" message before the "This WUE has crashed" message.
+                    // So we don't want to just quit right now. We'll
+                    //  get a WUE Crash message, at which point we'll check whether all hosts are down again
+                    if (not this->areAllComputeResourcesDownWithNoWUERunning()) { WRENCH_INFO(
+                                "Not terminating as there are still non-down resources and/or WUE executors that "
+                                "haven't reported back yet");
+                        return true;
+                    }
 
-        } else if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            this->terminate(false);
+                    this->terminate(true);
+                    this->exit_code = 1; // Exit code to signify that this is, in essence a crash (in case somebody cares)
+                    return false;
+                }
+            }
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                this->terminate(false);
 
-            // This is Synchronous
-            try {
-                S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                                BareMetalComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr<NetworkError> &cause) {
+                // This is Synchronous
+                try {
+                    S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                                    BareMetalComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    return false;
+                }
                 return false;
             }
-            return false;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-            processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-            processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-            processGetResourceInformation(msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage *>(message.get())) {
-            processIsThereAtLeastOneHostWithAvailableResources(msg->answer_mailbox, msg->num_cores, msg->ram);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get())) {
-            processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<WorkunitExecutorDoneMessage *>(message.get())) {
-            processWorkunitExecutorCompletion(msg->workunit_executor, msg->workunit);
-            return true;
-
-        } else if (auto msg = dynamic_cast<WorkunitExecutorFailedMessage *>(message.get())) {
-            processWorkunitExecutorFailure(msg->workunit_executor, msg->workunit, msg->cause);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ServiceHasCrashedMessage *>(message.get())) {
-            auto service = msg->service;
-            auto workunit_executor = std::dynamic_pointer_cast<WorkunitExecutor>(service);
-            if (not workunit_executor) {
-                throw std::runtime_error(
-                        "Received a FailureDetectorServiceHasFailedMessage message, but that service is not "
-                        "a WorkUnitExecutor!");
+            case MessageTypes::indexOf<ComputeServiceSubmitStandardJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get());
+                processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
             }
-            processWorkunitExecutorCrash(workunit_executor);
-            // If all hosts being off should not cause the service to terminate, then nevermind
-            if (this->getPropertyValueAsString(
-                    BareMetalComputeServiceProperty::TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN) == "false") {
+            case MessageTypes::indexOf<ComputeServiceSubmitPilotJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get());
+                processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
                 return true;
-
-            } else {
-                // If not all resources are down or somebody is still running, nevermind
-                // we may have gotten the "Host down" message before the "This WUE has crashed" message.
-                // So we don't want to just quit right now. We'll
-                //  get a WUE Crash message, at which point we'll check whether all hosts are down again
-                if (not this->areAllComputeResourcesDownWithNoWUERunning()) {
-                    return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceResourceInformationRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceResourceInformationRequestMessage *>(message.get());
+                processGetResourceInformation(msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage *>(message.get());
+                processIsThereAtLeastOneHostWithAvailableResources(msg->answer_mailbox, msg->num_cores, msg->ram);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceTerminateStandardJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get());
+                processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<WorkunitExecutorDoneMessage>(): {
+                auto msg = static_cast<WorkunitExecutorDoneMessage *>(message.get());
+                processWorkunitExecutorCompletion(msg->workunit_executor, msg->workunit);
+                return true;
+            }
+            case MessageTypes::indexOf<WorkunitExecutorFailedMessage>(): {
+                auto msg = static_cast<WorkunitExecutorFailedMessage *>(message.get());
+                processWorkunitExecutorFailure(msg->workunit_executor, msg->workunit, msg->cause);
+                return true;
+            }
+            case MessageTypes::indexOf<ServiceHasCrashedMessage>(): {
+                auto msg = static_cast<ServiceHasCrashedMessage *>(message.get());
+                auto service = msg->service;
+                auto workunit_executor = std::dynamic_pointer_cast<WorkunitExecutor>(service);
+                if (not workunit_executor) {
+                    throw std::runtime_error(
+                            "Received a FailureDetectorServiceHasFailedMessage message, but that service is not "
+                            "a WorkUnitExecutor!");
                 }
+                processWorkunitExecutorCrash(workunit_executor);
+                // If all hosts being off should not cause the service to terminate, then nevermind
+                if (this->getPropertyValueAsString(
+                        BareMetalComputeServiceProperty::TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN) == "false") {
+                    return true;
 
-                this->terminate(true);
-                this->exit_code = 1; // Exit code to signify that this is, in essence a crash (in case somebody cares)
-                return false;
-            }
+                } else {
+                    // If not all resources are down or somebody is still running, nevermind
+                    // we may have gotten the "Host down" message before the "This WUE has crashed" message.
+                    // So we don't want to just quit right now. We'll
+                    //  get a WUE Crash message, at which point we'll check whether all hosts are down again
+                    if (not this->areAllComputeResourcesDownWithNoWUERunning()) {
+                        return true;
+                    }
 
-        } else {
-            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+                    this->terminate(true);
+                    this->exit_code = 1; // Exit code to signify that this is, in essence a crash (in case somebody cares)
+                    return false;
+                }
+            }
+            default: {
+                throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+            }
         }
     }
 
@@ -911,8 +962,9 @@ namespace wrench {
                 this->files_in_scratch[job].insert(f);
             }
             if (wue->workunit->task) {
-                this->ram_availabilities[wue->getHostname()] += wue->workunit->task->getMemoryRequirement();
-                this->running_thread_counts[wue->getHostname()] -= wue->getNumCores();
+                auto &host_state = this->getHostState(wue->getHostname());
+                host_state.ram_availability += wue->workunit->task->getMemoryRequirement();
+                host_state.running_thread_count -= wue->getNumCores();
             }
             wue->kill(termination_cause == BareMetalComputeService::JobTerminationCause::TERMINATED);
         }
@@ -1043,22 +1095,17 @@ namespace wrench {
     void BareMetalComputeService::terminateStandardJob(std::shared_ptr<StandardJob> job) {
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_standard_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         //  send a "terminate a standard job" message to the daemon's mailbox_name
-        try {
-            S4U_Mailbox::putMessage(this->mailbox_name,
-                                    new ComputeServiceTerminateStandardJobRequestMessage(
-                                            answer_mailbox, job, this->getMessagePayloadValue(
-                                                    BareMetalComputeServiceMessagePayload::TERMINATE_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Get the answer
         std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+            message = S4U_Mailbox::putRequestAndGetAnswer(
+                    this->mailbox_name,
+                    new ComputeServiceTerminateStandardJobRequestMessage(
+                            answer_mailbox, job, this->getMessagePayloadValue(
+                                    BareMetalComputeServiceMessagePayload::TERMINATE_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -1094,8 +1141,9 @@ namespace wrench {
         }
 
         // Update RAM availabilities and running thread counts
-        this->ram_availabilities[workunit_executor->getHostname()] += workunit_executor->getMemoryUtilization();
-        this->running_thread_counts[workunit_executor->getHostname()] -= workunit_executor->getNumCores();
+        auto &host_state = this->getHostState(workunit_executor->getHostname());
+        host_state.ram_availability += workunit_executor->getMemoryUtilization();
+        host_state.running_thread_count -= workunit_executor->getNumCores();
 
         // Forget the workunit executor
         forgetWorkunitExecutor(workunit_executor);
@@ -1190,8 +1238,9 @@ namespace wrench {
         }
         // Update RAM availabilities and running thread counts
         if (workunit->task) {
-            this->ram_availabilities[workunit_executor->getHostname()] += workunit->task->getMemoryRequirement();
-            this->running_thread_counts[workunit_executor->getHostname()] -= workunit_executor->getNumCores();
+            auto &host_state = this->getHostState(workunit_executor->getHostname());
+            host_state.ram_availability += workunit->task->getMemoryRequirement();
+            host_state.running_thread_count -= workunit_executor->getNumCores();
         }
         // Forget the workunit executor
         forgetWorkunitExecutor(workunit_executor);
@@ -1438,8 +1487,8 @@ namespace wrench {
         bool enough_cores = false;
 
         // First check RAM
-        for (auto const &r : this->ram_availabilities) {
-            if (r.second >= ram) {
+        for (auto const &r : this->host_states) {
+            if (r.ram_availability >= ram) {
                 enough_ram = true;
                 break;
             }
@@ -1447,9 +1496,9 @@ namespace wrench {
 
         // Then check Cores
         if (enough_ram) {
-            for (auto const &r : this->running_thread_counts) {
-                unsigned long cores = std::get<0>(this->compute_resources[r.first]);
-                unsigned long running_threads = r.second;
+            for (auto const &r : this->host_states) {
+                unsigned long cores = r.num_cores;
+                unsigned long running_threads = r.running_thread_count;
                 auto num_idle_cores = std::max<unsigned long>(cores - running_threads, 0);
                 if (num_idle_cores >= num_cores) {
                     enough_cores = true;
@@ -1489,11 +1538,11 @@ namespace wrench {
 
         // Num idle cores per hosts
         std::map<std::string, double> num_idle_cores;
-        for (auto r : this->running_thread_counts) {
-            unsigned long cores = std::get<0>(this->compute_resources[r.first]);
-            unsigned long running_threads = r.second;
+        for (auto const &r : this->host_states) {
+            unsigned long cores = r.num_cores;
+            unsigned long running_threads = r.running_thread_count;
             num_idle_cores.insert(
-                    std::make_pair(r.first, (double) (std::max<unsigned long>(cores - running_threads, 0))));
+                    std::make_pair(r.hostname, (double) (std::max<unsigned long>(cores - running_threads, 0))));
         }
         dict.insert(std::make_pair("num_idle_cores", num_idle_cores));
 
@@ -1513,8 +1562,8 @@ namespace wrench {
 
         // RAM availability per host
         std::map<std::string, double> ram_availabilities_to_return;
-        for (auto r : this->ram_availabilities) {
-            ram_availabilities_to_return.insert(std::make_pair(r.first, r.second));
+        for (auto const &r : this->host_states) {
+            ram_availabilities_to_return.insert(std::make_pair(r.hostname, r.ram_availability));
         }
         dict.insert(std::make_pair("ram_availabilities", ram_availabilities_to_return));
 
@@ -1616,8 +1665,9 @@ namespace wrench {
 
         // Update RAM availabilities and running thread counts
         if (workunit->task) {
-            this->ram_availabilities[workunit_executor->getHostname()] += workunit->task->getMemoryRequirement();
-            this->running_thread_counts[workunit_executor->getHostname()] -= workunit_executor->getNumCores();
+            auto &host_state = this->getHostState(workunit_executor->getHostname());
+            host_state.ram_availability += workunit->task->getMemoryRequirement();
+            host_state.running_thread_count -= workunit_executor->getNumCores();
         }
 
         // Forget the workunit executor
@@ -13,6 +13,7 @@ namespace wrench {
 
     SET_PROPERTY_NAME(BareMetalComputeServiceProperty, TASK_STARTUP_OVERHEAD);
     SET_PROPERTY_NAME(BareMetalComputeServiceProperty, TERMINATE_WHENEVER_ALL_RESOURCES_ARE_DOWN);
+    SET_PROPERTY_NAME(BareMetalComputeServiceProperty, SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY);
 
 };
 
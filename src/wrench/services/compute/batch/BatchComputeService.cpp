@@ -25,9 +25,11 @@
 #include "wrench/util/TraceFileLoader.h"
 #include "wrench/workflow/job/PilotJob.h"
 #include "services/compute/batch/workload_helper_classes/WorkloadTraceFileReplayer.h"
+#include "batch_schedulers/homegrown/AvailableCoresIndex.h"
 #include "batch_schedulers/homegrown/fcfs/FCFSBatchScheduler.h"
 #include "batch_schedulers/homegrown/conservative_bf/CONSERVATIVEBFBatchScheduler.h"
 #include "batch_schedulers/homegrown/conservative_bf_core_level/CONSERVATIVEBFBatchSchedulerCoreLevel.h"
+#include "batch_schedulers/homegrown/easy_bf/EASYBFBatchScheduler.h"
 #include "batch_schedulers/batsched/BatschedBatchScheduler.h"
 #include "wrench/workflow/failure_causes/JobTypeNotSupported.h"
 #include "wrench/workflow/failure_causes/FunctionalityNotAvailable.h"
@@ -36,6 +38,7 @@
 #include "wrench/workflow/failure_causes/NotEnoughResources.h"
 #include "wrench/workflow/failure_causes/JobTimeout.h"
 #include "wrench/workflow/failure_causes/NotAllowed.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 
 
 WRENCH_LOG_CATEGORY(wrench_core_batch_service, "Log category for Batch Service");
@@ -141,6 +144,8 @@ namespace wrench {
         this->compute_hosts = compute_hosts;
 
         this->num_cores_per_node = this->nodes_to_cores_map.begin()->second;
+        this->available_cores_index = std::unique_ptr<AvailableCoresIndex>(
+                new AvailableCoresIndex(this->compute_hosts, this->num_cores_per_node));
         this->total_num_of_nodes = compute_hosts.size();
 
         // Check that the workload file is valid
@@ -148,7 +153,7 @@ namespace wrench {
                 BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE);
         if (not workload_file.empty()) {
             try {
-                this->workload_trace = TraceFileLoader::loadFromTraceFile(
+                this->workload_trace = TraceFileLoader::loadWorkloadTrace(
                         workload_file,
                         this->getPropertyValueAsBoolean(
                                 BatchComputeServiceProperty::IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE),
@@ -157,24 +162,9 @@ namespace wrench {
             } catch (std::exception &e) {
                 throw;
             }
-            // Fix value
-            for (auto &j : this->workload_trace) {
-                std::string id = std::get<0>(j);
-                double submit_time = std::get<1>(j);
-                double flops = std::get<2>(j);
-                double requested_flops = std::get<3>(j);
-                double requested_ram = std::get<4>(j);
-                unsigned int num_nodes = std::get<5>(j);
-
-                // Capping to max number of nodes, silently
-                if (num_nodes > this->total_num_of_nodes) {
-                    std::get<5>(j) = this->total_num_of_nodes;
-                }
-                // Capping to ram, silently
-                if (requested_ram > ram_available) {
-                    std::get<4>(j) = ram_available;
-                }
-            }
+            // Capping to max number of nodes and to ram, silently
+            this->workload_trace->capNumNodes((unsigned int) this->total_num_of_nodes);
+            this->workload_trace->capRequestedRam(ram_available);
         }
 
         // Create a scheduler
@@ -195,6 +185,8 @@ namespace wrench {
             this->scheduler = std::unique_ptr<BatchScheduler>(new CONSERVATIVEBFBatchScheduler(this));
         } else if (batch_scheduling_alg == "conservative_bf_core_level") {
             this->scheduler = std::unique_ptr<BatchScheduler>(new CONSERVATIVEBFBatchSchedulerCoreLevel(this));
+        } else if (batch_scheduling_alg == "easy_bf") {
+            this->scheduler = std::unique_ptr<BatchScheduler>(new EASYBFBatchScheduler(this));
         }
 #endif
 
@@ -230,6 +222,18 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Helper function to get the name of a batch job (as shown in the batch queue)
+     * @param batch_job: the batch job
+     * @return a name
+     */
+    static std::string getBatchJobName(const std::shared_ptr<BatchJob> &batch_job) {
+        if (batch_job->isBackgroundJob()) {
+            return "background_job_" + std::to_string(batch_job->getJobID());
+        }
+        return batch_job->getWorkflowJob()->getName();
+    }
+
     /**
     * @brief Gets the state of the batch queue
     * @return A vector of tuples:
@@ -247,7 +251,7 @@ namespace wrench {
         for (auto const &j : this->running_jobs) {
             auto tuple = std::make_tuple(
                     j->getUsername(),
-                    j->getWorkflowJob()->getName(),
+                    getBatchJobName(j),
                     j->getRequestedNumNodes(),
                     j->getRequestedCoresPerNode(),
                     j->getRequestedTime(),
@@ -261,7 +265,7 @@ namespace wrench {
         for (auto const &j : this->waiting_jobs) {
             auto tuple = std::make_tuple(
                     j->getUsername(),
-                    j->getWorkflowJob()->getName(),
+                    getBatchJobName(j),
                     j->getRequestedNumNodes(),
                     j->getRequestedCoresPerNode(),
                     j->getRequestedTime(),
@@ -275,7 +279,7 @@ namespace wrench {
         for (auto const &j : this->batch_queue) {
             auto tuple = std::make_tuple(
                     j->getUsername(),
-                    j->getWorkflowJob()->getName(),
+                    getBatchJobName(j),
                     j->getRequestedNumNodes(),
                     j->getRequestedCoresPerNode(),
                     j->getRequestedTime(),
@@ -372,7 +376,7 @@ namespace wrench {
         }
 
         // Send a "run a batch job" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("batch_standard_job_mailbox");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
         try {
             S4U_Mailbox::dputMessage(
                     this->mailbox_name,
@@ -391,6 +395,7 @@ namespace wrench {
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
+        S4U_Mailbox::retireTemporaryMailbox(answer_mailbox);
 
         // Standard Job?
         if (std::dynamic_pointer_cast<StandardJob>(job)) {
@@ -419,6 +424,39 @@ namespace wrench {
                 "] message!");
     }
 
+    /**
+     * @brief Asynchronously submit a background job, i.e., a job that merely occupies nodes
+     *        for its runtime without running any task, to the batch service (no answer is sent back)
+     *
+     * @param answer_mailbox: the submitter's mailbox
+     * @param username: the username
+     * @param num_nodes: the number of nodes
+     * @param time_in_minutes: the requested time in minutes
+     * @param runtime: the job's actual runtime in seconds
+     *
+     * @throw WorkflowExecutionException
+     * @throw std::invalid_argument
+     */
+    void BatchComputeService::submitBackgroundJob(const std::string &answer_mailbox, const std::string &username,
+                                                  unsigned long num_nodes, unsigned long time_in_minutes,
+                                                  double runtime) {
+        auto batch_job = std::shared_ptr<BatchJob>(new BatchJob(this->generateUniqueJobID(), time_in_minutes,
+                                                                num_nodes, this->num_cores_per_node, username,
+                                                                runtime, S4U_Simulation::getClock()));
+        batch_job->csv_metadata = "color:green";
+
+        try {
+            S4U_Mailbox::dputMessage(
+                    this->mailbox_name,
+                    new BatchComputeServiceJobRequestMessage(
+                            answer_mailbox, batch_job,
+                            this->getMessagePayloadValue(
+                                    BatchComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
+        } catch (std::shared_ptr<NetworkError> &cause) {
+            throw WorkflowExecutionException(cause);
+        }
+    }
+
     /**
      * @brief Synchronously submit a standard job to the batch service
      *
@@ -472,7 +510,7 @@ namespace wrench {
     void BatchComputeService::terminateWorkflowJob(std::shared_ptr<WorkflowJob> job) {
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("terminate_standard_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         // Send a "terminate a  job" message to the daemon's mailbox_name
         try {
@@ -505,6 +543,7 @@ namespace wrench {
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
+        S4U_Mailbox::retireTemporaryMailbox(answer_mailbox);
 
         if (std::dynamic_pointer_cast<StandardJob>(job)) {
             if (auto msg = dynamic_cast<ComputeServiceTerminateStandardJobAnswerMessage *>(message.get())) {
@@ -576,7 +615,7 @@ namespace wrench {
         this->scheduler->launch();
 
         // Start the workload trace replayer if needed
-        if (not this->workload_trace.empty()) {
+        if (this->workload_trace and (not this->workload_trace->empty())) {
             try {
                 startBackgroundWorkloadProcess();
             } catch (std::runtime_error &e) {
@@ -643,10 +682,32 @@ namespace wrench {
      */
     void BatchComputeService::freeUpResources(std::map<std::string, std::tuple<unsigned long, double>> resources) {
         for (auto r : resources) {
-            this->available_nodes_to_cores[r.first] += std::get<0>(r.second);
+            this->releaseCoresOnHost(r.first, std::get<0>(r.second));
         }
     }
 
+    /**
+     * @brief Mark cores of a host as allocated
+     * @param hostname: the host's name
+     * @param num_cores: the number of cores
+     */
+    void BatchComputeService::allocateCoresOnHost(const std::string &hostname, unsigned long num_cores) {
+        auto &available = this->available_nodes_to_cores[hostname];
+        available -= num_cores;
+        this->available_cores_index->setNumAvailableCores(hostname, available);
+    }
+
+    /**
+     * @brief Mark cores of a host as available
+     * @param hostname: the host's name
+     * @param num_cores: the number of cores
+     */
+    void BatchComputeService::releaseCoresOnHost(const std::string &hostname, unsigned long num_cores) {
+        auto &available = this->available_nodes_to_cores[hostname];
+        available += num_cores;
+        this->available_cores_index->setNumAvailableCores(hostname, available);
+    }
+
     /**
      * @brief ...
      * @param job
@@ -667,6 +728,11 @@ namespace wrench {
             return;
         }
 
+        if (job->isBackgroundJob()) {
+            this->all_jobs.erase(job);
+            return;
+        }
+
         for (auto const &j: this->all_jobs) {
             if (j->getWorkflowJob() == job->getWorkflowJob()) {
                 this->all_jobs.erase(j);
@@ -908,65 +974,91 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            this->setStateToDown();
-            this->failCurrentStandardJobs();
-            this->terminateRunningPilotJobs();
-
-            // Send back a synchronous reply!
-            try {
-                S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                                BatchComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr<NetworkError> &cause) {
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                ComputeServiceResourceInformationRequestMessage,
+                BatchComputeServiceJobRequestMessage,
+                StandardJobExecutorDoneMessage,
+                StandardJobExecutorFailedMessage,
+                ComputeServiceTerminateStandardJobRequestMessage,
+                ComputeServicePilotJobExpiredMessage,
+                ComputeServiceTerminatePilotJobRequestMessage,
+                AlarmJobTimeOutMessage,
+                BatchExecuteJobFromBatSchedMessage,
+                ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                this->setStateToDown();
+                this->failCurrentStandardJobs();
+                this->terminateRunningPilotJobs();
+
+                // Send back a synchronous reply!
+                try {
+                    S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                                    BatchComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    return false;
+                }
+                return false;
+            }
+            case MessageTypes::indexOf<ComputeServiceResourceInformationRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceResourceInformationRequestMessage *>(message.get());
+                processGetResourceInformation(msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<BatchComputeServiceJobRequestMessage>(): {
+                auto msg = static_cast<BatchComputeServiceJobRequestMessage *>(message.get());
+                processJobSubmission(msg->job, msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<StandardJobExecutorDoneMessage>(): {
+                auto msg = static_cast<StandardJobExecutorDoneMessage *>(message.get());
+                processStandardJobCompletion(msg->executor, msg->job);
+                return true;
+            }
+            case MessageTypes::indexOf<StandardJobExecutorFailedMessage>(): {
+                auto msg = static_cast<StandardJobExecutorFailedMessage *>(message.get());
+                processStandardJobFailure(msg->executor, msg->job, msg->cause);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceTerminateStandardJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get());
+                processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServicePilotJobExpiredMessage>(): {
+                auto msg = static_cast<ComputeServicePilotJobExpiredMessage *>(message.get());
+                processPilotJobCompletion(msg->job);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceTerminatePilotJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get());
+                processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<AlarmJobTimeOutMessage>(): {
+                auto msg = static_cast<AlarmJobTimeOutMessage *>(message.get());
+                processAlarmJobTimeout(msg->job);
+                return true;
+            }
+            case MessageTypes::indexOf<BatchExecuteJobFromBatSchedMessage>(): {
+                auto msg = static_cast<BatchExecuteJobFromBatSchedMessage *>(message.get());
+                processExecuteJobFromBatSched(msg->batsched_decision_reply);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage *>(message.get());
+                processIsThereAtLeastOneHostWithAvailableResources(msg->answer_mailbox, msg->num_cores, msg->ram);
+                return true;
+            }
+            default: {
+                throw std::runtime_error(
+                        "BatchComputeService::processNextMessage(): Unexpected [" + message->getName() + "] message");
                 return false;
             }
-            return false;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-            processGetResourceInformation(msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<BatchComputeServiceJobRequestMessage *>(message.get())) {
-            processJobSubmission(msg->job, msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<StandardJobExecutorDoneMessage *>(message.get())) {
-            processStandardJobCompletion(msg->executor, msg->job);
-            return true;
-
-        } else if (auto msg = dynamic_cast<StandardJobExecutorFailedMessage *>(message.get())) {
-            processStandardJobFailure(msg->executor, msg->job, msg->cause);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceTerminateStandardJobRequestMessage *>(message.get())) {
-            processStandardJobTerminationRequest(msg->job, msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
-            processPilotJobCompletion(msg->job);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceTerminatePilotJobRequestMessage *>(message.get())) {
-            processPilotJobTerminationRequest(msg->job, msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<AlarmJobTimeOutMessage *>(message.get())) {
-            processAlarmJobTimeout(msg->job);
-            return true;
-
-        } else if (auto msg = dynamic_cast<BatchExecuteJobFromBatSchedMessage *>(message.get())) {
-            processExecuteJobFromBatSched(msg->batsched_decision_reply);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage *>(message.get())) {
-            processIsThereAtLeastOneHostWithAvailableResources(msg->answer_mailbox, msg->num_cores, msg->ram);
-            return true;
-
-        } else {
-            throw std::runtime_error(
-                    "BatchComputeService::processNextMessage(): Unexpected [" + message->getName() + "] message");
-            return false;
         }
     }
 
@@ -979,6 +1071,17 @@ namespace wrench {
     void BatchComputeService::processJobSubmission(std::shared_ptr<BatchJob> job, std::string answer_mailbox) {
         WRENCH_INFO("Asked to run a batch job with id %ld", job->getJobID());
 
+        // Background jobs are admitted as is (the trace replayer has capped their sizes) and not answered
+        if (job->isBackgroundJob()) {
+            job->setRequestedTime(job->getRequestedTime() +
+                                  this->getPropertyValueAsUnsignedLong(
+                                          BatchComputeServiceProperty::BATCH_RJMS_PADDING_DELAY));
+            this->all_jobs.insert(job);
+            this->batch_queue.push_back(job);
+            this->scheduler->processJobSubmission(job);
+            return;
+        }
+
         // Check whether the job type is supported
         if ((std::dynamic_pointer_cast<StandardJob>(job->getWorkflowJob())) and
             (not getPropertyValueAsBoolean(BatchComputeServiceProperty::SUPPORTS_STANDARD_JOBS))) {
@@ -1186,7 +1289,7 @@ namespace wrench {
                 // Update the cores count in the available resources
                 std::map<std::string, std::tuple<unsigned long, double>> resources = (*it1)->getResourcesAllocated();
                 for (auto r : resources) {
-                    this->available_nodes_to_cores[r.first] += std::get<0>(r.second);
+                    this->releaseCoresOnHost(r.first, std::get<0>(r.second));
                 }
                 auto answer_message = new ComputeServiceTerminatePilotJobAnswerMessage(
                         job, this->getSharedPtr<BatchComputeService>(), true, nullptr,
@@ -1387,7 +1490,28 @@ namespace wrench {
             std::shared_ptr<BatchJob> batch_job, unsigned long num_nodes_allocated,
             unsigned long allocated_time,
             unsigned long cores_per_node_asked_for) {
-        if (auto sjob = std::dynamic_pointer_cast<StandardJob>(workflow_job)) {
+        if (batch_job->isBackgroundJob()) {
+            // background job: nothing runs, the nodes are simply held until an alarm goes off
+            WRENCH_INFO(
+                    "Allocating %ld nodes with %ld cores per node to a background job for %.2lf seconds",
+                    num_nodes_allocated, cores_per_node_asked_for,
+                    std::min<double>(batch_job->getBackgroundRuntime(), (double) allocated_time));
+            batch_job->setBeginTimestamp(S4U_Simulation::getClock());
+            batch_job->setEndingTimestamp(S4U_Simulation::getClock() +
+                                          std::min<double>(batch_job->getBackgroundRuntime(),
+                                                           (double) allocated_time));
+            this->timeslots.push_back(batch_job->getEndingTimestamp());
+            batch_job->setAllocatedResources(resources);
+
+            SimulationMessage *msg = new AlarmJobTimeOutMessage(batch_job, 0);
+            Alarm::createAndStartAlarm(this->simulation,
+                                       batch_job->getEndingTimestamp(),
+                                       this->hostname,
+                                       this->mailbox_name, msg,
+                                       "batch_background");
+            return;
+
+        } else if (auto sjob = std::dynamic_pointer_cast<StandardJob>(workflow_job)) {
             // standard job
             WRENCH_INFO(
                     "Creating a StandardJobExecutor for a standard job on %ld nodes with %ld cores per node",
@@ -1409,6 +1533,9 @@ namespace wrench {
                              {StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SLEEP,
                                      this->getPropertyValueAsString(
                                              BatchComputeServiceProperty::SIMULATE_COMPUTATION_AS_SLEEP)},
+                             {StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY,
+                                     this->getPropertyValueAsString(
+                                             BatchComputeServiceProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY)},
                              {StandardJobExecutorProperty::TASK_SELECTION_ALGORITHM,
                                      this->getPropertyValueAsString(
                                              BatchComputeServiceProperty::TASK_SELECTION_ALGORITHM)}
@@ -1572,7 +1699,7 @@ namespace wrench {
      * @throw std::runtime_error
      */
     void BatchComputeService::startBackgroundWorkloadProcess() {
-        if (this->workload_trace.empty()) {
+        if ((this->workload_trace == nullptr) or this->workload_trace->empty()) {
             throw std::runtime_error(
                     "BatchComputeService::startBackgroundWorkloadProcess(): no workload trace file specified");
         }
@@ -1585,6 +1712,8 @@ namespace wrench {
                         this->num_cores_per_node,
                         this->getPropertyValueAsBoolean(
                                 BatchComputeServiceProperty::USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE),
+                        this->getPropertyValueAsBoolean(
+                                BatchComputeServiceProperty::SIMULATE_JOBS_IN_WORKLOAD_TRACE_FILE_AS_RESERVATIONS),
                         this->workload_trace)
         );
         try {
@@ -1702,7 +1831,16 @@ namespace wrench {
             return;
         }
 
-        if (auto sjob = std::dynamic_pointer_cast<StandardJob>(job->getWorkflowJob())) {
+        if (job->isBackgroundJob()) {
+            // A background job is done once its alarm goes off
+            WRENCH_INFO("Background job %lu has completed", job->getJobID());
+            this->freeUpResources(job->getResourcesAllocated());
+            this->removeJobFromRunningList(job);
+            this->scheduler->processJobCompletion(job);
+            this->removeBatchJobFromJobsList(job);
+            return;
+
+        } else if (auto sjob = std::dynamic_pointer_cast<StandardJob>(job->getWorkflowJob())) {
             this->processStandardJobTimeout(sjob);
             this->removeJobFromRunningList(job);
             this->freeUpResources(job->getResourcesAllocated());
@@ -1749,7 +1887,7 @@ namespace wrench {
                 break;
             }
         }
-        if (workflow_job == nullptr) { WRENCH_WARN(
+        if (batch_job == nullptr) { WRENCH_WARN(
                     "BatchComputeService::processExecuteJobFromBatSched(): Job received from batsched that does not "
                     "belong to the list of known jobs... just telling Batsched that the job completed (Batsched seems "
                     "to send this back even when a job has been actively terminated)");
@@ -1794,7 +1932,7 @@ namespace wrench {
         for (auto node:node_resources) {
             double ram_capacity = S4U_Simulation::getHostMemoryCapacity(
                     this->host_id_to_names[node]); // Use the whole RAM
-            this->available_nodes_to_cores[this->host_id_to_names[node]] -= cores_per_node_asked_for;
+            this->allocateCoresOnHost(this->host_id_to_names[node], cores_per_node_asked_for);
             resources.insert(std::make_pair(this->host_id_to_names[node], std::make_tuple(
                     cores_per_node_asked_for, ram_capacity)));
         }
@@ -27,10 +27,12 @@ namespace wrench {
     SET_PROPERTY_NAME(BatchComputeServiceProperty, USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE);
     SET_PROPERTY_NAME(BatchComputeServiceProperty, SUBMIT_TIME_OF_FIRST_JOB_IN_WORKLOAD_TRACE_FILE);
     SET_PROPERTY_NAME(BatchComputeServiceProperty, IGNORE_INVALID_JOBS_IN_WORKLOAD_TRACE_FILE);
+    SET_PROPERTY_NAME(BatchComputeServiceProperty, SIMULATE_JOBS_IN_WORKLOAD_TRACE_FILE_AS_RESERVATIONS);
 
     SET_PROPERTY_NAME(BatchComputeServiceProperty, OUTPUT_CSV_JOB_LOG);
 
     SET_PROPERTY_NAME(BatchComputeServiceProperty, SIMULATE_COMPUTATION_AS_SLEEP);
+    SET_PROPERTY_NAME(BatchComputeServiceProperty, SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY);
 
     SET_PROPERTY_NAME(BatchComputeServiceProperty, BATSCHED_LOGGING_MUTED);
     SET_PROPERTY_NAME(BatchComputeServiceProperty, BATSCHED_CONTIGUOUS_ALLOCATION);
@@ -48,6 +48,44 @@ namespace wrench {
         this->ending_time_stamp = ending_time_stamp;
         this->arrival_time_stamp = arrival_time_stamp;
 
+        this->background_runtime = -1.0;
+
+        this->csv_metadata = "color:red";
+    }
+
+    /**
+     * @brief Constructor for a background job, i.e., a job that does not correspond to any workflow
+     *        job and merely occupies its nodes for its runtime (used to replay workload trace files)
+     *
+     * @param job_id: the batch job id
+     * @param time_in_minutes: the requested execution time in minutes
+     * @param num_nodes: the requested number of compute nodes (hosts)
+     * @param cores_per_node: the requested number of cores per node
+     * @param username: the username of the user submitting the job
+     * @param runtime: the job's actual runtime in seconds
+     * @param arrival_time_stamp: the job's arrival date
+     */
+    BatchJob::BatchJob(unsigned long job_id, unsigned long time_in_minutes, unsigned long num_nodes,
+                       unsigned long cores_per_node, std::string username, double runtime, double arrival_time_stamp) {
+        if (job_id <= 0 || num_nodes == 0 || cores_per_node == 0 || runtime < 0) {
+            throw std::invalid_argument(
+                    "BatchJob::BatchJob(): either jobid (" + std::to_string(job_id) +
+                    "), num_nodes (" + std::to_string(num_nodes) +
+                    "), cores_per_node (" + std::to_string(cores_per_node) +
+                    ") is less than or equal to zero, or runtime (" + std::to_string(runtime) +
+                    ") is negative"
+            );
+        }
+        this->job = nullptr;
+        this->job_id = job_id;
+        this->requested_time = time_in_minutes * 60;
+        this->requested_num_nodes = num_nodes;
+        this->requested_cores_per_node = cores_per_node;
+        this->username = username;
+        this->ending_time_stamp = -1.0;
+        this->arrival_time_stamp = arrival_time_stamp;
+        this->background_runtime = runtime;
+
         this->csv_metadata = "color:red";
     }
 
@@ -116,6 +154,23 @@ namespace wrench {
         return this->job;
     }
 
+    /**
+     * @brief Determine whether this batch job is a background job, i.e., a job that
+     *        does not correspond to any workflow job and merely occupies nodes
+     * @return true or false
+     */
+    bool BatchJob::isBackgroundJob() {
+        return (this->job == nullptr);
+    }
+
+    /**
+     * @brief Get the runtime of a background job
+     * @return a time in seconds (-1.0 if the job is not a background job)
+     */
+    double BatchJob::getBackgroundRuntime() {
+        return this->background_runtime;
+    }
+
     /**
      * @brief Get the id of this batch job
      * @return a string id
@@ -0,0 +1,214 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <queue>
+#include <stdexcept>
+
+#include "AvailableCoresIndex.h"
+
+namespace wrench {
+
+    /**
+     * @brief Constructor (all cores of all hosts are initially available)
+     * @param hosts: the hosts, in the order used by the ROUNDROBIN algorithm
+     * @param num_cores_per_host: the number of cores per host
+     */
+    AvailableCoresIndex::AvailableCoresIndex(const std::vector<std::string> &hosts, unsigned long num_cores_per_host) {
+        for (auto const &h : hosts) {
+            if (this->host_positions.find(h) == this->host_positions.end()) {
+                this->host_positions[h] = this->hosts.size();
+                this->hosts.push_back(h);
+            }
+        }
+
+        this->rank_positions.resize(this->hosts.size());
+        for (unsigned long i = 0; i < this->hosts.size(); i++) {
+            this->rank_positions[i] = i;
+        }
+        std::sort(this->rank_positions.begin(), this->rank_positions.end(),
+                  [this](unsigned long a, unsigned long b) { return this->hosts[a] < this->hosts[b]; });
+        this->name_ranks.resize(this->hosts.size());
+        for (unsigned long r = 0; r < this->hosts.size(); r++) {
+            this->name_ranks[this->rank_positions[r]] = r;
+        }
+
+        this->available_cores.assign(this->hosts.size(), num_cores_per_host);
+        this->ranks_by_available_cores.resize(num_cores_per_host + 1);
+        this->positions_by_available_cores.resize(num_cores_per_host + 1);
+        for (unsigned long p = 0; p < this->hosts.size(); p++) {
+            this->ranks_by_available_cores[num_cores_per_host].insert(this->name_ranks[p]);
+            this->positions_by_available_cores[num_cores_per_host].insert(p);
+        }
+    }
+
+    /**
+     * @brief Get the position of a host
+     * @param hostname: the host's name
+     * @return a position
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned long AvailableCoresIndex::getPosition(const std::string &hostname) {
+        auto it = this->host_positions.find(hostname);
+        if (it == this->host_positions.end()) {
+            throw std::invalid_argument("AvailableCoresIndex::getPosition(): Unknown host " + hostname);
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Update the number of available cores of a host
+     * @param hostname: the host's name
+     * @param num_cores: the host's number of available cores
+     *
+     * @throw std::invalid_argument
+     */
+    void AvailableCoresIndex::setNumAvailableCores(const std::string &hostname, unsigned long num_cores) {
+        unsigned long position = this->getPosition(hostname);
+        if (num_cores >= this->ranks_by_available_cores.size()) {
+            throw std::invalid_argument("AvailableCoresIndex::setNumAvailableCores(): Invalid number of cores (" +
+                                        std::to_string(num_cores) + ") for host " + hostname);
+        }
+        unsigned long old_num_cores = this->available_cores[position];
+        if (old_num_cores == num_cores) {
+            return;
+        }
+        this->ranks_by_available_cores[old_num_cores].erase(this->name_ranks[position]);
+        this->positions_by_available_cores[old_num_cores].erase(position);
+        this->ranks_by_available_cores[num_cores].insert(this->name_ranks[position]);
+        this->positions_by_available_cores[num_cores].insert(position);
+        this->available_cores[position] = num_cores;
+    }
+
+    /**
+     * @brief Get the number of available cores of a host
+     * @param hostname: the host's name
+     * @return a number of cores
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned long AvailableCoresIndex::getNumAvailableCores(const std::string &hostname) {
+        return this->available_cores[this->getPosition(hostname)];
+    }
+
+    /**
+     * @brief Find the first hosts, in lexicographical order of host names, that have enough available cores
+     * @param num_hosts: the number of hosts needed
+     * @param num_cores: the number of cores needed on each host
+     * @return a list of hosts (empty if there are not enough such hosts)
+     */
+    std::vector<std::string> AvailableCoresIndex::findFirstFit(unsigned long num_hosts, unsigned long num_cores) {
+        std::vector<std::string> selected;
+
+        // Merge the (sorted) buckets of all hosts with enough available cores
+        typedef std::pair<unsigned long, unsigned long> RankAndBucket;
+        std::priority_queue<RankAndBucket, std::vector<RankAndBucket>, std::greater<RankAndBucket>> merger;
+        std::vector<std::set<unsigned long>::iterator> cursors(this->ranks_by_available_cores.size());
+        for (unsigned long b = num_cores; b < this->ranks_by_available_cores.size(); b++) {
+            cursors[b] = this->ranks_by_available_cores[b].begin();
+            if (cursors[b] != this->ranks_by_available_cores[b].end()) {
+                merger.push(std::make_pair(*cursors[b], b));
+            }
+        }
+
+        while ((selected.size() < num_hosts) and (not merger.empty())) {
+            unsigned long b = merger.top().second;
+            merger.pop();
+            selected.push_back(this->hosts[this->rank_positions[*cursors[b]]]);
+            if (++cursors[b] != this->ranks_by_available_cores[b].end()) {
+                merger.push(std::make_pair(*cursors[b], b));
+            }
+        }
+
+        if (selected.size() < num_hosts) {
+            selected.clear();
+        }
+        return selected;
+    }
+
+    /**
+     * @brief Find the hosts that have enough available cores and the fewest cores left over once
+     *        these cores are used (ties are broken by lexicographical order of host names)
+     * @param num_hosts: the number of hosts needed
+     * @param num_cores: the number of cores needed on each host
+     * @return a list of hosts (empty if there are not enough such hosts)
+     */
+    std::vector<std::string> AvailableCoresIndex::findBestFit(unsigned long num_hosts, unsigned long num_cores) {
+        std::vector<std::string> selected;
+
+        for (unsigned long b = num_cores;
+             (b < this->ranks_by_available_cores.size()) and (selected.size() < num_hosts); b++) {
+            for (auto r : this->ranks_by_available_cores[b]) {
+                selected.push_back(this->hosts[this->rank_positions[r]]);
+                if (selected.size() >= num_hosts) {
+                    break;
+                }
+            }
+        }
+
+        if (selected.size() < num_hosts) {
+            selected.clear();
+        }
+        return selected;
+    }
+
+    /**
+     * @brief Find the next hosts that have enough available cores, going around the hosts
+     *        (in the order given to the constructor) starting right after the cursor
+     * @param num_hosts: the number of hosts needed
+     * @param num_cores: the number of cores needed on each host
+     * @param cursor: the position of the last selected host (updated to the position of the last
+     *        host selected by this call, if any)
+     * @return a list of hosts (empty if there are not enough such hosts)
+     */
+    std::vector<std::string> AvailableCoresIndex::findRoundRobin(unsigned long num_hosts, unsigned long num_cores,
+                                                                 unsigned long &cursor) {
+        std::vector<std::string> selected;
+        unsigned long num_positions = this->hosts.size();
+        unsigned long current = cursor;
+        unsigned long distance_traveled = 0;
+
+        while (selected.size() < num_hosts) {
+            // Find the closest position after the current one (wrapping around) in all buckets
+            // of hosts with enough available cores
+            unsigned long best_distance = num_positions + 1;
+            unsigned long best_position = 0;
+            for (unsigned long b = num_cores; b < this->positions_by_available_cores.size(); b++) {
+                auto const &bucket = this->positions_by_available_cores[b];
+                if (bucket.empty()) {
+                    continue;
+                }
+                auto it = bucket.upper_bound(current);
+                unsigned long position = (it != bucket.end()) ? *it : *bucket.begin();
+                unsigned long distance = (position > current) ? position - current : position + num_positions - current;
+                if (distance < best_distance) {
+                    best_distance = distance;
+                    best_position = position;
+                }
+            }
+            // Each host is considered at most once
+            if (distance_traveled + best_distance > num_positions) {
+                break;
+            }
+            distance_traveled += best_distance;
+            current = best_position;
+            selected.push_back(this->hosts[current]);
+        }
+
+        if (selected.size() < num_hosts) {
+            selected.clear();
+        } else {
+            cursor = current;
+        }
+        return selected;
+    }
+
+}
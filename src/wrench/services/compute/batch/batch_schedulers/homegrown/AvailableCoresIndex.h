@@ -0,0 +1,66 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_AVAILABLECORESINDEX_H
+#define WRENCH_AVAILABLECORESINDEX_H
+
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/***********************/
+/** \cond              */
+/***********************/
+
+namespace wrench {
+
+    /**
+     * @brief A class that indexes the compute hosts of a batch compute service by their
+     *        number of available cores, so that the FIRSTFIT, BESTFIT and ROUNDROBIN host
+     *        selection algorithms do not have to scan all hosts
+     */
+    class AvailableCoresIndex {
+
+    public:
+        AvailableCoresIndex(const std::vector<std::string> &hosts, unsigned long num_cores_per_host);
+
+        void setNumAvailableCores(const std::string &hostname, unsigned long num_cores);
+        unsigned long getNumAvailableCores(const std::string &hostname);
+
+        std::vector<std::string> findFirstFit(unsigned long num_hosts, unsigned long num_cores);
+        std::vector<std::string> findBestFit(unsigned long num_hosts, unsigned long num_cores);
+        std::vector<std::string> findRoundRobin(unsigned long num_hosts, unsigned long num_cores, unsigned long &cursor);
+
+    private:
+        unsigned long getPosition(const std::string &hostname);
+
+        /** @brief The hosts, in the order in which they were given to the batch compute service */
+        std::vector<std::string> hosts;
+        /** @brief The position of each host in the hosts vector */
+        std::unordered_map<std::string, unsigned long> host_positions;
+        /** @brief The rank of each host (indexed by position) in lexicographical order of host names */
+        std::vector<unsigned long> name_ranks;
+        /** @brief The position of each host, indexed by rank */
+        std::vector<unsigned long> rank_positions;
+        /** @brief The number of available cores of each host, indexed by position */
+        std::vector<unsigned long> available_cores;
+        /** @brief Host ranks, bucketed by number of available cores */
+        std::vector<std::set<unsigned long>> ranks_by_available_cores;
+        /** @brief Host positions, bucketed by number of available cores */
+        std::vector<std::set<unsigned long>> positions_by_available_cores;
+    };
+
+}
+
+/***********************/
+/** \endcond           */
+/***********************/
+
+#endif //WRENCH_AVAILABLECORESINDEX_H
@@ -11,6 +11,7 @@
 #include "wrench/simulation/Simulation.h"
 
 #include "CONSERVATIVEBFBatchScheduler.h"
+#include "../AvailableCoresIndex.h"
 
 //#define  PRINT_SCHEDULE 1
 
@@ -121,9 +122,10 @@ namespace wrench {
         this->schedule->print();
 #endif
 
-        // For each job in the order of the batch queue:
+        // For each job in the order of the batch queue that can start earlier:
         //   - remove the job from the schedule
         //   - re-insert it as early as possible
+        // (a job that cannot start earlier would be re-inserted where it already is, so it is left alone)
 
         // Reset the time origin
         auto now = (u_int32_t)Simulation::getCurrentSimulatedDate();
@@ -133,9 +135,14 @@ namespace wrench {
         for (auto const &batch_job : this->cs->batch_queue) {
 //            WRENCH_INFO("DEALING WITH JOB %lu", batch_job->getJobID());
 
+            // Leave alone a job whose reservation cannot move
+            if (not this->schedule->canStartEarlier(batch_job)) {
+                continue;
+            }
+
             // Remove the job from the schedule
 //            WRENCH_INFO("REMOVING IT FROM SCHEDULE");
-            this->schedule->remove(batch_job->conservative_bf_start_date, batch_job->conservative_bf_expected_end_date + 100, batch_job);
+            this->schedule->remove(batch_job);
 //            this->schedule->print();
 
             // Find the earliest start time
@@ -190,7 +197,7 @@ namespace wrench {
 
         auto now = (u_int32_t)Simulation::getCurrentSimulatedDate();
         this->schedule->setTimeOrigin(now);
-        this->schedule->remove(now, batch_job->conservative_bf_expected_end_date + 100, batch_job);
+        this->schedule->remove(batch_job);
 
 #ifdef PRINT_SCHEDULE
         this->schedule->print();
@@ -253,27 +260,9 @@ namespace wrench {
         cores_per_node = Simulation::getHostNumCores(cs->available_nodes_to_cores.begin()->first);
 
         std::map<std::string, std::tuple<unsigned long, double>> resources = {};
-        std::vector<std::string> hosts_assigned = {};
-
-        unsigned long host_count = 0;
-        for (auto & available_nodes_to_core : cs->available_nodes_to_cores) {
-            if (available_nodes_to_core.second >= cores_per_node) {
-                //Remove that many cores from the available_nodes_to_core
-                available_nodes_to_core.second -= cores_per_node;
-                hosts_assigned.push_back(available_nodes_to_core.first);
-                resources.insert(std::make_pair(available_nodes_to_core.first, std::make_tuple(cores_per_node, ram_per_node)));
-                if (++host_count >= num_nodes) {
-                    break;
-                }
-            }
-        }
-        if (resources.size() < num_nodes) {
-            resources = {};
-            std::vector<std::string>::iterator vector_it;
-            // undo!
-            for (vector_it = hosts_assigned.begin(); vector_it != hosts_assigned.end(); vector_it++) {
-                cs->available_nodes_to_cores[*vector_it] += cores_per_node;
-            }
+        for (auto const &h : cs->available_cores_index->findFirstFit(num_nodes, cores_per_node)) {
+            cs->allocateCoresOnHost(h, cores_per_node);
+            resources.insert(std::make_pair(h, std::make_tuple(cores_per_node, ram_per_node)));
         }
 
         return resources;
@@ -10,39 +10,25 @@
 #include <iostream>
 #include <set>
 #include "NodeAvailabilityTimeLine.h"
-#include <boost/icl/interval_map.hpp>
 #include <wrench/services/compute/batch/BatchJob.h>
 
 namespace wrench {
 
-    /**
-     * @brief Overloaded operator
-     * @param left: left-hand side
-     * @param right: right-hand side
-     * @return
-     */
-    bool operator==(const BatchJobSet &left, const BatchJobSet &right) {
-        return left.jobs == right.jobs;
-    }
-
     /**
      * @brief Constructor
      * @param max_num_nodes: number of nodes on the platform
      */
     NodeAvailabilityTimeLine::NodeAvailabilityTimeLine(unsigned long max_num_nodes) : max_num_nodes(max_num_nodes) {
-        std::set<BatchJob *> empty_set;
-        this->availability_timeslots += make_pair(boost::icl::interval<u_int32_t>::right_open(0, UINT32_MAX),
-                                                  BatchJobSet());
     }
 
     /**
      * @brief Method to clear the node availability timeline
      */
     void NodeAvailabilityTimeLine::clear() {
-        this->availability_timeslots.clear();
-        std::set<BatchJob *> empty_set;
-        this->availability_timeslots += make_pair(boost::icl::interval<u_int32_t>::right_open(0, UINT32_MAX),
-                                                  BatchJobSet());
+        this->utilization.clear();
+        this->reservations.clear();
+        this->reservation_starts.clear();
+        this->time_origin = 0;
     }
 
     /**
@@ -50,24 +36,7 @@ namespace wrench {
      * @param t: a date
      */
     void NodeAvailabilityTimeLine::setTimeOrigin(u_int32_t t) {
-
-        while (true) {
-            auto ts = this->availability_timeslots.begin();
-            if (ts->first.lower() >= t) {
-                return;
-            } else if (ts->first.upper() <= t) {
-                this->availability_timeslots.erase(ts);
-                continue;
-            } else {
-                u_int32_t new_left = t;
-                u_int32_t new_right = ts->first.upper();
-                BatchJobSet job_set = ts->second;
-                this->availability_timeslots.erase(ts);
-                this->availability_timeslots += make_pair(
-                        boost::icl::interval<u_int32_t>::right_open(new_left, new_right), job_set);
-                return;
-            }
-        }
+        this->time_origin = std::max(this->time_origin, t);
     }
 
     /**
@@ -75,10 +44,15 @@ namespace wrench {
      */
     void NodeAvailabilityTimeLine::print() {
         std::cerr << "------ SCHEDULE -----\n";
-        for (auto &availability_timeslot : this->availability_timeslots) {
-            std::cerr << availability_timeslot.first <<  "(" << availability_timeslot.second.num_nodes_utilized << ") | ";
-            for (auto const &j  : availability_timeslot.second.jobs) {
-                std::cerr << j->getJobID() << "("<< j->getRequestedNumNodes() << ") ";
+        auto steps = this->utilization.getSteps(this->time_origin);
+        for (unsigned long i = 0; i < steps.size(); i++) {
+            u_int32_t lower = steps[i].first;
+            u_int32_t upper = (i + 1 < steps.size()) ? steps[i + 1].first : UINT32_MAX;
+            std::cerr << "[" << lower << "," << upper << ")(" << steps[i].second << ") | ";
+            for (auto const &r : this->reservations) {
+                if ((r.second.start <= lower) and (lower < r.second.end)) {
+                    std::cerr << r.first << "(" << r.second.job->getRequestedNumNodes() << ") ";
+                }
             }
             std::cerr << "\n";
         }
@@ -86,23 +60,31 @@ namespace wrench {
     }
 
     /**
-     * @brief Method to update the node availability timeline
-     * @param add: true if we're adding, false otherwise
+     * @brief Method to add a job reservation to the node availability timeline (replacing
+     *        the job's previous reservation, if any)
      * @param start: the start date
      * @param end: the end date
      * @param job: the batch job
      */
-    void NodeAvailabilityTimeLine::update(bool add, u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob> job) {
-        auto job_set = new BatchJobSet();
-        job_set->add(job);
+    void NodeAvailabilityTimeLine::add(u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob> job) {
+        this->remove(job);
+        this->reservations[job->getJobID()] = {start, end, job};
+        this->reservation_starts.insert(std::make_pair(start, job->getJobID()));
+        this->utilization.add(start, end, (long) job->getRequestedNumNodes());
+    }
 
-        if (add) {
-            this->availability_timeslots +=
-                    make_pair(boost::icl::interval<u_int32_t>::right_open(start, end), *job_set);
-        } else {
-            this->availability_timeslots -=
-                    make_pair(boost::icl::interval<u_int32_t>::right_open(start, end), *job_set);
+    /**
+     * @brief Method to remove a job reservation from the node availability timeline
+     * @param job: the batch job
+     */
+    void NodeAvailabilityTimeLine::remove(std::shared_ptr<BatchJob> job) {
+        auto it = this->reservations.find(job->getJobID());
+        if (it == this->reservations.end()) {
+            return;
         }
+        this->utilization.add(it->second.start, it->second.end, -(long) job->getRequestedNumNodes());
+        this->reservation_starts.erase(std::make_pair(it->second.start, it->first));
+        this->reservations.erase(it);
     }
 
     /**
@@ -112,36 +94,56 @@ namespace wrench {
      * @return a date
      */
     u_int32_t NodeAvailabilityTimeLine::findEarliestStartTime(uint32_t duration, unsigned long num_nodes) {
+        if (num_nodes > this->max_num_nodes) {
+            return UINT32_MAX;
+        }
+        return this->utilization.findEarliestFit(this->time_origin, duration,
+                                                 (long) (this->max_num_nodes - num_nodes));
+    }
 
+    /**
+     * @brief Method to determine whether a job's reservation could start earlier if the job
+     *        were removed and re-inserted as early as possible (the timeline is not modified)
+     *
+     * @details A window that starts before the reservation either ends by the reservation's
+     *          start, or overlaps the reservation and thus contains the date just before it,
+     *          where the job does not use any node. So the job can start earlier
+     *          if and only if it can be slid back by one time unit, or if a window that
+     *          fits it ends by its current start date.
+     *
+     * @param job: the batch job
+     * @return true if the job's reservation could start earlier, false otherwise
+     */
+    bool NodeAvailabilityTimeLine::canStartEarlier(std::shared_ptr<BatchJob> job) {
+        auto it = this->reservations.find(job->getJobID());
+        if ((it == this->reservations.end()) or (it->second.start <= this->time_origin)) {
+            return false;
+        }
+        auto const &r = it->second;
+        auto num_nodes = job->getRequestedNumNodes();
+        if (num_nodes > this->max_num_nodes) {
+            return false;
+        }
+        auto threshold = (long) (this->max_num_nodes - num_nodes);
 
-        uint32_t start_time = UINT32_MAX;
-        uint32_t remaining_duration = duration;
-
-        for (auto &availability_timeslot : this->availability_timeslots) {
-            unsigned long available_nodes = this->max_num_nodes - availability_timeslot.second.num_nodes_utilized;
-
-            // Nope!
-            if (available_nodes < num_nodes) {
-                start_time = UINT32_MAX;
-                continue;
-            }
-            u_int32_t interval_length = availability_timeslot.first.upper() - availability_timeslot.first.lower();
+        // Can the job be slid back by one time unit?
+        if (this->utilization.getUtilization(r.start - 1) <= threshold) {
+            return true;
+        }
 
-            // Yes!
-            if (interval_length >= remaining_duration) {
-                if (start_time == UINT32_MAX) {
-                    start_time = availability_timeslot.first.lower();
-                }
-                break;
-            }
+        // Is there a window that fits the job and ends by its current start date?
+        u_int32_t duration = r.end - r.start;
+        auto est = this->utilization.findEarliestFit(this->time_origin, duration, threshold);
+        return (est < r.start) and ((u_int64_t) est + duration <= r.start);
+    }
 
-            // Maybe!
-            remaining_duration -= interval_length;
-            if (start_time == UINT32_MAX) {
-                start_time = availability_timeslot.first.lower();
-            }
-        }
-        return start_time;
+    /**
+     * @brief Get the number of nodes that are available at the time origin
+     * @return a number of nodes
+     */
+    unsigned long NodeAvailabilityTimeLine::getNumAvailableNodes() {
+        long used = this->utilization.getUtilization(this->time_origin);
+        return (used >= (long) this->max_num_nodes) ? 0 : this->max_num_nodes - (unsigned long) used;
     }
 
     /**
@@ -150,8 +152,14 @@ namespace wrench {
      */
     std::set<std::shared_ptr<BatchJob>> NodeAvailabilityTimeLine::getJobsInFirstSlot() {
         std::set<std::shared_ptr<BatchJob>> to_return;
-        for (auto const &j : (*(this->availability_timeslots.begin())).second.jobs) {
-            to_return.insert(j);
+        for (auto const &s : this->reservation_starts) {
+            if (s.first > this->time_origin) {
+                break;
+            }
+            auto const &r = this->reservations[s.second];
+            if (r.end > this->time_origin) {
+                to_return.insert(r.job);
+            }
         }
         return to_return;
     }
@@ -10,9 +10,11 @@
 #ifndef WRENCH_NODEAVAILABILITYTIMELINE_H
 #define WRENCH_NODEAVAILABILITYTIMELINE_H
 
+#include <memory>
+#include <set>
+#include <unordered_map>
 #include <vector>
-#include <boost/icl/interval_map.hpp>
-#include "BatchJobSet.h"
+#include "UtilizationProfile.h"
 
 /***********************/
 /** \cond              */
@@ -24,26 +26,43 @@ namespace wrench {
     class BatchJob;
 
     /**
-     * @brief A class that implements a node availability time line abstraction
+     * @brief A class that implements a node availability time line abstraction, i.e.,
+     *        a set of (non-preemptible) node reservations over time
      */
     class NodeAvailabilityTimeLine {
 
     public:
         explicit NodeAvailabilityTimeLine(unsigned long max_num_nodes);
         void setTimeOrigin(u_int32_t t);
-        void add(u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob>job) { update(true, start, end, job);}
-        void remove(u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob> job) { update(false, start, end, job);}
+        void add(u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob> job);
+        void remove(std::shared_ptr<BatchJob> job);
         void clear();
         void print();
         std::set<std::shared_ptr<BatchJob>> getJobsInFirstSlot();
         u_int32_t findEarliestStartTime(uint32_t duration, unsigned long num_nodes);
+        bool canStartEarlier(std::shared_ptr<BatchJob> job);
+        unsigned long getNumAvailableNodes();
 
     private:
-        unsigned long max_num_nodes;
-        boost::icl::interval_map<u_int32_t, BatchJobSet, boost::icl::partial_enricher> availability_timeslots;
+        /** @brief A reservation of nodes for a job */
+        struct Reservation {
+            /** @brief The start date */
+            u_int32_t start;
+            /** @brief The end date (excluded) */
+            u_int32_t end;
+            /** @brief The job */
+            std::shared_ptr<BatchJob> job;
+        };
 
-        void update(bool add, u_int32_t start, u_int32_t end, std::shared_ptr<BatchJob>job);
+        unsigned long max_num_nodes;
+        u_int32_t time_origin = 0;
 
+        /** @brief The number of utilized nodes over time */
+        UtilizationProfile utilization;
+        /** @brief The reservations, indexed by job ID */
+        std::unordered_map<unsigned long, Reservation> reservations;
+        /** @brief The <start date, job ID> pairs of all reservations, sorted */
+        std::set<std::pair<u_int32_t, unsigned long>> reservation_starts;
     };
 
 }
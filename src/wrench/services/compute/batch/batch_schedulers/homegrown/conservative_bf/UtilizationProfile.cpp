@@ -0,0 +1,281 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+#include <climits>
+
+#include "UtilizationProfile.h"
+
+/** @brief The (exclusive) upper bound of the profile's date range */
+#define PROFILE_END (((uint64_t) UINT32_MAX) + 1)
+
+namespace wrench {
+
+    /**
+     * @brief Constructor (the utilization is initially zero everywhere)
+     */
+    UtilizationProfile::UtilizationProfile() {
+        this->clear();
+    }
+
+    /**
+     * @brief Reset the utilization to zero everywhere
+     */
+    void UtilizationProfile::clear() {
+        this->nodes.clear();
+        this->free_nodes.clear();
+        this->num_used_nodes = 0;
+        this->newNode(0);
+    }
+
+    /**
+     * @brief Get the number of nodes in the segment tree
+     * @return a number of nodes
+     */
+    unsigned long UtilizationProfile::getNumTreeNodes() {
+        return this->num_used_nodes;
+    }
+
+    /**
+     * @brief Allocate a segment tree node
+     * @param value: the node's (uniform) utilization
+     * @return the node's index
+     */
+    int UtilizationProfile::newNode(long value) {
+        int node;
+        if (not this->free_nodes.empty()) {
+            node = this->free_nodes.back();
+            this->free_nodes.pop_back();
+        } else {
+            node = (int) this->nodes.size();
+            this->nodes.emplace_back();
+        }
+        this->nodes[node] = {value, value, 0, -1, -1};
+        this->num_used_nodes++;
+        return node;
+    }
+
+    /**
+     * @brief Free a segment tree node
+     * @param node: the node's index
+     */
+    void UtilizationProfile::freeNode(int node) {
+        this->free_nodes.push_back(node);
+        this->num_used_nodes--;
+    }
+
+    /**
+     * @brief Make sure a node has children, and push its pending update down to them
+     * @param node: the node's index
+     */
+    void UtilizationProfile::split(int node) {
+        if (this->nodes[node].left == -1) {
+            long value = this->nodes[node].min;
+            int left = this->newNode(value);
+            int right = this->newNode(value);
+            this->nodes[node].left = left;
+            this->nodes[node].right = right;
+            this->nodes[node].lazy = 0;
+        } else if (this->nodes[node].lazy != 0) {
+            long lazy = this->nodes[node].lazy;
+            for (int child : {this->nodes[node].left, this->nodes[node].right}) {
+                this->nodes[child].min += lazy;
+                this->nodes[child].max += lazy;
+                this->nodes[child].lazy += lazy;
+            }
+            this->nodes[node].lazy = 0;
+        }
+    }
+
+    /**
+     * @brief Add to the utilization over a date range
+     * @param start: the range's start date
+     * @param end: the range's end date (excluded)
+     * @param amount: the amount to add (can be negative)
+     */
+    void UtilizationProfile::add(u_int32_t start, u_int32_t end, long amount) {
+        if ((start >= end) or (amount == 0)) {
+            return;
+        }
+        this->add(0, 0, PROFILE_END, start, end, amount);
+    }
+
+    /**
+     * @brief Recursive helper for add()
+     */
+    void UtilizationProfile::add(int node, uint64_t lo, uint64_t hi, uint64_t start, uint64_t end, long amount) {
+        if ((end <= lo) or (hi <= start)) {
+            return;
+        }
+        if ((start <= lo) and (hi <= end)) {
+            this->nodes[node].min += amount;
+            this->nodes[node].max += amount;
+            this->nodes[node].lazy += amount;
+            return;
+        }
+
+        this->split(node);
+        uint64_t mid = lo + (hi - lo) / 2;
+        int left = this->nodes[node].left;
+        int right = this->nodes[node].right;
+        this->add(left, lo, mid, start, end, amount);
+        this->add(right, mid, hi, start, end, amount);
+
+        // Prune children that have become uniform and equal
+        if ((this->nodes[left].left == -1) and (this->nodes[right].left == -1) and
+            (this->nodes[left].min == this->nodes[right].min)) {
+            this->nodes[node].min = this->nodes[node].max = this->nodes[left].min;
+            this->nodes[node].left = this->nodes[node].right = -1;
+            this->freeNode(left);
+            this->freeNode(right);
+        } else {
+            this->nodes[node].min = std::min(this->nodes[left].min, this->nodes[right].min);
+            this->nodes[node].max = std::max(this->nodes[left].max, this->nodes[right].max);
+        }
+    }
+
+    /**
+     * @brief Get the utilization at a date
+     * @param date: a date
+     * @return a utilization level
+     */
+    long UtilizationProfile::getUtilization(u_int32_t date) {
+        int node = 0;
+        uint64_t lo = 0, hi = PROFILE_END;
+        while (this->nodes[node].left != -1) {
+            this->split(node);
+            uint64_t mid = lo + (hi - lo) / 2;
+            if (date < mid) {
+                node = this->nodes[node].left;
+                hi = mid;
+            } else {
+                node = this->nodes[node].right;
+                lo = mid;
+            }
+        }
+        return this->nodes[node].min;
+    }
+
+    /**
+     * @brief Find the first date at which the utilization is above a threshold
+     * @param from: the date from which to search
+     * @param threshold: the threshold
+     * @return a date, or UINT32_MAX if none
+     */
+    u_int32_t UtilizationProfile::findFirstAbove(u_int32_t from, long threshold) {
+        return (u_int32_t) std::min<uint64_t>(UINT32_MAX, this->findFirstAbove(0, 0, PROFILE_END, from, threshold));
+    }
+
+    /**
+     * @brief Recursive helper for findFirstAbove()
+     */
+    uint64_t UtilizationProfile::findFirstAbove(int node, uint64_t lo, uint64_t hi, uint64_t from, long threshold) {
+        if ((hi <= from) or (this->nodes[node].max <= threshold)) {
+            return PROFILE_END;
+        }
+        if (this->nodes[node].left == -1) {
+            return std::max(lo, from);
+        }
+        this->split(node);
+        uint64_t mid = lo + (hi - lo) / 2;
+        uint64_t found = this->findFirstAbove(this->nodes[node].left, lo, mid, from, threshold);
+        if (found != PROFILE_END) {
+            return found;
+        }
+        return this->findFirstAbove(this->nodes[node].right, mid, hi, from, threshold);
+    }
+
+    /**
+     * @brief Find the first date at which the utilization is at most a threshold
+     * @param from: the date from which to search
+     * @param threshold: the threshold
+     * @return a date, or UINT32_MAX if none
+     */
+    u_int32_t UtilizationProfile::findFirstAtMost(u_int32_t from, long threshold) {
+        return (u_int32_t) std::min<uint64_t>(UINT32_MAX, this->findFirstAtMost(0, 0, PROFILE_END, from, threshold));
+    }
+
+    /**
+     * @brief Recursive helper for findFirstAtMost()
+     */
+    uint64_t UtilizationProfile::findFirstAtMost(int node, uint64_t lo, uint64_t hi, uint64_t from, long threshold) {
+        if ((hi <= from) or (this->nodes[node].min > threshold)) {
+            return PROFILE_END;
+        }
+        if (this->nodes[node].left == -1) {
+            return std::max(lo, from);
+        }
+        this->split(node);
+        uint64_t mid = lo + (hi - lo) / 2;
+        uint64_t found = this->findFirstAtMost(this->nodes[node].left, lo, mid, from, threshold);
+        if (found != PROFILE_END) {
+            return found;
+        }
+        return this->findFirstAtMost(this->nodes[node].right, mid, hi, from, threshold);
+    }
+
+    /**
+     * @brief Find the earliest date from which the utilization stays at most a threshold
+     *        for some duration. Each iteration skips a whole range over the threshold, so the
+     *        cost is O(log(UINT32_MAX)) per such range between the initial date and the result.
+     * @param from: the date from which to search
+     * @param duration: the duration
+     * @param threshold: the threshold
+     * @return a date, or UINT32_MAX if none
+     */
+    u_int32_t UtilizationProfile::findEarliestFit(u_int32_t from, u_int32_t duration, long threshold) {
+        u_int32_t candidate = from;
+        while (true) {
+            u_int32_t blocked = this->findFirstAbove(candidate, threshold);
+            if (blocked != candidate) {
+                if ((blocked == UINT32_MAX) or (blocked - candidate >= duration)) {
+                    return candidate;
+                }
+            }
+            candidate = this->findFirstAtMost(blocked, threshold);
+            if (candidate == UINT32_MAX) {
+                return UINT32_MAX;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the utilization profile as a list of steps
+     * @param from: the date from which to list steps
+     * @return a list of <date, utilization> pairs, sorted by date, each giving the utilization
+     *         from that date until the next one
+     */
+    std::vector<std::pair<u_int32_t, long>> UtilizationProfile::getSteps(u_int32_t from) {
+        std::vector<std::pair<u_int32_t, long>> steps;
+        this->getSteps(0, 0, PROFILE_END, from, steps);
+        return steps;
+    }
+
+    /**
+     * @brief Recursive helper for getSteps()
+     */
+    void UtilizationProfile::getSteps(int node, uint64_t lo, uint64_t hi, uint64_t from,
+                                      std::vector<std::pair<u_int32_t, long>> &steps) {
+        if ((hi <= from) or (std::max(lo, from) >= UINT32_MAX)) {
+            return;
+        }
+        if (this->nodes[node].left == -1) {
+            long value = this->nodes[node].min;
+            if (steps.empty() or (steps.back().second != value)) {
+                steps.emplace_back((u_int32_t) std::max(lo, from), value);
+            }
+            return;
+        }
+        this->split(node);
+        uint64_t mid = lo + (hi - lo) / 2;
+        this->getSteps(this->nodes[node].left, lo, mid, from, steps);
+        this->getSteps(this->nodes[node].right, mid, hi, from, steps);
+    }
+
+}
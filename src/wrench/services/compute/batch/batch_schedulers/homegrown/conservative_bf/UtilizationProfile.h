@@ -0,0 +1,81 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_UTILIZATIONPROFILE_H
+#define WRENCH_UTILIZATIONPROFILE_H
+
+#include <cstdint>
+#include <sys/types.h>
+#include <utility>
+#include <vector>
+
+/***********************/
+/** \cond              */
+/***********************/
+
+namespace wrench {
+
+    /**
+     * @brief A class that implements a resource utilization profile over time, i.e., a function
+     *        from dates in [0, UINT32_MAX) to utilization levels. It is stored as a dynamic segment tree
+     *        (with lazy range updates) so that range updates and first-fit queries take O(log(UINT32_MAX))
+     *        time. Sub-trees that become uniform are pruned, so that the size of the tree stays
+     *        proportional to the number of distinct dates at which the utilization changes.
+     */
+    class UtilizationProfile {
+
+    public:
+        UtilizationProfile();
+
+        void add(u_int32_t start, u_int32_t end, long amount);
+        void clear();
+
+        long getUtilization(u_int32_t date);
+        u_int32_t findFirstAbove(u_int32_t from, long threshold);
+        u_int32_t findFirstAtMost(u_int32_t from, long threshold);
+        u_int32_t findEarliestFit(u_int32_t from, u_int32_t duration, long threshold);
+        std::vector<std::pair<u_int32_t, long>> getSteps(u_int32_t from);
+
+        unsigned long getNumTreeNodes();
+
+    private:
+        /** @brief A segment tree node (a node without children has the same utilization over its whole range) */
+        struct Node {
+            /** @brief The minimum utilization over the node's range */
+            long min;
+            /** @brief The maximum utilization over the node's range */
+            long max;
+            /** @brief The pending update for the node's children */
+            long lazy;
+            /** @brief The index of the left child (-1 if none) */
+            int left;
+            /** @brief The index of the right child (-1 if none) */
+            int right;
+        };
+
+        std::vector<Node> nodes;
+        std::vector<int> free_nodes;
+        unsigned long num_used_nodes;
+
+        int newNode(long value);
+        void freeNode(int node);
+        void split(int node);
+        void add(int node, uint64_t lo, uint64_t hi, uint64_t start, uint64_t end, long amount);
+        uint64_t findFirstAbove(int node, uint64_t lo, uint64_t hi, uint64_t from, long threshold);
+        uint64_t findFirstAtMost(int node, uint64_t lo, uint64_t hi, uint64_t from, long threshold);
+        void getSteps(int node, uint64_t lo, uint64_t hi, uint64_t from, std::vector<std::pair<u_int32_t, long>> &steps);
+    };
+
+}
+
+/***********************/
+/** \endcond           */
+/***********************/
+
+#endif //WRENCH_UTILIZATIONPROFILE_H
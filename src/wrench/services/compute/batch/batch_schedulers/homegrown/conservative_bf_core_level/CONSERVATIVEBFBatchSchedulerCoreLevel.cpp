@@ -11,6 +11,7 @@
 #include "wrench/simulation/Simulation.h"
 
 #include "CONSERVATIVEBFBatchSchedulerCoreLevel.h"
+#include "../AvailableCoresIndex.h"
 
 //#define  PRINT_SCHEDULE 1
 
@@ -264,27 +265,9 @@ namespace wrench {
 //        cores_per_node = Simulation::getHostNumCores(cs->available_nodes_to_cores.begin()->first);
 
         std::map<std::string, std::tuple<unsigned long, double>> resources = {};
-        std::vector<std::string> hosts_assigned = {};
-
-        unsigned long host_count = 0;
-        for (auto & available_nodes_to_core : cs->available_nodes_to_cores) {
-            if (available_nodes_to_core.second >= cores_per_node) {
-                //Remove that many cores from the available_nodes_to_core
-                available_nodes_to_core.second -= cores_per_node;
-                hosts_assigned.push_back(available_nodes_to_core.first);
-                resources.insert(std::make_pair(available_nodes_to_core.first, std::make_tuple(cores_per_node, ram_per_node)));
-                if (++host_count >= num_nodes) {
-                    break;
-                }
-            }
-        }
-        if (resources.size() < num_nodes) {
-            resources = {};
-            std::vector<std::string>::iterator vector_it;
-            // undo!
-            for (vector_it = hosts_assigned.begin(); vector_it != hosts_assigned.end(); vector_it++) {
-                cs->available_nodes_to_cores[*vector_it] += cores_per_node;
-            }
+        for (auto const &h : cs->available_cores_index->findFirstFit(num_nodes, cores_per_node)) {
+            cs->allocateCoresOnHost(h, cores_per_node);
+            resources.insert(std::make_pair(h, std::make_tuple(cores_per_node, ram_per_node)));
         }
 
         return resources;
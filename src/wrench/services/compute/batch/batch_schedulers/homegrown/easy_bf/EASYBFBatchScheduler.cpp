@@ -0,0 +1,244 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/logging/TerminalOutput.h"
+#include "wrench/simulation/Simulation.h"
+
+#include "EASYBFBatchScheduler.h"
+#include "../AvailableCoresIndex.h"
+
+//#define  PRINT_SCHEDULE 1
+
+WRENCH_LOG_CATEGORY(wrench_core_easy_bf_batch_scheduler, "Log category for EASYBFBatchScheduler");
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     * @param cs: The BatchComputeService for which this scheduler is working
+     */
+    EASYBFBatchScheduler::EASYBFBatchScheduler(BatchComputeService *cs) : HomegrownBatchScheduler(cs) {
+        this->schedule = std::unique_ptr<NodeAvailabilityTimeLine>(new NodeAvailabilityTimeLine(cs->total_num_of_nodes));
+    }
+
+    /**
+     * @brief Method to process a job submission
+     * @param batch_job: the newly submitted batch job
+     */
+    void EASYBFBatchScheduler::processJobSubmission(std::shared_ptr<BatchJob> batch_job) {
+        // Nothing to do, as queued jobs are only looked at in processQueuedJobs()
+        WRENCH_INFO("Enqueuing a new batch job, %lu, that needs %lu nodes",
+                    batch_job->getJobID(), batch_job->getRequestedNumNodes());
+    }
+
+    /**
+     * @brief Method to schedule (possibly) the next jobs to be scheduled
+     */
+    void EASYBFBatchScheduler::processQueuedJobs() {
+
+        if (this->cs->batch_queue.empty()) {
+            return;
+        }
+
+        // Update the time origin
+        auto now = (u_int32_t) Simulation::getCurrentSimulatedDate();
+        this->schedule->setTimeOrigin(now);
+
+        // Go through the batch queue, starting all jobs that can start now without delaying the
+        // reservation of the first job that cannot (the "head" job)
+        std::shared_ptr<BatchJob> head_job = nullptr;
+        std::vector<std::pair<std::shared_ptr<BatchJob>, std::map<std::string, std::tuple<unsigned long, double>>>> jobs_to_start;
+
+        for (auto const &batch_job : this->cs->batch_queue) {
+            // No job can start if all nodes are in use
+            if (this->schedule->getNumAvailableNodes() == 0) {
+                break;
+            }
+
+            auto duration = (u_int32_t) batch_job->getRequestedTime();
+            auto est = this->schedule->findEarliestStartTime(duration, batch_job->getRequestedNumNodes());
+
+            if (est != now) {
+                // Only the head job gets a reservation
+                if ((head_job == nullptr) and (est != UINT32_MAX)) {
+                    WRENCH_INFO("Reserving nodes for batch job %lu at time %u", batch_job->getJobID(), est);
+                    this->schedule->add(est, est + duration, batch_job);
+                    head_job = batch_job;
+                }
+                continue;
+            }
+
+            // Find on which resources to actually run the job
+            auto resources = this->scheduleOnHosts(batch_job->getRequestedNumNodes(),
+                                                   batch_job->getRequestedCoresPerNode(),
+                                                   ComputeService::ALL_RAM);
+            if (resources.empty()) {
+                // Hmmm... we don't have the resources right now... we should get an update soon....
+                break;
+            }
+
+            this->schedule->add(now, now + duration, batch_job);
+            jobs_to_start.emplace_back(batch_job, resources);
+        }
+
+        // The head job's reservation will be re-computed next time around
+        if (head_job != nullptr) {
+            this->schedule->remove(head_job);
+        }
+
+#ifdef PRINT_SCHEDULE
+        this->schedule->print();
+#endif
+
+        for (auto const &j : jobs_to_start) {
+            auto batch_job = j.first;
+
+            WRENCH_INFO("Starting batch job %lu ", batch_job->getJobID());
+
+            // Remove the job from the batch queue
+            this->cs->removeJobFromBatchQueue(batch_job);
+
+            // Add it to the running list
+            this->cs->running_jobs.insert(batch_job);
+
+            // Start it!
+            this->cs->startJob(j.second, batch_job->getWorkflowJob(), batch_job, batch_job->getRequestedNumNodes(),
+                               batch_job->getRequestedTime(), batch_job->getRequestedCoresPerNode());
+        }
+    }
+
+    /**
+     * @brief Method to process a job completion
+     * @param batch_job: the job that completed
+     */
+    void EASYBFBatchScheduler::processJobCompletion(std::shared_ptr<BatchJob> batch_job) {
+        WRENCH_INFO("Notified of completion of batch job, %lu", batch_job->getJobID());
+
+        this->schedule->setTimeOrigin((u_int32_t) Simulation::getCurrentSimulatedDate());
+        this->schedule->remove(batch_job);
+    }
+
+    /**
+    * @brief Method to process a job termination
+    * @param batch_job: the job that was terminated
+    */
+    void EASYBFBatchScheduler::processJobTermination(std::shared_ptr<BatchJob> batch_job) {
+        // Just like a job Completion to me!
+        this->processJobCompletion(batch_job);
+    }
+
+    /**
+    * @brief Method to process a job failure
+    * @param batch_job: the job that failed
+    */
+    void EASYBFBatchScheduler::processJobFailure(std::shared_ptr<BatchJob> batch_job) {
+        // Just like a job Completion to me!
+        this->processJobCompletion(batch_job);
+    }
+
+    /**
+     * @brief Method to figure out on which actual resources a job could be scheduled right now
+     * @param num_nodes: number of nodes
+     * @param cores_per_node: number of cores per node
+     * @param ram_per_node: amount of RAM
+     * @return a host:<core,RAM> map
+     *
+     */
+    std::map<std::string, std::tuple<unsigned long, double>>
+    EASYBFBatchScheduler::scheduleOnHosts(unsigned long num_nodes, unsigned long cores_per_node, double ram_per_node) {
+
+        if (ram_per_node == ComputeService::ALL_RAM) {
+            ram_per_node = Simulation::getHostMemoryCapacity(cs->available_nodes_to_cores.begin()->first);
+        }
+        if (cores_per_node == ComputeService::ALL_CORES) {
+            cores_per_node = Simulation::getHostNumCores(cs->available_nodes_to_cores.begin()->first);
+        }
+
+        if (ram_per_node > Simulation::getHostMemoryCapacity(cs->available_nodes_to_cores.begin()->first)) {
+            throw std::runtime_error("EASYBFBatchScheduler::scheduleOnHosts(): Asking for too much RAM per host");
+        }
+        if (num_nodes > cs->available_nodes_to_cores.size()) {
+            throw std::runtime_error("EASYBFBatchScheduler::scheduleOnHosts(): Asking for too many hosts");
+        }
+        if (cores_per_node > Simulation::getHostNumCores(cs->available_nodes_to_cores.begin()->first)) {
+            throw std::runtime_error("EASYBFBatchScheduler::scheduleOnHosts(): Asking for too many cores per host (asking  for " +
+                                     std::to_string(cores_per_node) + " but hosts have " +
+                                     std::to_string(Simulation::getHostNumCores(cs->available_nodes_to_cores.begin()->first)) + "cores)");
+        }
+
+        // IMPORTANT: We always give all cores to a job on a node!
+        cores_per_node = Simulation::getHostNumCores(cs->available_nodes_to_cores.begin()->first);
+
+        std::map<std::string, std::tuple<unsigned long, double>> resources = {};
+        for (auto const &h : cs->available_cores_index->findFirstFit(num_nodes, cores_per_node)) {
+            cs->allocateCoresOnHost(h, cores_per_node);
+            resources.insert(std::make_pair(h, std::make_tuple(cores_per_node, ram_per_node)));
+        }
+
+        return resources;
+    }
+
+    /**
+     * @brief Method to obtain start time estimates. Since only the head of the queue holds
+     *        a reservation, the estimates assume that each queued job starts no later than
+     *        its earliest possible start time in queue order (which is what conservative
+     *        backfilling would guarantee), and are thus pessimistic.
+     * @param set_of_jobs: a set of job specs
+     * @return map of estimates
+     */
+    std::map<std::string, double> EASYBFBatchScheduler::getStartTimeEstimates(
+            std::set<std::tuple<std::string, unsigned long, unsigned long, double>> set_of_jobs) {
+        std::map<std::string, double> to_return;
+
+        for (auto const &j : set_of_jobs) {
+            if (std::get<3>(j) > UINT32_MAX) {
+                throw std::runtime_error("EASYBFBatchScheduler::getStartTimeEstimates(): job duration too large");
+            }
+        }
+
+        this->schedule->setTimeOrigin((u_int32_t) Simulation::getCurrentSimulatedDate());
+
+        // Tentatively reserve nodes for all queued jobs, in queue order
+        std::vector<std::shared_ptr<BatchJob>> reserved_jobs;
+        for (auto const &batch_job : this->cs->batch_queue) {
+            auto duration = (u_int32_t) batch_job->getRequestedTime();
+            auto est = this->schedule->findEarliestStartTime(duration, batch_job->getRequestedNumNodes());
+            if (est != UINT32_MAX) {
+                this->schedule->add(est, est + duration, batch_job);
+                reserved_jobs.push_back(batch_job);
+            }
+        }
+
+        for (auto const &j : set_of_jobs) {
+            const std::string &id = std::get<0>(j);
+            unsigned long num_nodes = std::get<1>(j);
+            unsigned long num_cores_per_host = std::get<2>(j);
+            auto duration = (u_int32_t) (std::get<3>(j));
+
+            if (num_cores_per_host > this->cs->num_cores_per_node) {
+                to_return[id] = -1.0;
+                continue;
+            }
+            auto est = this->schedule->findEarliestStartTime(duration, num_nodes);
+            if (est < UINT32_MAX) {
+                to_return[id] = (double) est;
+            } else {
+                to_return[id] = -1.0;
+            }
+        }
+
+        // Undo the tentative reservations
+        for (auto const &batch_job : reserved_jobs) {
+            this->schedule->remove(batch_job);
+        }
+
+        return to_return;
+    }
+
+}
@@ -0,0 +1,61 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_EASYBFBATCHSCHEDULER_H
+#define WRENCH_EASYBFBATCHSCHEDULER_H
+
+#include <wrench/services/compute/batch/BatchComputeService.h>
+#include <wrench/services/compute/batch/batch_schedulers/homegrown/HomegrownBatchScheduler.h>
+#include <services/compute/batch/batch_schedulers/homegrown/conservative_bf/NodeAvailabilityTimeLine.h>
+
+namespace wrench {
+
+/***********************/
+/** \cond INTERNAL     */
+/***********************/
+
+    /**
+     * @brief A class that defines an EASY backfilling batch scheduler, i.e., a FCFS scheduler
+     *        in which only the job at the head of the queue holds a reservation, and
+     *        jobs further down the queue can start right away as long as they do not
+     *        delay that reservation
+     */
+    class EASYBFBatchScheduler : public HomegrownBatchScheduler {
+
+    public:
+
+        explicit EASYBFBatchScheduler(BatchComputeService *cs);
+
+        void processQueuedJobs() override;
+
+        void processJobSubmission(std::shared_ptr<BatchJob> batch_job) override;
+        void processJobFailure(std::shared_ptr<BatchJob> batch_job) override;
+        void processJobCompletion(std::shared_ptr<BatchJob> batch_job) override;
+        void processJobTermination(std::shared_ptr<BatchJob> batch_job) override;
+
+        std::map <std::string, std::tuple<unsigned long, double>> scheduleOnHosts(unsigned long, unsigned long, double) override;
+
+        std::map<std::string, double>
+        getStartTimeEstimates(std::set <std::tuple<std::string, unsigned long, unsigned long, double>> set_of_jobs) override;
+
+    private:
+
+        /** @brief The node availability timeline, which only holds running jobs (and, transiently, reservations) */
+        std::unique_ptr<NodeAvailabilityTimeLine> schedule;
+    };
+
+
+/***********************/
+/** \endcond           */
+/***********************/
+}
+
+
+
+#endif //WRENCH_EASYBFBATCHSCHEDULER_H
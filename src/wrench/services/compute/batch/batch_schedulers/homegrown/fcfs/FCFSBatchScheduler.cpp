@@ -8,6 +8,7 @@
  */
 
 #include "FCFSBatchScheduler.h"
+#include "../AvailableCoresIndex.h"
 #include "wrench/simulation/Simulation.h"
 #include "wrench/logging/TerminalOutput.h"
 #include "wrench/services/compute/batch/BatchComputeService.h"
@@ -16,6 +17,21 @@ WRENCH_LOG_CATEGORY(wrench_core_fcfs_batch_scheduler, "Log category for FCFSBatc
 
 namespace wrench {
 
+    /**
+     * @brief Constructor
+     *
+     * @param cs: the batch compute service for which this scheduler is operating
+     *
+     * @throw std::invalid_argument
+     */
+    FCFSBatchScheduler::FCFSBatchScheduler(BatchComputeService *cs) : HomegrownBatchScheduler(cs) {
+        this->host_selection_algorithm = cs->getPropertyValueAsEnum<HostSelectionAlgorithm>(
+                BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM,
+                {{"FIRSTFIT",   HostSelectionAlgorithm::FIRSTFIT},
+                 {"BESTFIT",    HostSelectionAlgorithm::BESTFIT},
+                 {"ROUNDROBIN", HostSelectionAlgorithm::ROUNDROBIN}});
+    }
+
     /**
     * @brief Overriden Method to pick the next job to schedule
     *
@@ -57,103 +73,22 @@ namespace wrench {
             throw std::runtime_error("FCFSBatchScheduler::findNextJobToSchedule(): Asking for too many cores per host");
         }
 
+        std::vector<std::string> hosts_assigned;
+        if (this->host_selection_algorithm == HostSelectionAlgorithm::FIRSTFIT) {
+            hosts_assigned = cs->available_cores_index->findFirstFit(num_nodes, cores_per_node);
+        } else if (this->host_selection_algorithm == HostSelectionAlgorithm::BESTFIT) {
+            hosts_assigned = cs->available_cores_index->findBestFit(num_nodes, cores_per_node);
+            // The BESTFIT algorithm does not specify a RAM amount
+            ram_per_node = ComputeService::ALL_RAM;
+        } else if (this->host_selection_algorithm == HostSelectionAlgorithm::ROUNDROBIN) {
+            hosts_assigned = cs->available_cores_index->findRoundRobin(num_nodes, cores_per_node,
+                                                                       this->round_robin_host_selector_idx);
+        }
+
         std::map<std::string, std::tuple<unsigned long, double>> resources = {};
-        std::vector<std::string> hosts_assigned = {};
-        auto host_selection_algorithm = this->cs->getPropertyValueAsString(BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM);
-
-        if (host_selection_algorithm == "FIRSTFIT") {
-            std::map<std::string, unsigned long>::iterator map_it;
-            unsigned long host_count = 0;
-            for (map_it = cs->available_nodes_to_cores.begin();
-                 map_it != cs->available_nodes_to_cores.end(); map_it++) {
-                if ((*map_it).second >= cores_per_node) {
-                    //Remove that many cores from the available_nodes_to_core
-                    (*map_it).second -= cores_per_node;
-                    hosts_assigned.push_back((*map_it).first);
-                    resources.insert(std::make_pair((*map_it).first, std::make_tuple(cores_per_node, ram_per_node)));
-                    if (++host_count >= num_nodes) {
-                        break;
-                    }
-                }
-            }
-            if (resources.size() < num_nodes) {
-                resources = {};
-                std::vector<std::string>::iterator vector_it;
-                for (vector_it = hosts_assigned.begin(); vector_it != hosts_assigned.end(); vector_it++) {
-                    cs->available_nodes_to_cores[*vector_it] += cores_per_node;
-                }
-            }
-        } else if (host_selection_algorithm == "BESTFIT") {
-            while (resources.size() < num_nodes) {
-                unsigned long target_slack = 0;
-                std::string target_host = "";
-                unsigned long target_num_cores = 0;
-
-                for (auto h : cs->available_nodes_to_cores) {
-                    std::string hostname = std::get<0>(h);
-                    unsigned long num_available_cores = std::get<1>(h);
-                    if (num_available_cores < cores_per_node) {
-                        continue;
-                    }
-                    unsigned long tentative_target_num_cores = std::min(num_available_cores, cores_per_node);
-                    unsigned long tentative_target_slack =
-                            num_available_cores - tentative_target_num_cores;
-
-                    if (target_host.empty() ||
-                        (tentative_target_num_cores > target_num_cores) ||
-                        ((tentative_target_num_cores == target_num_cores) &&
-                         (target_slack > tentative_target_slack))) {
-                        target_host = hostname;
-                        target_num_cores = tentative_target_num_cores;
-                        target_slack = tentative_target_slack;
-                    }
-                }
-                if (target_host.empty()) {
-                    WRENCH_INFO("Didn't find a suitable host");
-                    resources = {};
-                    std::vector<std::string>::iterator it;
-                    for (it = hosts_assigned.begin(); it != hosts_assigned.end(); it++) {
-                        cs->available_nodes_to_cores[*it] += cores_per_node;
-                    }
-                    break;
-                }
-                cs->available_nodes_to_cores[target_host] -= cores_per_node;
-                hosts_assigned.push_back(target_host);
-                resources.insert(std::make_pair(target_host, std::make_tuple(cores_per_node, ComputeService::ALL_RAM)));
-            }
-        } else if (host_selection_algorithm == "ROUNDROBIN") {
-            static unsigned long round_robin_host_selector_idx = 0;
-            unsigned long cur_host_idx = round_robin_host_selector_idx;
-            unsigned long host_count = 0;
-            do {
-                cur_host_idx = (cur_host_idx + 1) % cs->available_nodes_to_cores.size();
-                auto it = cs->compute_hosts.begin();
-                it = it + cur_host_idx;
-                std::string cur_host_name = *it;
-                unsigned long num_available_cores = cs->available_nodes_to_cores[cur_host_name];
-                if (num_available_cores >= cores_per_node) {
-                    cs->available_nodes_to_cores[cur_host_name] -= cores_per_node;
-                    hosts_assigned.push_back(cur_host_name);
-                    resources.insert(std::make_pair(cur_host_name, std::make_tuple(cores_per_node, ram_per_node)));
-                    if (++host_count >= num_nodes) {
-                        break;
-                    }
-                }
-            } while (cur_host_idx != round_robin_host_selector_idx);
-            if (resources.size() < num_nodes) {
-                resources = {};
-                std::vector<std::string>::iterator it;
-                for (it = hosts_assigned.begin(); it != hosts_assigned.end(); it++) {
-                    cs->available_nodes_to_cores[*it] += cores_per_node;
-                }
-            } else {
-                round_robin_host_selector_idx = cur_host_idx;
-            }
-        } else {
-            throw std::invalid_argument(
-                    "FCFSBatchScheduler::findNextJobToSchedule(): We don't support " + host_selection_algorithm +
-                    " as host selection algorithm"
-            );
+        for (auto const &h : hosts_assigned) {
+            cs->allocateCoresOnHost(h, cores_per_node);
+            resources.insert(std::make_pair(h, std::make_tuple(cores_per_node, ram_per_node)));
         }
 
         return resources;
@@ -162,7 +97,7 @@ namespace wrench {
     std::map<std::string, double> FCFSBatchScheduler::getStartTimeEstimates(
             std::set<std::tuple<std::string, unsigned long, unsigned long, double>> set_of_jobs) {
 
-        if (cs->getPropertyValueAsString(BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM) != "FIRSTFIT") {
+        if (this->host_selection_algorithm != HostSelectionAlgorithm::FIRSTFIT) {
             throw std::runtime_error("FCFSBatchScheduler::getStartTimeEstimates(): The fcfs sceduling algorithm can only provide start time estimates "
                                      "when the HOST_SELECTION_ALGORITHM property is set to FIRSTFIT");
         }
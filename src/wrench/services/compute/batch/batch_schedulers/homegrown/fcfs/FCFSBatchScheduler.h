@@ -26,12 +26,7 @@ namespace wrench {
 
     public:
 
-        /**
-         * @brief Constructor
-         *
-         * @param cs: the batch compute service for which this scheduler is operating
-         */
-        explicit FCFSBatchScheduler(BatchComputeService *cs) : HomegrownBatchScheduler(cs) {}
+        explicit FCFSBatchScheduler(BatchComputeService *cs);
 
         void processQueuedJobs() override;
 
@@ -46,6 +41,20 @@ namespace wrench {
         std::map <std::string, std::tuple<unsigned long, double>> scheduleOnHosts(unsigned long, unsigned long, double) override;
 
         std::map<std::string, double> getStartTimeEstimates(std::set <std::tuple<std::string, unsigned long, unsigned long, double>> set_of_jobs) override;
+
+    private:
+
+        /** @brief The supported host selection algorithms (BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM) */
+        enum class HostSelectionAlgorithm {
+            FIRSTFIT,
+            BESTFIT,
+            ROUNDROBIN
+        };
+
+        HostSelectionAlgorithm host_selection_algorithm;
+
+        /** @brief The position of the last host selected by the ROUNDROBIN algorithm */
+        unsigned long round_robin_host_selector_idx = 0;
     };
 
 }
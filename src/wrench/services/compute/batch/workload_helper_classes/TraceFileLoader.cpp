@@ -7,7 +7,13 @@
  * (at your option) any later version.
  */
 
+#include <cstring>
 #include <fstream>
+#include <thread>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "wrench/logging/TerminalOutput.h"
 #include <wrench-dev.h>
 #include <nlohmann/json.hpp>
@@ -42,6 +48,267 @@ namespace wrench {
     }
 
 
+    /**
+     * @brief What is needed to parse any line of a memory-mapped SWF trace file
+     */
+    struct SWFTraceParsingContext {
+        std::string filename;
+        bool ignore_invalid_jobs;
+        double desired_submit_time_of_first_job;
+        /** @brief The first valid submission time in the file (-1 if none) */
+        double original_submit_time_of_first_job;
+        /** @brief The line with the first valid submission time (nullptr if none) */
+        const char *original_submit_time_line;
+    };
+
+    /**
+     * @brief A chunk of a memory-mapped SWF trace file, i.e., a sequence of whole lines, along with
+     *        the jobs parsed from it
+     */
+    struct SWFTraceChunk {
+        const char *begin = nullptr;
+        const char *end = nullptr;
+
+        std::vector<unsigned long> userids;
+        std::vector<double> submit_times;
+        std::vector<double> times;
+        std::vector<double> requested_times;
+        std::vector<double> requested_rams;
+        std::vector<unsigned int> num_nodes;
+
+        /** @brief Warnings, to be printed by the loading thread (in order) */
+        std::vector<std::string> warnings;
+        /** @brief The error that stopped the parsing (empty if none) */
+        std::string error;
+    };
+
+    /**
+     * @brief Parse a numerical SWF field (like sscanf() would)
+     * @param token: the field's first character
+     * @param length: the field's length
+     * @param value: the parsed value
+     * @return true on success, false otherwise
+     */
+    template<class T>
+    static bool parseSWFField(const char *token, size_t length, T *value) {
+        // Fields are not null-terminated in the mapped file
+        char buffer[64];
+        std::string long_token;
+        const char *str = buffer;
+        if (length < sizeof(buffer)) {
+            memcpy(buffer, token, length);
+            buffer[length] = '\0';
+        } else {
+            long_token = std::string(token, length);
+            str = long_token.c_str();
+        }
+
+        char *str_end;
+        if (std::is_floating_point<T>::value) {
+            *value = (T) strtod(str, &str_end);
+        } else if (std::is_signed<T>::value) {
+            *value = (T) strtol(str, &str_end, 10);
+        } else {
+            *value = (T) strtoul(str, &str_end, 10);
+        }
+        return (str_end != str);
+    }
+
+    /**
+     * @brief Split a line of a SWF trace file into whitespace-separated fields
+     * @param line: the line's first character
+     * @param line_end: the line's end
+     * @param tokens: the fields
+     */
+    static void tokenizeSWFLine(const char *line, const char *line_end,
+                                std::vector<std::pair<const char *, size_t>> &tokens) {
+        tokens.clear();
+        const char *c = line;
+        while (c < line_end) {
+            while ((c < line_end) and isspace((unsigned char) *c)) c++;
+            const char *token = c;
+            while ((c < line_end) and not isspace((unsigned char) *c)) c++;
+            if (c > token) {
+                tokens.emplace_back(token, c - token);
+            }
+        }
+    }
+
+    /**
+     * @brief Parse a line of a SWF trace file into a job
+     * @param line: the line's first character
+     * @param tokens: the line's fields
+     * @param context: the parsing context
+     * @param chunk: the chunk in which the line is (to which the job is added)
+     * @return an error message (empty on success)
+     */
+    static std::string parseSWFLine(const char *line, const std::vector<std::pair<const char *, size_t>> &tokens,
+                                    const SWFTraceParsingContext &context, SWFTraceChunk &chunk) {
+        const std::string &filename = context.filename;
+        double time = -1, requested_time = -1, requested_ram = -1;
+        double sub_time = -1;
+        int requested_num_nodes = -1;
+        int num_nodes = -1;
+        unsigned long userid = 0;
+
+        if (tokens.size() < 10) {
+            return "TraceFileLoader::loadFromTraceFileSWF(): Seeing less than 10 fields per line in batch workload trace file '" +
+                   filename + "'";
+        }
+
+        int itemnum = 0;
+        for (auto const &token : tokens) {
+            switch (itemnum) {
+                case 0: // Job ID
+                    break;
+                case 1: // Submit time
+                    if (not parseSWFField(token.first, token.second, &sub_time)) {
+                        return "TraceFileLoader::loadFromTraceFileSWF(): Invalid submission time '" +
+                               std::string(token.first, token.second) + "' in batch workload trace file";
+                    }
+                    if (context.desired_submit_time_of_first_job >= 0) {
+                        // (before the first valid submission time, a job's own submission time is taken as the first one)
+                        bool is_before_first_submit_time = ((context.original_submit_time_line == nullptr) or
+                                                            (line < context.original_submit_time_line));
+                        sub_time += (context.desired_submit_time_of_first_job -
+                                     (is_before_first_submit_time ? sub_time : context.original_submit_time_of_first_job));
+                    }
+                    break;
+                case 2: // Wait time
+                    break;
+                case 3: // Run time
+                    //assuming flops and runtime are the same (in seconds)
+                    if (not parseSWFField(token.first, token.second, &time)) {
+                        return "TraceFileLoader::loadFromTraceFileSWF(): Invalid run time '" +
+                               std::string(token.first, token.second) + "' in batch workload trace file";
+                    }
+                    break;
+                case 4: // Number of Allocated Processors
+                    if (not parseSWFField(token.first, token.second, &num_nodes)) {
+                        return "TraceFileLoader::loadFromTraceFileSWF(): Invalid number of processors '" +
+                               std::string(token.first, token.second) + "' in batch workload trace file";
+                    }
+                    break;
+                case 5:// Average CPU time Used
+                    break;
+                case 6: // Used Memory
+                    break;
+                case 7: // Requested Number of Processors
+                    if (not parseSWFField(token.first, token.second, &requested_num_nodes)) {
+                        return "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested number of processors '" +
+                               std::string(token.first, token.second) + "' in batch workload trace file";
+                    }
+                    break;
+                case 8: // Requested time
+                    //assuming flops and runtime are the same (in seconds)
+                    if (not parseSWFField(token.first, token.second, &requested_time)) {
+                        return "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested time '" +
+                               std::string(token.first, token.second) + "' in batch workload trace file";
+                    }
+                    break;
+                case 9: // Requested memory_manager_service
+                    // In KiB
+                    if (not parseSWFField(token.first, token.second, &requested_ram)) {
+                        return "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested memory_manager_service '" +
+                               std::string(token.first, token.second) + "' in batch workload trace file";
+                    }
+                    requested_ram *= 1024.0;
+                    break;
+                case 10: // Status
+                    break;
+                case 11: // User ID
+                    if (not parseSWFField(token.first, token.second, &userid)) {
+                        return "TraceFileLoader::loadFromTraceFileSWF(): Invalid userid '" +
+                               std::string(token.first, token.second) + "' in batch workload trace file";
+                    }
+                    break;
+                case 12: // Group ID
+                case 13: // Executable number
+                case 14: // Queue number
+                case 15: // Partition number
+                case 16: // Preceding job number
+                case 17: // Think time
+                    break;
+                default:
+                    return "TraceFileLoader::loadFromTraceFileSWF(): Unknown batch workload trace file column, maybe there are more than 18 columns?";
+            }
+            itemnum++;
+        }
+
+        // Fix/check values
+        if (requested_time < 0) {
+            requested_time = time;
+        } else if (time < 0) {
+            time = requested_time;
+        }
+        if ((requested_time < 0) or (time < 0)) {
+            return "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative flops (" +
+                   std::to_string(time) + ") and negative requested flops (" + std::to_string(requested_time) +
+                   ") in batch workload trace file";
+        }
+        if (requested_time < time) {
+            chunk.warnings.push_back(
+                    "TraceFileLoader::loadFromTraceFileSWF(): invalid job with requested time (" +
+                    std::to_string(requested_time) + ") smaller than actual time (" + std::to_string(time) +
+                    ") in batch workload trace file [fixing it]");
+            requested_time = time;
+        }
+
+        if (requested_ram < 0) {
+            requested_ram = 0;
+        }
+
+        if (sub_time < 0) {
+            return "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative submission time in batch workload trace file";
+        }
+        if (requested_num_nodes <= 0) {
+            requested_num_nodes = num_nodes;
+        }
+        if (requested_num_nodes <= 0) {
+            return "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative (requested) number of node in batch workload trace file";
+        }
+
+        chunk.userids.push_back(userid);
+        chunk.submit_times.push_back(sub_time);
+        chunk.times.push_back(time);
+        chunk.requested_times.push_back(requested_time);
+        chunk.requested_rams.push_back(requested_ram);
+        chunk.num_nodes.push_back((unsigned int) requested_num_nodes);
+        return "";
+    }
+
+    /**
+     * @brief Parse the lines of a chunk of a SWF trace file (called concurrently on different chunks)
+     * @param context: the parsing context
+     * @param chunk: the chunk
+     */
+    static void parseSWFTraceChunk(const SWFTraceParsingContext *context, SWFTraceChunk *chunk) {
+        const std::string &filename = context->filename;
+        std::vector<std::pair<const char *, size_t>> tokens;
+
+        const char *line = chunk->begin;
+        while (line < chunk->end) {
+            auto line_end = (const char *) memchr(line, '\n', chunk->end - line);
+            if (line_end == nullptr) {
+                line_end = chunk->end;
+            }
+
+            if (*line != ';') {
+                tokenizeSWFLine(line, line_end, tokens);
+                std::string error = parseSWFLine(line, tokens, *context, *chunk);
+                if (not error.empty()) {
+                    if (context->ignore_invalid_jobs) {
+                        chunk->warnings.push_back(error + " (in batch workload file " + filename + ") IGNORING");
+                    } else {
+                        chunk->error = "Error while reading batch workload trace file " + filename + ": " + error;
+                        return;
+                    }
+                }
+            }
+            line = line_end + 1;
+        }
+    }
+
     /**
     * @brief Load the workflow trace file
     *
@@ -63,6 +330,32 @@ namespace wrench {
     std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>>
     TraceFileLoader::loadFromTraceFile(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job) {
 
+        auto trace = loadWorkloadTrace(filename, ignore_invalid_jobs, desired_submit_time_of_first_job);
+
+        std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> trace_file_jobs;
+        trace_file_jobs.reserve(trace->size());
+        for (auto const &job : *trace) {
+            // (the first field is the job id for JSON traces, and the username for SWF traces)
+            trace_file_jobs.emplace_back(job.job_id.empty() ? job.username : job.job_id, job.submit_time, job.time,
+                                         job.requested_time, job.requested_ram, job.num_nodes, job.username);
+        }
+        return trace_file_jobs;
+    }
+
+    /**
+    * @brief Load the workflow trace file as a columnar workload trace
+    *
+    * @param filename: the path to the trace file in SWF format or in JSON format
+    * @param ignore_invalid_jobs: whether to ignore invalid job specifications
+    * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
+    *
+    * @return a workload trace
+    *
+    * @throw std::invalid_argument
+    */
+    std::shared_ptr<WorkloadTrace>
+    TraceFileLoader::loadWorkloadTrace(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job) {
+
         std::istringstream ss(filename);
         std::string token;
         std::vector<std::string> tokens;
@@ -87,214 +380,139 @@ namespace wrench {
     }
 
     /**
-    * @brief Load the workflow SWF trace file
+    * @brief Load the workflow SWF trace file. The file is memory-mapped and split into chunks
+    *        of whole lines that are parsed concurrently, after which the jobs are appended to the
+    *        trace in file order (so that errors are reported as if the file had been read sequentially)
     *
     * @param filename: the path to the trace file in SWF format
     * @param ignore_invalid_jobs: whether to ignore invalid job specifications
     * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
     *
-    * @return  a vector of tuples, where each tuple is a job description with the following fields:
-    *              - job id
-    *              - submission time
-    *              - actual time
-    *              - requested time,
-    *              - requested ram
-    *              - requested number of nodes
-    *              - username
+    * @return a workload trace
     *
     * @throw std::invalid_argument
     */
-    std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>>
+    std::shared_ptr<WorkloadTrace>
     TraceFileLoader::loadFromTraceFileSWF(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job) {
 
-        std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> trace_file_jobs = {};
+        auto trace = std::shared_ptr<WorkloadTrace>(new WorkloadTrace());
 
-        std::ifstream infile(filename);
-        if (not infile.is_open()) {
+        int fd = open(filename.c_str(), O_RDONLY);
+        struct stat file_stat;
+        if ((fd < 0) or (fstat(fd, &file_stat) != 0) or (not S_ISREG(file_stat.st_mode))) {
+            if (fd >= 0) {
+                close(fd);
+            }
             throw std::invalid_argument(
                     "TraceFileLoader::loadFromTraceFileSWF(): Cannot open batch workload trace file " + filename);
         }
-
-
-        std::string line;
-        double original_submit_time_of_first_job = -1;
-        while (std::getline(infile, line)) {
-
-            if (line[0] != ';') {
-                std::istringstream iss(line);
-                std::vector<std::string> tokens{std::istream_iterator<std::string>{iss},
-                                                std::istream_iterator<std::string>{}};
-
-                std::string id;
-                double time = -1, requested_time = -1, requested_ram = -1;
-                int itemnum = 0;
-                double sub_time = -1;
-                int requested_num_nodes = -1;
-                int num_nodes = -1;
-                unsigned long userid = 0;
-                std::string username;
-
-                try {
-                    if (tokens.size() < 10) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): Seeing less than 10 fields per line in batch workload trace file '" +
-                                filename +
-                                "'");
+        auto file_size = (size_t) file_stat.st_size;
+        if (file_size == 0) {
+            close(fd);
+            return trace;
+        }
+        auto mapping = (const char *) mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            throw std::invalid_argument(
+                    "TraceFileLoader::loadFromTraceFileSWF(): Cannot map batch workload trace file " + filename);
+        }
+        madvise((void *) mapping, file_size, MADV_SEQUENTIAL);
+
+        // Find the first valid submission time, which all submission times are shifted by
+        SWFTraceParsingContext context;
+        context.filename = filename;
+        context.ignore_invalid_jobs = ignore_invalid_jobs;
+        context.desired_submit_time_of_first_job = desired_submit_time_of_first_job;
+        context.original_submit_time_of_first_job = -1;
+        context.original_submit_time_line = nullptr;
+        {
+            std::vector<std::pair<const char *, size_t>> tokens;
+            const char *line = mapping;
+            while ((line < mapping + file_size) and (context.original_submit_time_line == nullptr)) {
+                auto line_end = (const char *) memchr(line, '\n', mapping + file_size - line);
+                if (line_end == nullptr) {
+                    line_end = mapping + file_size;
+                }
+                if (*line != ';') {
+                    tokenizeSWFLine(line, line_end, tokens);
+                    double sub_time;
+                    if ((tokens.size() >= 10) and parseSWFField(tokens[1].first, tokens[1].second, &sub_time) and
+                        (sub_time >= 0)) {
+                        context.original_submit_time_of_first_job = sub_time;
+                        context.original_submit_time_line = line;
                     }
+                }
+                line = line_end + 1;
+            }
+        }
 
-                    for (auto const &item : tokens) {
-                        switch (itemnum) {
-                            case 0: // Job ID
-                                id = item;
-                                break;
-                            case 1: // Submit time
-                                if (sscanf(item.c_str(), "%lf", &sub_time) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid submission time '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                if (original_submit_time_of_first_job < 0) {
-                                    original_submit_time_of_first_job = sub_time;
-                                }
-                                if (desired_submit_time_of_first_job >= 0) {
-                                    sub_time += (desired_submit_time_of_first_job - original_submit_time_of_first_job);
-                                }
-                                break;
-                            case 2: // Wait time
-                                break;
-                            case 3: // Run time
-                                //assuming flops and runtime are the same (in seconds)
-                                if (sscanf(item.c_str(), "%lf", &time) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid run time '" + item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 4: // Number of Allocated Processors
-                                if (sscanf(item.c_str(), "%d", &num_nodes) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid number of processors '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 5:// Average CPU time Used
-                                break;
-                            case 6: // Used Memory
-                                break;
-                            case 7: // Requested Number of Processors
-                                if (sscanf(item.c_str(), "%d", &requested_num_nodes) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested number of processors '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 8: // Requested time
-                                //assuming flops and runtime are the same (in seconds)
-                                if (sscanf(item.c_str(), "%lf", &requested_time) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested time '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 9: // Requested memory_manager_service
-                                // In KiB
-                                if (sscanf(item.c_str(), "%lf", &requested_ram) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid requested memory_manager_service '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                requested_ram *= 1024.0;
-                                break;
-                            case 10: // Status
-                                break;
-                            case 11: // User ID
-                                if (sscanf(item.c_str(), "%lu", &userid) != 1) {
-                                    throw std::invalid_argument(
-                                            "TraceFileLoader::loadFromTraceFileSWF(): Invalid userid '" +
-                                            item +
-                                            "' in batch workload trace file");
-                                }
-                                break;
-                            case 12: // Group ID
-                                break;
-                            case 13: // Executable number
-                                break;
-                            case 14: // Queue number
-                                break;
-                            case 15: // Partition number
-                                break;
-                            case 16: // Preceding job number
-                                break;
-                            case 17: // Think time
-                                break;
-                            default:
-                                throw std::invalid_argument(
-                                        "TraceFileLoader::loadFromTraceFileSWF(): Unknown batch workload trace file column, maybe there are more than 18 columns?"
-                                );
-                        }
-                        itemnum++;
-                    }
+        // Split the file in chunks of whole lines, at most one per hardware thread
+        const size_t min_chunk_size = 1 << 20;
+        size_t num_chunks = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(),
+                                                                 file_size / min_chunk_size));
+        std::vector<SWFTraceChunk> chunks(num_chunks);
+        const char *chunk_begin = mapping;
+        for (size_t i = 0; i < num_chunks; i++) {
+            const char *chunk_end = mapping + file_size;
+            if (i < num_chunks - 1) {
+                chunk_end = std::max(chunk_begin, mapping + (file_size * (i + 1)) / num_chunks);
+                auto newline = (const char *) memchr(chunk_end, '\n', mapping + file_size - chunk_end);
+                chunk_end = (newline == nullptr ? mapping + file_size : newline + 1);
+            }
+            chunks[i].begin = chunk_begin;
+            chunks[i].end = chunk_end;
+            chunk_begin = chunk_end;
+        }
 
-                    // Fix/check values
-                    if (requested_time < 0) {
-                        requested_time = time;
-                    } else if (time < 0) {
-                        time = requested_time;
-                    }
-                    if ((requested_time < 0) or (time < 0)) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative flops (" +
-                                std::to_string(time) + ") and negative requested flops ("+ std::to_string(requested_time) + ") in batch workload trace file");
-                    }
-                    if (requested_time < time) {
-                        WRENCH_WARN(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with requested time (%lf) smaller than actual time (%lf) in batch workload trace file [fixing it]", requested_time, time);
-                        requested_time = time;
-                    }
+        // Parse the chunks concurrently
+        std::vector<std::thread> parsers;
+        for (size_t i = 1; i < num_chunks; i++) {
+            try {
+                parsers.emplace_back(parseSWFTraceChunk, &context, &chunks[i]);
+            } catch (std::system_error &e) {
+                parseSWFTraceChunk(&context, &chunks[i]);
+            }
+        }
+        parseSWFTraceChunk(&context, &chunks[0]);
+        for (auto &parser : parsers) {
+            parser.join();
+        }
+        munmap((void *) mapping, file_size);
 
-                    if (requested_ram < 0) {
-                        requested_ram = 0;
-                    }
+        // Append the jobs to the trace in file order
+        size_t num_jobs = 0;
+        for (auto const &chunk : chunks) {
+            num_jobs += chunk.submit_times.size();
+        }
+        trace->reserve(num_jobs);
 
-                    if (sub_time < 0) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative submission time in batch workload trace file");
-                    }
-                    if (requested_num_nodes <= 0) {
-                        requested_num_nodes = num_nodes;
-                    }
-                    if (requested_num_nodes <= 0) {
-                        throw std::invalid_argument(
-                                "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative (requested) number of node in batch workload trace file");
-                    }
-                    if (userid == 0) {
-                        username = "user";
-                    } else {
-                        username = generateRandomUsername(userid);
-                    }
-                } catch (std::invalid_argument &e) {
-                    if (ignore_invalid_jobs) {
-                        WRENCH_WARN("%s (in batch workload file %s) IGNORING", e.what(), filename.c_str());
-                        continue;
-                    } else {
-                        throw std::invalid_argument("Error while reading batch workload trace file " + filename + ": " +  e.what());
-                    }
+        std::unordered_map<unsigned long, unsigned int> userid_to_user_id;
+        for (auto &chunk : chunks) {
+            for (auto const &warning : chunk.warnings) {
+                WRENCH_WARN("%s", warning.c_str());
+            }
+            if (not chunk.error.empty()) {
+                throw std::invalid_argument(chunk.error);
+            }
+
+            for (size_t j = 0; j < chunk.submit_times.size(); j++) {
+                unsigned long userid = chunk.userids[j];
+                auto it = userid_to_user_id.find(userid);
+                if (it == userid_to_user_id.end()) {
+                    std::string username = (userid == 0 ? "user" : generateRandomUsername(userid));
+                    it = userid_to_user_id.insert(std::make_pair(userid, trace->internUsername(username))).first;
                 }
 
-                // Add the job to the list
-                std::tuple<std::string, double, double, double, double, unsigned int, std::string> job =
-                        std::tuple<std::string, double, double, double, double, unsigned int, std::string>(
-                                username, sub_time, time, requested_time, requested_ram,
-                                (unsigned int) requested_num_nodes, username);
-                trace_file_jobs.push_back(job);
+                trace->addJob(it->second, chunk.submit_times[j], chunk.times[j], chunk.requested_times[j],
+                              chunk.requested_rams[j], chunk.num_nodes[j]);
             }
+
+            // Release the chunk's memory as we go
+            chunk = SWFTraceChunk();
         }
-        return trace_file_jobs;
+
+        return trace;
     }
 
     /**
@@ -304,21 +522,15 @@ namespace wrench {
     * @param ignore_invalid_jobs: whether to ignore invalid job specifications
     * @param desired_submit_time_of_first_job: the desired submit of of the first job (-1 means "use whatever time is in the trace file")
     *
-    * @return  a vector of tuples, where each tuple is a job description with the following fields:
-    *              - job id
-    *              - submission time
-    *              - actual time
-    *              - requested time,
-    *              - requested ram
-    *              - requested number of nodes
-    *              - username
+    * @return a workload trace
     *
     * @throw std::invalid_argument
     */
-    std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>>
+    std::shared_ptr<WorkloadTrace>
     TraceFileLoader::loadFromTraceFileJSON(std::string filename, bool ignore_invalid_jobs, double desired_submit_time_of_first_job) {
 
-        std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> trace_file_jobs = {};
+        auto trace = std::shared_ptr<WorkloadTrace>(new WorkloadTrace());
+        unsigned int user_id = trace->internUsername("user");
 
         std::ifstream file;
         nlohmann::json j;
@@ -402,13 +614,10 @@ namespace wrench {
                 }
             }
 
-//      // Add the job to the list
-            std::tuple<std::string, double, double, double, double, unsigned int, std::string> job =
-                    std::tuple<std::string, double, double, double, double, unsigned int, std::string>(
-                            std::to_string(id), subtime, walltime, requested_time, 0.0, (unsigned int) res, "user");
-            trace_file_jobs.push_back(job);
+            // Add the job to the trace
+            trace->addJob(id, user_id, subtime, walltime, requested_time, 0.0, (unsigned int) res);
         }
 
-        return trace_file_jobs;
+        return trace;
     }
 }
@@ -0,0 +1,151 @@
+/**
+ * Copyright (c) 2017-2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <algorithm>
+
+#include "wrench/util/WorkloadTrace.h"
+
+namespace wrench {
+
+    /**
+     * @brief Get the number of jobs in the trace
+     * @return a number of jobs
+     */
+    size_t WorkloadTrace::size() const {
+        return this->submit_times.size();
+    }
+
+    /**
+     * @brief Determine whether the trace has no job
+     * @return true or false
+     */
+    bool WorkloadTrace::empty() const {
+        return this->submit_times.empty();
+    }
+
+    /**
+     * @brief Get a job of the trace
+     * @param index: the index of the job in the trace
+     * @return a job
+     */
+    WorkloadTraceJob WorkloadTrace::getJob(size_t index) const {
+        WorkloadTraceJob job;
+        if (not this->job_ids.empty()) {
+            job.job_id = std::to_string(this->job_ids[index]);
+        }
+        job.username = this->usernames[this->user_ids[index]];
+        job.submit_time = this->submit_times[index];
+        job.time = this->times[index];
+        job.requested_time = this->requested_times[index];
+        job.requested_ram = this->requested_rams[index];
+        job.num_nodes = this->num_nodes[index];
+        return job;
+    }
+
+    /**
+     * @brief Get an iterator to the first job of the trace
+     * @return an iterator
+     */
+    WorkloadTrace::Iterator WorkloadTrace::begin() const {
+        return Iterator(this, 0);
+    }
+
+    /**
+     * @brief Get an iterator past the last job of the trace
+     * @return an iterator
+     */
+    WorkloadTrace::Iterator WorkloadTrace::end() const {
+        return Iterator(this, this->size());
+    }
+
+    /**
+     * @brief Cap the requested number of nodes of all jobs
+     * @param max_num_nodes: the maximum number of nodes
+     */
+    void WorkloadTrace::capNumNodes(unsigned int max_num_nodes) {
+        for (auto &n : this->num_nodes) {
+            n = std::min<unsigned int>(n, max_num_nodes);
+        }
+    }
+
+    /**
+     * @brief Cap the requested RAM of all jobs
+     * @param max_ram: the maximum RAM (in bytes)
+     */
+    void WorkloadTrace::capRequestedRam(double max_ram) {
+        for (auto &ram : this->requested_rams) {
+            ram = std::min<double>(ram, max_ram);
+        }
+    }
+
+    /**
+     * @brief Get the user id of a username, adding the username to the table of usernames if needed
+     * @param username: the username
+     * @return a user id
+     */
+    unsigned int WorkloadTrace::internUsername(const std::string &username) {
+        auto it = this->username_to_user_id.find(username);
+        if (it != this->username_to_user_id.end()) {
+            return it->second;
+        }
+        auto user_id = (unsigned int) this->usernames.size();
+        this->usernames.push_back(username);
+        this->username_to_user_id[username] = user_id;
+        return user_id;
+    }
+
+    /**
+     * @brief Append a job to the trace
+     * @param user_id: the user id of the submitter (as returned by internUsername())
+     * @param submit_time: the submission time
+     * @param time: the actual run time
+     * @param requested_time: the requested run time
+     * @param requested_ram: the requested RAM
+     * @param num_nodes: the requested number of nodes
+     */
+    void WorkloadTrace::addJob(unsigned int user_id, double submit_time, double time, double requested_time,
+                               double requested_ram, unsigned int num_nodes) {
+        this->user_ids.push_back(user_id);
+        this->submit_times.push_back(submit_time);
+        this->times.push_back(time);
+        this->requested_times.push_back(requested_time);
+        this->requested_rams.push_back(requested_ram);
+        this->num_nodes.push_back(num_nodes);
+    }
+
+    /**
+     * @brief Append a job with an id to the trace (either all jobs of a trace have an id, or none does)
+     * @param job_id: the job's id
+     * @param user_id: the user id of the submitter (as returned by internUsername())
+     * @param submit_time: the submission time
+     * @param time: the actual run time
+     * @param requested_time: the requested run time
+     * @param requested_ram: the requested RAM
+     * @param num_nodes: the requested number of nodes
+     */
+    void WorkloadTrace::addJob(unsigned long job_id, unsigned int user_id, double submit_time, double time,
+                               double requested_time, double requested_ram, unsigned int num_nodes) {
+        this->job_ids.push_back(job_id);
+        this->addJob(user_id, submit_time, time, requested_time, requested_ram, num_nodes);
+    }
+
+    /**
+     * @brief Reserve space for a number of jobs
+     * @param num_jobs: the number of jobs
+     */
+    void WorkloadTrace::reserve(size_t num_jobs) {
+        this->user_ids.reserve(num_jobs);
+        this->submit_times.reserve(num_jobs);
+        this->times.reserve(num_jobs);
+        this->requested_times.reserve(num_jobs);
+        this->requested_rams.reserve(num_jobs);
+        this->num_nodes.reserve(num_jobs);
+    }
+
+}
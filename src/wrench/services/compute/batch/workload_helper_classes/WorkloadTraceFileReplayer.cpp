@@ -11,6 +11,7 @@
 #include <wrench/simgrid_S4U_util/S4U_Simulation.h>
 #include <wrench/services/compute/batch/BatchComputeService.h>
 #include <wrench-dev.h>
+#include <wrench/util/WorkloadTrace.h>
 #include "WorkloadTraceFileReplayer.h"
 #include "WorkloadTraceFileReplayerEventReceiver.h"
 
@@ -24,13 +25,15 @@ namespace wrench {
      * @param batch_service: the batch service to which it submits jobs
      * @param num_cores_per_node: the number of cores per host on the batch service
      * @param use_actual_runtimes_as_requested_runtimes: if true, use actual runtimes as requested runtimes
+     * @param replay_as_reservations: if true, replay jobs as mere node reservations rather than as standard jobs
      * @param workload_trace: the workload trace to be replayed
      */
     WorkloadTraceFileReplayer::WorkloadTraceFileReplayer(std::string hostname,
                                                          std::shared_ptr<BatchComputeService> batch_service,
                                                          unsigned long num_cores_per_node,
                                                          bool use_actual_runtimes_as_requested_runtimes,
-                                                         std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> &workload_trace
+                                                         bool replay_as_reservations,
+                                                         std::shared_ptr<WorkloadTrace> workload_trace
     ) :
             WMS(nullptr, nullptr,
                 {batch_service}, {},
@@ -40,10 +43,70 @@ namespace wrench {
             workload_trace(workload_trace),
             batch_service(batch_service),
             num_cores_per_node(num_cores_per_node),
-            use_actual_runtimes_as_requested_runtimes(use_actual_runtimes_as_requested_runtimes) {}
+            use_actual_runtimes_as_requested_runtimes(use_actual_runtimes_as_requested_runtimes),
+            replay_as_reservations(replay_as_reservations) {}
 
 
+    /**
+     * @brief Main method of the replayer
+     * @return 0 on success
+     */
     int WorkloadTraceFileReplayer::main() {
+        if (this->replay_as_reservations) {
+            this->replayAsReservations();
+        } else {
+            this->replayAsStandardJobs();
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Replay the trace as background jobs that merely occupy nodes in the batch
+     *        service for their runtimes, so that no workflow, task, or executor is
+     *        ever created
+     */
+    void WorkloadTraceFileReplayer::replayAsReservations() {
+
+        // Record the start time of the current time (submission times will be just offsets from this time)
+        double real_start_time = S4U_Simulation::getClock();
+
+        unsigned long counter = 0;
+        for (auto const &job : *this->workload_trace) {
+
+            // Sleep until the submission time
+            double sub_time = real_start_time + job.submit_time;
+            double curtime = S4U_Simulation::getClock();
+            double sleeptime = sub_time - curtime;
+            if (sleeptime > 0)
+                wrench::S4U_Simulation::sleep(sleeptime);
+
+            // Get job information
+            std::string username = job.username;
+            double time = job.time;
+            double requested_time = job.requested_time;
+            if (this->use_actual_runtimes_as_requested_runtimes) {
+                requested_time = time;
+            }
+            unsigned long num_nodes = job.num_nodes;
+            auto time_in_minutes = (unsigned long) (1 + requested_time / 60); // Note the +1
+
+            WRENCH_INFO("#%lu: Submitting a [-N:%lu, -t:%lu, -u:%s] background job",
+                        counter++, num_nodes, time_in_minutes, username.c_str());
+            try {
+                this->batch_service->submitBackgroundJob(this->mailbox_name, username,
+                                                         num_nodes, time_in_minutes, std::max<double>(0, time));
+            } catch (std::invalid_argument &e) {
+                WRENCH_INFO("Couldn't create a background job: %s (ignoring)", e.what());
+            } catch (WorkflowExecutionException &e) {
+                WRENCH_INFO("Couldn't submit a replayed job: %s (ignoring)", e.getCause()->toString().c_str());
+            }
+        }
+    }
+
+    /**
+     * @brief Replay the trace as standard jobs that compute on all their cores
+     */
+    void WorkloadTraceFileReplayer::replayAsStandardJobs() {
 
         // Create a Job Manager
         std::shared_ptr<JobManager> job_manager = this->createJobManager();
@@ -69,24 +132,24 @@ namespace wrench {
         double real_start_time = S4U_Simulation::getClock();
 
         unsigned long counter = 0;
-        for (auto job : this->workload_trace) {
+        for (auto const &job : *this->workload_trace) {
 
             // Sleep until the submission time
-            double sub_time = real_start_time + std::get<1>(job);
+            double sub_time = real_start_time + job.submit_time;
             double curtime = S4U_Simulation::getClock();
             double sleeptime = sub_time - curtime;
             if (sleeptime > 0)
                 wrench::S4U_Simulation::sleep(sleeptime);
 
             // Get job information
-            std::string username = std::get<0>(job);
-            double time = std::get<2>(job);
-            double requested_time = std::get<3>(job);
+            std::string username = job.username;
+            double time = job.time;
+            double requested_time = job.requested_time;
             if (this->use_actual_runtimes_as_requested_runtimes) {
                 requested_time = time;
             }
-            double requested_ram = std::get<4>(job);
-            int num_nodes = std::get<5>(job);
+            double requested_ram = job.requested_ram;
+            int num_nodes = job.num_nodes;
 
             // Create the set of tasks
             std::vector<WorkflowTask *> to_submit;
@@ -139,7 +202,6 @@ namespace wrench {
         // And yet when we get here there are still running tasks...
         // AND: some users may want to inspect these tasks anyway! So perhaps we really don't want to
         // clear RAM
-        return 0;
     }
 
 };
@@ -20,6 +20,7 @@
 namespace wrench {
 
     class BatchComputeService;
+    class WorkloadTrace;
 
     /**
      * @brief A service that goes through a job submission trace (as loaded
@@ -33,18 +34,23 @@ namespace wrench {
                                   std::shared_ptr<BatchComputeService> batch_service,
                                   unsigned long num_cores_per_node,
                                   bool use_actual_runtimes_as_requested_runtimes,
-                                  std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> &workload_trace
+                                  bool replay_as_reservations,
+                                  std::shared_ptr<WorkloadTrace> workload_trace
         );
 
     private:
         std::shared_ptr<Workflow> workflow;
 
-        std::vector<std::tuple<std::string, double, double, double, double, unsigned int, std::string>> &workload_trace;
+        std::shared_ptr<WorkloadTrace> workload_trace;
         std::shared_ptr<BatchComputeService> batch_service;
         unsigned long num_cores_per_node;
         bool use_actual_runtimes_as_requested_runtimes;
+        bool replay_as_reservations;
 
         int main() override;
+
+        void replayAsStandardJobs();
+        void replayAsReservations();
     };
 
 };
@@ -20,6 +20,7 @@
 #include "wrench/services/compute/cloud/CloudComputeService.h"
 #include "wrench/services/compute/bare_metal/BareMetalComputeService.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 
 
 WRENCH_LOG_CATEGORY(wrench_core_cloud_service, "Log category for Cloud Service");
@@ -87,7 +88,7 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "get execution hosts" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("get_execution_hosts");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -156,7 +157,7 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "create vm" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("create_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -194,7 +195,7 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "shutdown vm" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("shutdown_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -230,7 +231,7 @@ namespace wrench {
 
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("start_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -300,7 +301,7 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "shutdown vm" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("suspend_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -335,7 +336,7 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "shutdown vm" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("resume_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -371,7 +372,7 @@ namespace wrench {
         assertServiceIsUp();
 
         // send a "shutdown vm" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("destroy_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -404,7 +405,7 @@ namespace wrench {
                                                 const std::map<std::string, std::string> &service_specific_args) {
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -437,7 +438,7 @@ namespace wrench {
                                              const std::map<std::string, std::string> &service_specific_args) {
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -553,9 +554,10 @@ namespace wrench {
     }
 
     /**
-     * @brief Send a message request
+     * @brief Send a message request and wait for the answer
      *
-     * @param answer_mailbox: the mailbox to which the answer message should be sent
+     * @param answer_mailbox: the mailbox to which the answer message should be sent (obtained
+     *        via S4U_Mailbox::getTemporaryMailbox())
      * @param message: message to be sent
      * @return a simulation message
      *
@@ -565,17 +567,10 @@ namespace wrench {
                                                                         ComputeServiceMessage *message) {
         serviceSanityCheck();
 
-        try {
-            S4U_Mailbox::putMessage(this->mailbox_name, message);
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Wait for a reply
         std::shared_ptr<SimulationMessage> answer_message = nullptr;
-
         try {
-            answer_message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+            answer_message = S4U_Mailbox::putRequestAndGetAnswer(this->mailbox_name, message,
+                                                                 answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -608,77 +603,107 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            this->stopAllVMs();
-            this->vm_list.clear();
-            // This is Synchronous
-            try {
-                S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                                CloudComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr<NetworkError> &cause) {
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                ComputeServiceResourceInformationRequestMessage,
+                CloudComputeServiceGetExecutionHostsRequestMessage,
+                CloudComputeServiceCreateVMRequestMessage,
+                CloudComputeServiceShutdownVMRequestMessage,
+                CloudComputeServiceStartVMRequestMessage,
+                CloudComputeServiceSuspendVMRequestMessage,
+                CloudComputeServiceResumeVMRequestMessage,
+                CloudComputeServiceDestroyVMRequestMessage,
+                ComputeServiceSubmitStandardJobRequestMessage,
+                ComputeServiceSubmitPilotJobRequestMessage,
+                ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage,
+                ServiceHasTerminatedMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                this->stopAllVMs();
+                this->vm_list.clear();
+                // This is Synchronous
+                try {
+                    S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                                    CloudComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    return false;
+                }
                 return false;
             }
-            return false;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-            processGetResourceInformation(msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceGetExecutionHostsRequestMessage *>(message.get())) {
-            processGetExecutionHosts(msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceCreateVMRequestMessage *>(message.get())) {
-            processCreateVM(msg->answer_mailbox, msg->num_cores, msg->ram_memory, msg->desired_vm_name,
-                            msg->property_list,
-                            msg->messagepayload_list);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceShutdownVMRequestMessage *>(message.get())) {
-            processShutdownVM(msg->answer_mailbox, msg->vm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceStartVMRequestMessage *>(message.get())) {
-            processStartVM(msg->answer_mailbox, msg->vm_name, msg->pm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceSuspendVMRequestMessage *>(message.get())) {
-            processSuspendVM(msg->answer_mailbox, msg->vm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceResumeVMRequestMessage *>(message.get())) {
-            processResumeVM(msg->answer_mailbox, msg->vm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceDestroyVMRequestMessage *>(message.get())) {
-            processDestroyVM(msg->answer_mailbox, msg->vm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-            processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-            processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage *>(message.get())) {
-            processIsThereAtLeastOneHostWithAvailableResources(msg->answer_mailbox, msg->num_cores, msg->ram);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ServiceHasTerminatedMessage *>(message.get())) {
-            if (auto bmcs = std::dynamic_pointer_cast<BareMetalComputeService>(msg->service)) {
-                processBareMetalComputeServiceTermination(bmcs, msg->exit_code);
-            } else {
-                throw std::runtime_error(
-                        "CloudComputeService::processNextMessage(): Received a service termination message for "
-                        "a non-bare_metal!");
+            case MessageTypes::indexOf<ComputeServiceResourceInformationRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceResourceInformationRequestMessage *>(message.get());
+                processGetResourceInformation(msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceGetExecutionHostsRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceGetExecutionHostsRequestMessage *>(message.get());
+                processGetExecutionHosts(msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceCreateVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceCreateVMRequestMessage *>(message.get());
+                processCreateVM(msg->answer_mailbox, msg->num_cores, msg->ram_memory, msg->desired_vm_name,
+                                msg->property_list,
+                                msg->messagepayload_list);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceShutdownVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceShutdownVMRequestMessage *>(message.get());
+                processShutdownVM(msg->answer_mailbox, msg->vm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceStartVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceStartVMRequestMessage *>(message.get());
+                processStartVM(msg->answer_mailbox, msg->vm_name, msg->pm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceSuspendVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceSuspendVMRequestMessage *>(message.get());
+                processSuspendVM(msg->answer_mailbox, msg->vm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceResumeVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceResumeVMRequestMessage *>(message.get());
+                processResumeVM(msg->answer_mailbox, msg->vm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceDestroyVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceDestroyVMRequestMessage *>(message.get());
+                processDestroyVM(msg->answer_mailbox, msg->vm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceSubmitStandardJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get());
+                processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceSubmitPilotJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get());
+                processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceIsThereAtLeastOneHostWithAvailableResourcesRequestMessage *>(message.get());
+                processIsThereAtLeastOneHostWithAvailableResources(msg->answer_mailbox, msg->num_cores, msg->ram);
+                return true;
+            }
+            case MessageTypes::indexOf<ServiceHasTerminatedMessage>(): {
+                auto msg = static_cast<ServiceHasTerminatedMessage *>(message.get());
+                if (auto bmcs = std::dynamic_pointer_cast<BareMetalComputeService>(msg->service)) {
+                    processBareMetalComputeServiceTermination(bmcs, msg->exit_code);
+                } else {
+                    throw std::runtime_error(
+                            "CloudComputeService::processNextMessage(): Received a service termination message for "
+                            "a non-bare_metal!");
+                }
+                return true;
+            }
+            default: {
+                throw std::runtime_error("Unexpected [" + message->getName() + "] message");
             }
-            return true;
-
-        } else {
-            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
         }
     }
 
@@ -19,6 +19,7 @@
 #include "wrench/services/compute/htcondor/HTCondorCentralManagerServiceMessage.h"
 #include "wrench/services/compute/htcondor/HTCondorNegotiatorService.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 #include <wrench/workflow/failure_causes/NetworkError.h>
 
 
@@ -95,24 +96,18 @@ namespace wrench {
             const std::map <std::string, std::string> &service_specific_args) {
         serviceSanityCheck();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         //  send a "run a standard job" message to the daemon's mailbox_name
+        std::unique_ptr <SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new ComputeServiceSubmitStandardJobRequestMessage(
                             answer_mailbox, job, service_specific_args,
                             this->getMessagePayloadValue(
-                                    HTCondorCentralManagerServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr <NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Get the answer
-        std::unique_ptr <SimulationMessage> message = nullptr;
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox);
+                                    HTCondorCentralManagerServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox);
         } catch (std::shared_ptr <NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -143,24 +138,18 @@ namespace wrench {
             const std::map <std::string, std::string> &service_specific_args) {
         serviceSanityCheck();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         //  send a "run a pilot job" message to the daemon's mailbox_name
+        std::unique_ptr <SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new ComputeServiceSubmitPilotJobRequestMessage(
                             answer_mailbox, job, service_specific_args,
                             this->getMessagePayloadValue(
-                                    HTCondorCentralManagerServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr <NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Get the answer
-        std::unique_ptr <SimulationMessage> message = nullptr;
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox);
+                                    HTCondorCentralManagerServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox);
         } catch (std::shared_ptr <NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -207,19 +196,24 @@ namespace wrench {
         WRENCH_INFO("HTCondor Service starting on host %s listening on mailbox_name %s",
                     this->hostname.c_str(), this->mailbox_name.c_str());
 
+        // Start the negotiator, which runs for as long as this service
+        this->negotiator = std::shared_ptr<HTCondorNegotiatorService>(
+                new HTCondorNegotiatorService(this->hostname, this->negotiator_startup_overhead, this->mailbox_name));
+        this->negotiator->simulation = this->simulation;
+        this->negotiator->start(this->negotiator, true, false); // Daemonized, no auto-restart
+
         // main loop
         while (this->processNextMessage()) {
             if (not this->dispatching_jobs && not this->resources_unavailable) {
                 // dispatching standard or pilot jobs
                 if (not this->pending_jobs.empty()) {
                     this->dispatching_jobs = true;
-                    //WRENCH_INFO("adding batch service to new negotiator---> %p", this->grid_universe_batch_service_shared_ptr.get());
-                    auto negotiator = std::shared_ptr<HTCondorNegotiatorService>(
-                            new HTCondorNegotiatorService(this->hostname, this->negotiator_startup_overhead,
-                                                          this->compute_services,
-                                                          this->running_jobs, this->pending_jobs, this->mailbox_name));
-                    negotiator->simulation = this->simulation;
-                    negotiator->start(negotiator, true, false); // Daemonized, no auto-restart
+                    S4U_Mailbox::dputMessage(
+                            this->negotiator->mailbox_name,
+                            new NegotiatorCycleRequestMessage(
+                                    this->compute_services, this->pending_jobs,
+                                    this->getMessagePayloadValue(
+                                            HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_CYCLE_REQUEST_MESSAGE_PAYLOAD)));
                 }
             }
         }
@@ -253,50 +247,69 @@ namespace wrench {
 
         WRENCH_INFO("HTCondor Central Manager got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            this->terminate();
-            // This is Synchronous
-            try {
-                S4U_Mailbox::putMessage(
-                        msg->ack_mailbox,
-                        new ServiceDaemonStoppedMessage(
-                                this->getMessagePayloadValue(
-                                        HTCondorCentralManagerServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr <NetworkError> &cause) {
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                CentralManagerWakeUpMessage,
+                ComputeServiceSubmitStandardJobRequestMessage,
+                ComputeServiceSubmitPilotJobRequestMessage,
+                ComputeServicePilotJobStartedMessage,
+                ComputeServicePilotJobExpiredMessage,
+                ComputeServiceStandardJobDoneMessage,
+                NegotiatorCompletionMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                this->terminate();
+                // This is Synchronous
+                try {
+                    S4U_Mailbox::putMessage(
+                            msg->ack_mailbox,
+                            new ServiceDaemonStoppedMessage(
+                                    this->getMessagePayloadValue(
+                                            HTCondorCentralManagerServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr <NetworkError> &cause) {
+                    return false;
+                }
                 return false;
             }
-            return false;
-
-        } else if (auto msg = dynamic_cast<CentralManagerWakeUpMessage *>(message.get())) {
-            // Do nothing
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-            processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-            processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServicePilotJobStartedMessage *>(message.get())) {
-            processPilotJobStarted(msg->job);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServicePilotJobExpiredMessage *>(message.get())) {
-            processPilotJobCompletion(msg->job);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceStandardJobDoneMessage *>(message.get())) {
-            processStandardJobCompletion(msg->job);
-            return true;
-
-        } else if (auto msg = dynamic_cast<NegotiatorCompletionMessage *>(message.get())) {
-            processNegotiatorCompletion(msg->scheduled_jobs);
-            return true;
-
-        } else {
-            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+            case MessageTypes::indexOf<CentralManagerWakeUpMessage>(): {
+                // Do nothing
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceSubmitStandardJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get());
+                processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceSubmitPilotJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get());
+                processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServicePilotJobStartedMessage>(): {
+                auto msg = static_cast<ComputeServicePilotJobStartedMessage *>(message.get());
+                processPilotJobStarted(msg->job);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServicePilotJobExpiredMessage>(): {
+                auto msg = static_cast<ComputeServicePilotJobExpiredMessage *>(message.get());
+                processPilotJobCompletion(msg->job);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceStandardJobDoneMessage>(): {
+                auto msg = static_cast<ComputeServiceStandardJobDoneMessage *>(message.get());
+                processStandardJobCompletion(msg->job);
+                return true;
+            }
+            case MessageTypes::indexOf<NegotiatorCompletionMessage>(): {
+                auto msg = static_cast<NegotiatorCompletionMessage *>(message.get());
+                processNegotiatorCompletion(msg->scheduled_jobs);
+                return true;
+            }
+            default: {
+                throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+            }
         }
     }
 
@@ -436,6 +449,13 @@ namespace wrench {
      */
     void HTCondorCentralManagerService::terminate() {
         this->setStateToDown();
+        if (this->negotiator) {
+            try {
+                this->negotiator->stop();
+            } catch (WorkflowExecutionException &e) {
+                // The negotiator is already gone
+            }
+        }
         this->compute_services.clear();
         this->pending_jobs.clear();
         this->running_jobs.clear();
@@ -30,6 +30,20 @@ namespace wrench {
             : HTCondorCentralManagerServiceMessage("NEGOTIATOR_DONE", payload), scheduled_jobs(scheduled_jobs) {}
 
 
+    /**
+     * @brief Constructor
+     *
+     * @param compute_services: the compute services available to the HTCondor pool
+     * @param pending_jobs: the pending jobs, each with its service-specific arguments
+     * @param payload: the message size in bytes
+     */
+    NegotiatorCycleRequestMessage::NegotiatorCycleRequestMessage(
+            std::set<std::shared_ptr<ComputeService>> compute_services,
+            std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> pending_jobs,
+            double payload)
+            : HTCondorCentralManagerServiceMessage("NEGOTIATOR_CYCLE_REQUEST", payload),
+              compute_services(std::move(compute_services)), pending_jobs(std::move(pending_jobs)) {}
+
     /**
      * @brief Constructor
      *
@@ -17,6 +17,7 @@
 #include "wrench/services/compute/htcondor/HTCondorComputeService.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
 #include "wrench/simgrid_S4U_util/S4U_Simulation.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 #include "wrench/services/compute/ComputeService.h"
 #include "wrench/workflow/failure_causes/JobTypeNotSupported.h"
 #include "wrench/workflow/failure_causes/NetworkError.h"
@@ -142,24 +143,18 @@ namespace wrench {
 
         serviceSanityCheck();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_standard_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         //  send a "run a standard job" message to the daemon's mailbox_name
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new ComputeServiceSubmitStandardJobRequestMessage(
                             answer_mailbox, job, service_specific_args,
                             this->getMessagePayloadValue(
-                                    HTCondorComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Get the answer
-        std::unique_ptr<SimulationMessage> message = nullptr;
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox);
+                                    HTCondorComputeServiceMessagePayload::SUBMIT_STANDARD_JOB_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -190,24 +185,18 @@ namespace wrench {
                                                 const std::map<std::string, std::string> &service_specific_args) {
         serviceSanityCheck();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("submit_pilot_job");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         //  send a "run a pilot job" message to the daemon's mailbox_name
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new ComputeServiceSubmitPilotJobRequestMessage(
                             answer_mailbox, job, service_specific_args,
                             this->getMessagePayloadValue(
-                                    HTCondorComputeServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Get the answer
-        std::unique_ptr<SimulationMessage> message = nullptr;
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox);
+                                    HTCondorComputeServiceMessagePayload::SUBMIT_PILOT_JOB_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -307,28 +296,38 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            this->terminate();
-            // This is Synchronous
-            try {
-                S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                                HTCondorComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr<NetworkError> &cause) {
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                ComputeServiceSubmitStandardJobRequestMessage,
+                ComputeServiceSubmitPilotJobRequestMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                this->terminate();
+                // This is Synchronous
+                try {
+                    S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                                    HTCondorComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    return false;
+                }
                 return false;
             }
-            return false;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-            processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-            processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else {
-            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+            case MessageTypes::indexOf<ComputeServiceSubmitStandardJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get());
+                processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceSubmitPilotJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get());
+                processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            default: {
+                throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+            }
         }
     }
 
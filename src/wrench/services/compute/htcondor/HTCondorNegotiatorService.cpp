@@ -28,21 +28,14 @@ namespace wrench {
      * @brief Constructor
      *
      * @param hostname: the hostname on which to start the service
-     * @param startup_overhead: a startup overhead, in seconds
-     * @param compute_services: a set of 'child' compute services available to and via the HTCondor pool
-     * @param running_jobs: a list of currently running jobs
-     * @param pending_jobs: a list of pending jobs
-     * @param reply_mailbox: the mailbox to which the "done/failed" message should be sent
+     * @param startup_overhead: a startup overhead for each negotiation cycle, in seconds
+     * @param reply_mailbox: the mailbox to which the "done/failed" message should be sent after each cycle
      */
     HTCondorNegotiatorService::HTCondorNegotiatorService(
             std::string &hostname,
             double startup_overhead,
-            std::set<std::shared_ptr<ComputeService>> &compute_services,
-            std::map<std::shared_ptr<WorkflowJob>, std::shared_ptr<ComputeService>> &running_jobs,
-            std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> &pending_jobs,
             std::string &reply_mailbox)
-            : Service(hostname, "htcondor_negotiator", "htcondor_negotiator"), reply_mailbox(reply_mailbox),
-              compute_services(compute_services), running_jobs(running_jobs), pending_jobs(pending_jobs) {
+            : Service(hostname, "htcondor_negotiator", "htcondor_negotiator"), reply_mailbox(reply_mailbox) {
 
         this->startup_overhead = startup_overhead;
         this->setMessagePayloads(this->default_messagepayload_values, messagepayload_list);
@@ -52,7 +45,8 @@ namespace wrench {
      * @brief Destructor
      */
     HTCondorNegotiatorService::~HTCondorNegotiatorService() {
-        this->pending_jobs.clear();
+        this->compute_services.clear();
+        this->resource_snapshots.clear();
     }
 
     /**
@@ -81,20 +75,85 @@ namespace wrench {
         WRENCH_INFO("HTCondor Negotiator Service starting on host %s listening on mailbox_name %s",
                     this->hostname.c_str(), this->mailbox_name.c_str());
 
+        while (this->processNextMessage()) {
+        }
+
+        WRENCH_INFO("HTCondorNegotiator Service on host %s cleanly terminating!",
+                    S4U_Simulation::getHostName().c_str());
+        return 0;
+    }
+
+    /**
+     * @brief Wait for and react to any incoming message
+     *
+     * @return false if the daemon should terminate, true otherwise
+     *
+     * @throw std::runtime_error
+     */
+    bool HTCondorNegotiatorService::processNextMessage() {
+        // Wait for a message
+        std::shared_ptr<SimulationMessage> message;
+
+        try {
+            message = S4U_Mailbox::getMessage(this->mailbox_name);
+        } catch (std::shared_ptr<NetworkError> &cause) {
+            return true;
+        }
+
+        if (message == nullptr) {
+            WRENCH_INFO("Got a NULL message... Likely this means we're all done. Aborting");
+            return false;
+        }
+
+        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
+            this->setStateToDown();
+            try {
+                S4U_Mailbox::putMessage(
+                        msg->ack_mailbox,
+                        new ServiceDaemonStoppedMessage(
+                                this->getMessagePayloadValue(
+                                        HTCondorCentralManagerServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                return false;
+            }
+            return false;
+
+        } else if (auto msg = dynamic_cast<NegotiatorCycleRequestMessage *>(message.get())) {
+            this->runNegotiationCycle(msg->compute_services, msg->pending_jobs);
+            return true;
+
+        } else {
+            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
+        }
+    }
+
+    /**
+     * @brief Run a negotiation cycle, i.e., go through the pending jobs and dispatch
+     *        those for which resources are available, and report back to the central manager
+     *
+     * @param compute_services: the compute services available to the HTCondor pool
+     * @param pending_jobs: the pending jobs
+     */
+    void HTCondorNegotiatorService::runNegotiationCycle(
+            std::set<std::shared_ptr<ComputeService>> &compute_services,
+            std::vector<std::tuple<std::shared_ptr<WorkflowJob>, std::map<std::string, std::string>>> &pending_jobs) {
+
         std::vector<std::shared_ptr<WorkflowJob>> scheduled_jobs;
 
+        this->compute_services = compute_services;
+        this->resource_snapshots.clear();
+
         // Simulate some overhead
         S4U_Simulation::sleep(this->startup_overhead);
 
         // sort jobs by priority
-        std::sort(this->pending_jobs.begin(), this->pending_jobs.end(), JobPriorityComparator());
+        std::sort(pending_jobs.begin(), pending_jobs.end(), JobPriorityComparator());
 
         // Go through the jobs and schedule them if possible
-        for (auto entry : this->pending_jobs) {
+        for (auto entry : pending_jobs) {
 
             auto job = std::get<0>(entry);
             auto service_specific_arguments = std::get<1>(entry);
-            bool is_standard_job = (std::dynamic_pointer_cast<StandardJob>(job) != nullptr);
 
             auto target_compute_service = pickTargetComputeService(job, service_specific_arguments);
 
@@ -106,25 +165,19 @@ namespace wrench {
                     auto pjob = std::dynamic_pointer_cast<PilotJob>(job);
                     target_compute_service->submitPilotJob(pjob, service_specific_arguments);
                 }
-                this->running_jobs.insert(std::make_pair(job, target_compute_service));
                 scheduled_jobs.push_back(job);
             }
         }
 
-        // Send the callback to the originator
-        try {
-            S4U_Mailbox::putMessage(
-                    this->reply_mailbox, new NegotiatorCompletionMessage(
-                            scheduled_jobs, this->getMessagePayloadValue(
-                                    HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            return 1;
-        }
-
-        WRENCH_INFO("HTCondorNegotiator Service on host %s cleanly terminating!",
-                    S4U_Simulation::getHostName().c_str());
-        return 0;
+        this->compute_services.clear();
+        this->resource_snapshots.clear();
 
+        // Send the callback to the originator (asynchronously, as the originator may
+        // be trying to stop this daemon)
+        S4U_Mailbox::dputMessage(
+                this->reply_mailbox, new NegotiatorCompletionMessage(
+                        scheduled_jobs, this->getMessagePayloadValue(
+                                HTCondorCentralManagerServiceMessagePayload::HTCONDOR_NEGOTIATOR_DONE_MESSAGE_PAYLOAD)));
     }
 
     /**
@@ -245,29 +298,27 @@ namespace wrench {
                                             "service-specific arguments for Non-Grid universe jobs are currently not supported");
             }
 
-            bool enough_idle_resources = cs->isThereAtLeastOneHostWithIdleResources(sjob->getMinimumRequiredNumCores(),
-                                                                                    sjob->getMinimumRequiredMemory());
-#if 0
-            // Check on RAM constraints
-            auto ram_resources = cs->getPerHostAvailableMemoryCapacity();
-            unsigned long max_available_ram_capacity = 0;
-            for (auto const &entry: ram_resources) {
-                max_available_ram_capacity = std::max<unsigned long>(max_available_ram_capacity, entry.second);
-            }
-            if (max_available_ram_capacity < sjob->getMinimumRequiredMemory()) {
-                continue;
+            // Get a resource snapshot of the compute service, once per negotiation cycle
+            auto snapshot = this->resource_snapshots.find(cs);
+            if (snapshot == this->resource_snapshots.end()) {
+                snapshot = this->resource_snapshots.insert(std::make_pair(cs, cs->getPerHostIdleResources())).first;
             }
 
-            // Check on idle resources
-            auto idle_core_resources = cs->getPerHostNumIdleCores();
-            unsigned long max_num_idle_cores = 0;
-            for (auto const &entry : idle_core_resources) {
-                max_num_idle_cores = std::max<unsigned long>(max_num_idle_cores, entry.second);
-            }
-            if (max_num_idle_cores < sjob->getMinimumRequiredNumCores()) {
-                continue;
+            // Look for a host with enough idle cores and available RAM, and update the
+            // snapshot as if the job was running there
+            bool enough_idle_resources = false;
+            for (auto &h : snapshot->second) {
+                auto &num_idle_cores = std::get<0>(h.second);
+                auto &available_ram = std::get<1>(h.second);
+                if ((num_idle_cores >= sjob->getMinimumRequiredNumCores()) and
+                    (available_ram >= sjob->getMinimumRequiredMemory())) {
+                    num_idle_cores -= sjob->getMinimumRequiredNumCores();
+                    available_ram -= sjob->getMinimumRequiredMemory();
+                    enough_idle_resources = true;
+                    break;
+                }
             }
-#endif
+
             if (enough_idle_resources) {
                 // Return the first appropriate CS we found
                 return cs;
@@ -18,6 +18,7 @@
 #include "wrench/logging/TerminalOutput.h"
 #include "wrench/services/helpers/ServiceTerminationDetectorMessage.h"
 #include "wrench/simgrid_S4U_util/S4U_Mailbox.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 
 
 WRENCH_LOG_CATEGORY(wrench_core_virtualized_cluster_service, "Log category for Virtualized Cluster Service");
@@ -75,7 +76,7 @@ namespace wrench {
 
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("start_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -111,7 +112,7 @@ namespace wrench {
         }
 
         // send a "migrate vm" message to the daemon's mailbox_name
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("migrate_vm");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::shared_ptr<SimulationMessage> answer_message = sendRequest(
                 answer_mailbox,
@@ -179,71 +180,99 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            this->stopAllVMs();
-            // This is Synchronous
-            try {
-                S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                                CloudComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr<NetworkError> &cause) {
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                ComputeServiceResourceInformationRequestMessage,
+                CloudComputeServiceGetExecutionHostsRequestMessage,
+                CloudComputeServiceCreateVMRequestMessage,
+                CloudComputeServiceShutdownVMRequestMessage,
+                CloudComputeServiceStartVMRequestMessage,
+                CloudComputeServiceSuspendVMRequestMessage,
+                CloudComputeServiceResumeVMRequestMessage,
+                VirtualizedClusterComputeServiceMigrateVMRequestMessage,
+                ComputeServiceSubmitStandardJobRequestMessage,
+                ComputeServiceSubmitPilotJobRequestMessage,
+                ServiceHasTerminatedMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                this->stopAllVMs();
+                // This is Synchronous
+                try {
+                    S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                                    CloudComputeServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    return false;
+                }
                 return false;
             }
-            return false;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceResourceInformationRequestMessage *>(message.get())) {
-            processGetResourceInformation(msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceGetExecutionHostsRequestMessage *>(message.get())) {
-            processGetExecutionHosts(msg->answer_mailbox);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceCreateVMRequestMessage *>(message.get())) {
-            processCreateVM(msg->answer_mailbox, msg->num_cores, msg->ram_memory, msg->desired_vm_name,
-                            msg->property_list,
-                            msg->messagepayload_list);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceShutdownVMRequestMessage *>(message.get())) {
-            processShutdownVM(msg->answer_mailbox, msg->vm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceStartVMRequestMessage *>(message.get())) {
-            processStartVM(msg->answer_mailbox, msg->vm_name, msg->pm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceSuspendVMRequestMessage *>(message.get())) {
-            processSuspendVM(msg->answer_mailbox, msg->vm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<CloudComputeServiceResumeVMRequestMessage *>(message.get())) {
-            processResumeVM(msg->answer_mailbox, msg->vm_name);
-            return true;
-
-        } else if (auto msg = dynamic_cast<VirtualizedClusterComputeServiceMigrateVMRequestMessage *>(
-                message.get())) {
-            processMigrateVM(msg->answer_mailbox, msg->vm_name, msg->dest_pm_hostname);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get())) {
-            processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get())) {
-            processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
-            return true;
-
-        } else if (auto msg = dynamic_cast<ServiceHasTerminatedMessage *>(message.get())) {
-            if (auto bmcs = std::dynamic_pointer_cast<BareMetalComputeService>(msg->service)) {
-                processBareMetalComputeServiceTermination(bmcs, msg->exit_code);
-            } else {
-                throw std::runtime_error(
-                        "VirtualizedClusterComputeService::processNextMessage(): Received a service termination message for a non-bare_metal!");
+            case MessageTypes::indexOf<ComputeServiceResourceInformationRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceResourceInformationRequestMessage *>(message.get());
+                processGetResourceInformation(msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceGetExecutionHostsRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceGetExecutionHostsRequestMessage *>(message.get());
+                processGetExecutionHosts(msg->answer_mailbox);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceCreateVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceCreateVMRequestMessage *>(message.get());
+                processCreateVM(msg->answer_mailbox, msg->num_cores, msg->ram_memory, msg->desired_vm_name,
+                                msg->property_list,
+                                msg->messagepayload_list);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceShutdownVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceShutdownVMRequestMessage *>(message.get());
+                processShutdownVM(msg->answer_mailbox, msg->vm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceStartVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceStartVMRequestMessage *>(message.get());
+                processStartVM(msg->answer_mailbox, msg->vm_name, msg->pm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceSuspendVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceSuspendVMRequestMessage *>(message.get());
+                processSuspendVM(msg->answer_mailbox, msg->vm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<CloudComputeServiceResumeVMRequestMessage>(): {
+                auto msg = static_cast<CloudComputeServiceResumeVMRequestMessage *>(message.get());
+                processResumeVM(msg->answer_mailbox, msg->vm_name);
+                return true;
+            }
+            case MessageTypes::indexOf<VirtualizedClusterComputeServiceMigrateVMRequestMessage>(): {
+                auto msg = static_cast<VirtualizedClusterComputeServiceMigrateVMRequestMessage *>(message.get());
+                processMigrateVM(msg->answer_mailbox, msg->vm_name, msg->dest_pm_hostname);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceSubmitStandardJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitStandardJobRequestMessage *>(message.get());
+                processSubmitStandardJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            case MessageTypes::indexOf<ComputeServiceSubmitPilotJobRequestMessage>(): {
+                auto msg = static_cast<ComputeServiceSubmitPilotJobRequestMessage *>(message.get());
+                processSubmitPilotJob(msg->answer_mailbox, msg->job, msg->service_specific_args);
+                return true;
+            }
+            case MessageTypes::indexOf<ServiceHasTerminatedMessage>(): {
+                auto msg = static_cast<ServiceHasTerminatedMessage *>(message.get());
+                if (auto bmcs = std::dynamic_pointer_cast<BareMetalComputeService>(msg->service)) {
+                    processBareMetalComputeServiceTermination(bmcs, msg->exit_code);
+                } else {
+                    throw std::runtime_error(
+                            "VirtualizedClusterComputeService::processNextMessage(): Received a service termination message for a non-bare_metal!");
+                }
+                return true;
+            }
+            default: {
+                throw std::runtime_error("Unexpected [" + message->getName() + "] message");
             }
-            return true;
-        } else {
-            throw std::runtime_error("Unexpected [" + message->getName() + "] message");
         }
     }
 
@@ -14,6 +14,7 @@
 #include <wrench/simgrid_S4U_util/S4U_Simulation.h>
 #include <wrench/simgrid_S4U_util/S4U_Mailbox.h>
 #include <wrench/simulation/SimulationMessage.h>
+#include <wrench/simulation/SimulationMessageTypeSwitch.h>
 #include <wrench/services/ServiceMessage.h>
 
 #include "wrench/services/file_registry/FileRegistryService.h"
@@ -65,23 +66,18 @@ namespace wrench {
 
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry");
-
-        try {
-            S4U_Mailbox::putMessage(this->mailbox_name, new FileRegistryFileLookupRequestMessage(
-                    answer_mailbox, file,
-                    this->getMessagePayloadValue(
-                            FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         std::unique_ptr<SimulationMessage> message = nullptr;
-
         try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+            message = S4U_Mailbox::putRequestAndGetAnswer(
+                    this->mailbox_name,
+                    new FileRegistryFileLookupRequestMessage(
+                            answer_mailbox, file,
+                            this->getMessagePayloadValue(
+                                    FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
-
             throw WorkflowExecutionException(cause);
         }
 
@@ -123,25 +119,19 @@ namespace wrench {
                     " does not exist");
         }
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_entry_by_proximity");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new FileRegistryFileLookupByProximityRequestMessage(
                             answer_mailbox, file,
                             reference_host,
                             network_proximity_service,
                             this->getMessagePayloadValue(
-                                    FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        std::unique_ptr<SimulationMessage> message = nullptr;
-
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+                                    FileRegistryServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -170,23 +160,17 @@ namespace wrench {
 
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("add_entry");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new FileRegistryAddEntryRequestMessage(
                             answer_mailbox, file, location,
                             this->getMessagePayloadValue(
-                                    FileRegistryServiceMessagePayload::ADD_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        std::unique_ptr<SimulationMessage> message = nullptr;
-
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+                                    FileRegistryServiceMessagePayload::ADD_ENTRY_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -214,23 +198,17 @@ namespace wrench {
 
         assertServiceIsUp();
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("remove_entry");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new FileRegistryRemoveEntryRequestMessage(
                             answer_mailbox, file, location,
                             this->getMessagePayloadValue(
-                                    FileRegistryServiceMessagePayload::REMOVE_ENTRY_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        std::unique_ptr<SimulationMessage> message = nullptr;
-
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+                                    FileRegistryServiceMessagePayload::REMOVE_ENTRY_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -282,90 +260,104 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage*>(message.get())) {
-            // This is Synchronous
-            try {
-                S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                                FileRegistryServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr<NetworkError> &cause) {
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                FileRegistryFileLookupRequestMessage,
+                FileRegistryFileLookupByProximityRequestMessage,
+                FileRegistryAddEntryRequestMessage,
+                FileRegistryRemoveEntryRequestMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                // This is Synchronous
+                try {
+                    S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                                    FileRegistryServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    return false;
+                }
                 return false;
             }
-            return false;
-
-        } else if (auto msg = dynamic_cast<FileRegistryFileLookupRequestMessage*>(message.get())) {
-            std::set<std::shared_ptr<FileLocation>> locations = {};
-            if (this->entries.find(msg->file) != this->entries.end()) {
-                locations = this->entries[msg->file];
+            case MessageTypes::indexOf<FileRegistryFileLookupRequestMessage>(): {
+                auto msg = static_cast<FileRegistryFileLookupRequestMessage *>(message.get());
+                std::set<std::shared_ptr<FileLocation>> locations = {};
+                if (this->entries.find(msg->file) != this->entries.end()) {
+                    locations = this->entries[msg->file];
+                }
+                // Simulate a lookup overhead
+                S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
+
+                S4U_Mailbox::dputMessage(
+                        msg->answer_mailbox,
+                        new FileRegistryFileLookupAnswerMessage(
+                                msg->file, locations,
+                                this->getMessagePayloadValue(
+                                        FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+                return true;
             }
-            // Simulate a lookup overhead
-            S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
+            case MessageTypes::indexOf<FileRegistryFileLookupByProximityRequestMessage>(): {
+                auto msg = static_cast<FileRegistryFileLookupByProximityRequestMessage *>(message.get());
+                std::string reference_host = msg->reference_host;
 
-            S4U_Mailbox::dputMessage(
-                    msg->answer_mailbox,
-                    new FileRegistryFileLookupAnswerMessage(
-                            msg->file, locations,
-                            this->getMessagePayloadValue(
-                                    FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-            return true;
-
-        } else if (auto msg = dynamic_cast<FileRegistryFileLookupByProximityRequestMessage*>(message.get())) {
-            std::string reference_host = msg->reference_host;
+                std::set<std::shared_ptr<FileLocation>> all_file_locations = {};
+                if (this->entries.find(msg->file) != this->entries.end()) {
+                    all_file_locations = this->entries[msg->file];
+                }
 
-            std::set<std::shared_ptr<FileLocation>> all_file_locations = {};
-            if (this->entries.find(msg->file) != this->entries.end()) {
-                all_file_locations = this->entries[msg->file];
-            }
+                double proximity;
+                std::map<double, std::shared_ptr<FileLocation>> map_to_return;
+                auto itr = map_to_return.cbegin();
 
-            double proximity;
-            std::map<double, std::shared_ptr<FileLocation>> map_to_return;
-            auto itr = map_to_return.cbegin();
+                for (auto &location: all_file_locations) {
+                    proximity = std::get<0>(msg->network_proximity_service->getHostPairDistance(
+                            std::make_pair(reference_host, location->getStorageService()->getHostname())));
+                    itr = map_to_return.insert(itr, std::make_pair(proximity, location));
+                }
 
-            for (auto &location: all_file_locations) {
-                proximity = std::get<0>(msg->network_proximity_service->getHostPairDistance(
-                        std::make_pair(reference_host, location->getStorageService()->getHostname())));
-                itr = map_to_return.insert(itr, std::make_pair(proximity, location));
+                S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
+                S4U_Mailbox::dputMessage(
+                        msg->answer_mailbox,
+                        new FileRegistryFileLookupByProximityAnswerMessage(
+                                msg->file,
+                                msg->reference_host,
+                                map_to_return,
+                                this->getMessagePayloadValue(
+                                        FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+                return true;
             }
+            case MessageTypes::indexOf<FileRegistryAddEntryRequestMessage>(): {
+                auto msg = static_cast<FileRegistryAddEntryRequestMessage *>(message.get());
+                addEntryToDatabase(msg->file, msg->location);
 
-            S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::LOOKUP_COMPUTE_COST));
-            S4U_Mailbox::dputMessage(
-                    msg->answer_mailbox,
-                    new FileRegistryFileLookupByProximityAnswerMessage(
-                            msg->file,
-                            msg->reference_host,
-                            map_to_return,
-                            this->getMessagePayloadValue(
-                                    FileRegistryServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-            return true;
+                // Simulate an add overhead
+                S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::ADD_ENTRY_COMPUTE_COST));
 
-        } else if (auto msg = dynamic_cast<FileRegistryAddEntryRequestMessage*>(message.get())) {
-            addEntryToDatabase(msg->file, msg->location);
-
-            // Simulate an add overhead
-            S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::ADD_ENTRY_COMPUTE_COST));
-
-            S4U_Mailbox::dputMessage(msg->answer_mailbox,
-                                     new FileRegistryAddEntryAnswerMessage(this->getMessagePayloadValue(
-                                             FileRegistryServiceMessagePayload::ADD_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
-            return true;
-
-        } else if (auto msg = dynamic_cast<FileRegistryRemoveEntryRequestMessage*>(message.get())) {
-            bool success = removeEntryFromDatabase(msg->file, msg->location);
-
-            // Simulate a removal overhead
-            S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::REMOVE_ENTRY_COMPUTE_COST));
-
-            S4U_Mailbox::dputMessage(
-                    msg->answer_mailbox,
-                    new FileRegistryRemoveEntryAnswerMessage(
-                            success,
-                            this->getMessagePayloadValue(
-                                    FileRegistryServiceMessagePayload::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
-            return true;
-
-        } else {
-            throw std::runtime_error(
-                    "FileRegistryService::processNextMessage(): Unexpected [" + message->getName() + "] message");
+                S4U_Mailbox::dputMessage(msg->answer_mailbox,
+                                         new FileRegistryAddEntryAnswerMessage(this->getMessagePayloadValue(
+                                                 FileRegistryServiceMessagePayload::ADD_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
+                return true;
+            }
+            case MessageTypes::indexOf<FileRegistryRemoveEntryRequestMessage>(): {
+                auto msg = static_cast<FileRegistryRemoveEntryRequestMessage *>(message.get());
+                bool success = removeEntryFromDatabase(msg->file, msg->location);
+
+                // Simulate a removal overhead
+                S4U_Simulation::compute(getPropertyValueAsDouble(FileRegistryServiceProperty::REMOVE_ENTRY_COMPUTE_COST));
+
+                S4U_Mailbox::dputMessage(
+                        msg->answer_mailbox,
+                        new FileRegistryRemoveEntryAnswerMessage(
+                                success,
+                                this->getMessagePayloadValue(
+                                        FileRegistryServiceMessagePayload::REMOVE_ENTRY_ANSWER_MESSAGE_PAYLOAD)));
+                return true;
+            }
+            default: {
+                throw std::runtime_error(
+                        "FileRegistryService::processNextMessage(): Unexpected [" + message->getName() + "] message");
+            }
         }
     }
 
@@ -44,7 +44,7 @@ namespace wrench {
      * @brief Get the file id
      * @return the file id
      */
-    std::string Block::getFileId() {
+    const std::string &Block::getFileId() const {
         return this->file_id;
     }
 
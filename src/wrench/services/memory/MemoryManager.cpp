@@ -12,6 +12,7 @@
 #include "wrench/simgrid_S4U_util/S4U_Simulation.h"
 #include "wrench/workflow/failure_causes/HostError.h"
 #include <wrench/services/memory/MemoryManager.h>
+#include <cmath>
 
 WRENCH_LOG_CATEGORY(wrench_periodic_flush, "Log category for Periodic Flush");
 
@@ -37,6 +38,8 @@ namespace wrench {
         this->free = total;
         this->dirty = 0;
         this->cached = 0;
+        this->flusher_mutex = simgrid::s4u::Mutex::create();
+        this->flusher_condition = simgrid::s4u::ConditionVariable::create();
     }
 
     /**
@@ -76,8 +79,24 @@ namespace wrench {
                                        amt / 1000000, end_time - start_time, this->dirty / 1000000)
             }
 
-            if (end_time - start_time < interval) {
-                S4U_Simulation::sleep(interval + start_time - end_time);
+            // All dirty data that had expired when flushing started has been flushed
+            while ((not this->dirty_times.empty()) and
+                   (start_time - this->dirty_times.top() >= expired_time)) {
+                this->dirty_times.pop();
+            }
+
+            // Flushing happens every interval, but there is no point waking up
+            // until some dirty data has expired
+            double tick = (end_time - start_time < interval) ? start_time + interval : end_time;
+            if (this->dirty_times.empty()) {
+                std::unique_lock<simgrid::s4u::Mutex> lock(*this->flusher_mutex);
+                while (this->dirty_times.empty()) {
+                    this->flusher_condition->wait(lock);
+                }
+            }
+            double next_flush_time = getNextFlushTime(tick);
+            if (next_flush_time > S4U_Simulation::getClock()) {
+                S4U_Simulation::sleep(next_flush_time - S4U_Simulation::getClock());
             }
         }
 
@@ -85,6 +104,20 @@ namespace wrench {
         return 0;
     }
 
+    /**
+     * @brief Compute the date of the first periodical flush (i.e., tick + k * interval, for k >= 0)
+     *        at which the earliest dirty data will have expired
+     * @param tick: the date of the next periodical flush
+     * @return a date
+     */
+    double MemoryManager::getNextFlushTime(double tick) {
+        double expiry = this->dirty_times.top() + expired_time;
+        if ((expiry <= tick) or (interval <= 0)) {
+            return tick;
+        }
+        return tick + std::ceil((expiry - tick) / interval) * interval;
+    }
+
     /**
      * @brief Immediately terminate periodical flushing
      */
@@ -171,11 +204,7 @@ namespace wrench {
      * @return a number of bytes
      */
     double MemoryManager::getEvictableMemory() {
-        double sum = 0;
-        for (unsigned int i = 0; i < inactive_list.size(); i++) {
-            sum += inactive_list[i]->getSize();
-        }
-        return sum;
+        return this->inactive_list.size;
     }
 
     /**
@@ -198,18 +227,19 @@ namespace wrench {
      * @brief Flush dirty data in a LRU list
      * @param list: the LRU list whose data will be flushed
      * @param amount: the amount requested to flush
+     * @param excluded_filename: name of file to exclude
      * @return flushed amount
      */
-    double MemoryManager::flushLruList(std::vector<Block *> &list,
+    double MemoryManager::flushLruList(LruList &list,
                                        double amount,
-                                       std::string excluded_filename) {
+                                       const std::string &excluded_filename) {
         if (amount <= 0) return 0;
         double flushed = 0;
 
         std::map<std::string, double> flushing_map;
 
-        for (auto blk : list) {
-            if (!excluded_filename.empty() && blk->getFileId().compare(excluded_filename) == 0) {
+        for (Block *blk = list.head; blk != nullptr; blk = blk->lru_next) {
+            if (!excluded_filename.empty() && blk->file_id == excluded_filename) {
                 continue;
             }
 
@@ -226,11 +256,10 @@ namespace wrench {
 
                     flushed = amount;
                     // split
-                    blk->setSize(blk->getSize() - blk_flushed);
+                    resizeBlock(blk, blk->getSize() - blk_flushed);
 
-                    std::string fn = blk->getFileId();
-                    inactive_list.push_back(new Block(fn, blk->getLocation(), blk_flushed, blk->getLastAccess(),
-                                                      false, blk->getDirtyTime()));
+                    pushBack(inactive_list, newBlock(blk->file_id, blk->getLocation(), blk_flushed,
+                                                     blk->getLastAccess(), false, blk->getDirtyTime()));
                 } else {
                     // done flushing
                     break;
@@ -285,13 +314,13 @@ namespace wrench {
      * @param list: the LRU to be flushed
      * @return flushed amount
      */
-    double MemoryManager::flushExpiredData(std::vector<Block *> &list) {
+    double MemoryManager::flushExpiredData(LruList &list) {
         double flushed = 0;
 
         while (true) {
             this->acquireDaemonLock();
             Block *block_to_deal_with = nullptr;
-            for (auto blk : list) {
+            for (Block *blk = list.head; blk != nullptr; blk = blk->lru_next) {
                 if (!blk->isDirty()) continue;
                 if (S4U_Simulation::getClock() - blk->getDirtyTime() < expired_time) continue;
                 block_to_deal_with = blk;
@@ -301,13 +330,15 @@ namespace wrench {
             if (block_to_deal_with == nullptr) break;
 
             block_to_deal_with->setDirty(false);
-            flushed += block_to_deal_with->getSize();
+            // The block may be evicted (and recycled) while it is being written
+            double block_size = block_to_deal_with->getSize();
+            flushed += block_size;
 
             simgrid::s4u::Disk *disk = getDisk(block_to_deal_with->getLocation()->getMountPoint(), this->hostname);
-            disk->write(block_to_deal_with->getSize());
+            disk->write(block_size);
 
-            this->dirty -= block_to_deal_with->getSize();
-            flushed += block_to_deal_with->getSize();
+            this->dirty -= block_size;
+            flushed += block_size;
         }
 
         return flushed;
@@ -350,28 +381,27 @@ namespace wrench {
      * @param excluded_filename: name of file that cannot be evicted
      * @return evicted amount
      */
-    double MemoryManager::evictLruList(std::vector<Block *> &lru_list,
+    double MemoryManager::evictLruList(LruList &lru_list,
                                        double amount,
-                                       std::string excluded_filename) {
+                                       const std::string &excluded_filename) {
         if (amount <= 0) return 0;
 
         double evicted = 0;
 
-        for (unsigned int i = 0; i < lru_list.size(); i++) {
-
-            Block *blk = lru_list.at(i);
+        Block *next_blk;
+        for (Block *blk = lru_list.head; blk != nullptr; blk = next_blk) {
+            next_blk = blk->lru_next;
 
-            if (!excluded_filename.empty() && blk->getFileId().compare(excluded_filename) == 0) {
+            if (!excluded_filename.empty() && blk->file_id == excluded_filename) {
                 continue;
             }
 
             if (blk->isDirty()) continue;
             if (evicted + blk->getSize() <= amount) {
                 evicted += blk->getSize();
-                lru_list.erase(lru_list.begin() + i);
-                i--;
+                deleteBlock(blk);
             } else if (evicted < amount && evicted + blk->getSize() > amount) {
-                blk->setSize(blk->getSize() - amount + evicted);
+                resizeBlock(blk, blk->getSize() - amount + evicted);
                 // done eviction
                 evicted = amount;
                 break;
@@ -403,7 +433,7 @@ namespace wrench {
         free -= amount;
         cached += amount;
         // Push cached data to inactive list
-        inactive_list.push_back(new Block(filename, location, amount, S4U_Simulation::getClock(), false, 0));
+        pushBack(inactive_list, newBlock(filename, location, amount, S4U_Simulation::getClock(), false, 0));
         balanceLruLists();
 
         simgrid::s4u::Disk *disk = getDisk(location->getMountPoint(), this->hostname);
@@ -427,86 +457,90 @@ namespace wrench {
         double clean_reaccessed = 0;
         double read = 0;
 
-        for (unsigned int i = 0; i < inactive_list.size(); i++) {
+        auto inactive_file_blocks = inactive_list.files.find(filename);
+        Block *next_blk = (inactive_file_blocks == inactive_list.files.end()) ? nullptr : inactive_file_blocks->second.head;
+        while (next_blk != nullptr) {
 
             if (read >= amount) {
                 break;
             }
 
-            Block *blk = inactive_list.at(i);
-            if (blk->getFileId().compare(filename) == 0) {
+            Block *blk = next_blk;
+            next_blk = blk->file_next;
 
-                if (location == nullptr) {
-                    location = blk->getLocation();
-                }
+            if (location == nullptr) {
+                location = blk->getLocation();
+            }
 
-                if (read + blk->getSize() <= amount) {
-                    read += blk->getSize();
-                    if (blk->isDirty()) {
-                        dirty_reaccessed += blk->getSize();
-                        this->active_list.push_back(blk);
-                    } else {
-                        clean_reaccessed += blk->getSize();
-                    }
+            if (read + blk->getSize() <= amount) {
+                read += blk->getSize();
+                if (blk->isDirty()) {
+                    dirty_reaccessed += blk->getSize();
+                    moveToBack(this->active_list, blk);
+                } else {
+                    clean_reaccessed += blk->getSize();
                     // remove the existing old block from inactive list
-                    inactive_list.erase(inactive_list.begin() + i);
-                    i--;
+                    deleteBlock(blk);
+                }
+            } else {
+                double blk_read_amt = amount - read;
+                read += blk_read_amt;
+                resizeBlock(blk, blk->getSize() - blk_read_amt);
+                if (blk->isDirty()) {
+                    dirty_reaccessed += blk_read_amt;
+                    pushBack(this->active_list, newBlock(blk->file_id, blk->getLocation(), blk_read_amt,
+                                                         blk->getLastAccess(), true, blk->getDirtyTime()));
                 } else {
-                    double blk_read_amt = amount - read;
-                    read += blk_read_amt;
-                    Block *read_blk = blk->split(blk->getSize() - blk_read_amt);
-                    if (blk->isDirty()) {
-                        dirty_reaccessed += blk_read_amt;
-                        this->active_list.push_back(read_blk);
-                    } else {
-                        clean_reaccessed += blk_read_amt;
-                    }
+                    clean_reaccessed += blk_read_amt;
                 }
             }
         }
 
-        for (unsigned int i = 0; i < active_list.size(); i++) {
+        auto active_file_blocks = active_list.files.find(filename);
+        next_blk = (active_file_blocks == active_list.files.end()) ? nullptr : active_file_blocks->second.head;
+        while (next_blk != nullptr) {
             if (read >= amount) {
                 break;
             }
 
-            Block *blk = active_list.at(i);
-            if (blk->getFileId().compare(filename) == 0) {
+            Block *blk = next_blk;
+            next_blk = blk->file_next;
 
-                if (location == nullptr) {
-                    location = blk->getLocation();
-                }
+            if (location == nullptr) {
+                location = blk->getLocation();
+            }
 
-                if (read + blk->getSize() <= amount) {
-                    read += blk->getSize();
-                    if (blk->isDirty()) {
-                        // move the block to the end of the list
-                        dirty_reaccessed += blk->getSize();
-                        std::rotate(active_list.begin() + i, active_list.begin() + i + 1, active_list.end());
-                    } else {
-                        // delete to create a new clean block
-                        clean_reaccessed += blk->getSize();
-                        active_list.erase(active_list.begin() + i);
+            if (read + blk->getSize() <= amount) {
+                read += blk->getSize();
+                if (blk->isDirty()) {
+                    // move the block to the end of the list (where it will be reached again)
+                    dirty_reaccessed += blk->getSize();
+                    moveToBack(this->active_list, blk);
+                    if (next_blk == nullptr) {
+                        next_blk = blk;
                     }
-                    i--;
                 } else {
-                    double blk_read_amt = amount - read;
-                    read += blk_read_amt;
-                    Block *read_blk = blk->split(blk->getSize() - blk_read_amt);
-                    if (blk->isDirty()) {
-                        dirty_reaccessed += blk_read_amt;
-                        this->active_list.push_back(read_blk);
-                    } else {
-                        clean_reaccessed += blk_read_amt;
-                    }
+                    // delete to create a new clean block
+                    clean_reaccessed += blk->getSize();
+                    deleteBlock(blk);
+                }
+            } else {
+                double blk_read_amt = amount - read;
+                read += blk_read_amt;
+                resizeBlock(blk, blk->getSize() - blk_read_amt);
+                if (blk->isDirty()) {
+                    dirty_reaccessed += blk_read_amt;
+                    pushBack(this->active_list, newBlock(blk->file_id, blk->getLocation(), blk_read_amt,
+                                                         blk->getLastAccess(), true, blk->getDirtyTime()));
+                } else {
+                    clean_reaccessed += blk_read_amt;
                 }
             }
         }
 
         // create new blocks and put in the active list
         if (clean_reaccessed > 0) {
-            Block *new_blk = new Block(filename, location, clean_reaccessed, S4U_Simulation::getClock(), false, 0);
-            active_list.push_back(new_blk);
+            pushBack(active_list, newBlock(filename, location, clean_reaccessed, S4U_Simulation::getClock(), false, 0));
         }
 //        if (dirty_reaccessed > 0) {
 //            Block *new_blk = new Block(filename, mnt_pt, dirty_reaccessed, S4U_Simulation::getClock(), true);
@@ -545,14 +579,17 @@ namespace wrench {
                                    std::shared_ptr<FileLocation> location,
                                    double amount,
                                    bool is_dirty) {
-        auto *bl = new Block(filename, location, amount, S4U_Simulation::getClock(), is_dirty,
-                             S4U_Simulation::getClock());
-        inactive_list.push_back(bl);
+        pushBack(inactive_list, newBlock(filename, location, amount, S4U_Simulation::getClock(), is_dirty,
+                                         S4U_Simulation::getClock()));
 
         this->cached += amount;
         this->free -= amount;
         if (is_dirty) {
             this->dirty += amount;
+            this->dirty_times.push(S4U_Simulation::getClock());
+            if (this->dirty_times.size() == 1) {
+                this->flusher_condition->notify_all();
+            }
         }
     }
 
@@ -572,15 +609,8 @@ namespace wrench {
      * move blocks from the active list to the inactive list to make their sizes equal.
      */
     void MemoryManager::balanceLruLists() {
-        double inactive_size = 0;
-        for (unsigned int i = 0; i < inactive_list.size(); i++) {
-            inactive_size += inactive_list[i]->getSize();
-        }
-
-        double active_size = 0;
-        for (unsigned int i = 0; i < active_list.size(); i++) {
-            active_size += active_list[i]->getSize();
-        }
+        double inactive_size = inactive_list.size;
+        double active_size = active_list.size;
 
         // Active list should not be large then twice the size of the inactive list
         // Balance the lists: make their sizes equal
@@ -589,22 +619,25 @@ namespace wrench {
             double to_move_amt = (active_size - inactive_size) / 2;
             double moved_amt = 0;
 
-            for (unsigned int i = 0; i < active_list.size(); i++) {
-                Block *blk = active_list.at(i);
+            Block *next_blk;
+            for (Block *blk = active_list.head; blk != nullptr; blk = next_blk) {
+                next_blk = blk->lru_next;
+
+                if (moved_amt >= to_move_amt) {
+                    // done moving
+                    break;
+                }
 
                 // move the whole block
                 if (to_move_amt - (moved_amt + blk->getSize()) >= 0) {
-                    inactive_list.push_back(blk);
-                    active_list.erase(active_list.begin() + i);
-                    i--;
+                    moveToBack(inactive_list, blk);
+                    moved_amt += blk->getSize();
                 } else {
                     // split the block
-                    std::string fn = blk->getFileId();
-                    Block *new_blk = new Block(fn, blk->getLocation(), to_move_amt - moved_amt, blk->getLastAccess(),
-                                               blk->isDirty(), blk->getDirtyTime());
-                    inactive_list.push_back(new_blk);
+                    pushBack(inactive_list, newBlock(blk->file_id, blk->getLocation(), to_move_amt - moved_amt,
+                                                     blk->getLastAccess(), blk->isDirty(), blk->getDirtyTime()));
 
-                    blk->setSize(blk->getSize() + moved_amt - to_move_amt);
+                    resizeBlock(blk, blk->getSize() + moved_amt - to_move_amt);
 
                     // finish moving
                     break;
@@ -614,44 +647,46 @@ namespace wrench {
     }
 
     /**
-     * @brief Get amount of cached data of a file in cache
+     * @brief Get amount of cached data of a file in a LRU list
+     * @param list: the LRU list
      * @param filename: name of the file
      * @return the amount of cached data
      */
-    double MemoryManager::getCachedAmount(std::string filename) {
+    double MemoryManager::getCachedAmountInList(const LruList &list, const std::string &filename) {
         double amt = 0;
-
-        for (unsigned int i = 0; i < inactive_list.size(); i++) {
-            if (inactive_list[i]->getFileId().compare(filename) == 0) {
-                amt += inactive_list[i]->getSize();
+        auto file_blocks = list.files.find(filename);
+        if (file_blocks != list.files.end()) {
+            for (Block *blk = file_blocks->second.head; blk != nullptr; blk = blk->file_next) {
+                amt += blk->getSize();
             }
         }
-
-        for (unsigned int i = 0; i < active_list.size(); i++) {
-            if (active_list[i]->getFileId().compare(filename) == 0) {
-                amt += active_list[i]->getSize();
-            }
-        }
-
         return amt;
     }
 
+    /**
+     * @brief Get amount of cached data of a file in cache
+     * @param filename: name of the file
+     * @return the amount of cached data
+     */
+    double MemoryManager::getCachedAmount(std::string filename) {
+        return getCachedAmountInList(inactive_list, filename) + getCachedAmountInList(active_list, filename);
+    }
+
     /**
      * @brief Get list of cached blocks of a file
      * @param filename : name of the file
-     * @return a vector of cached blocks of the file
+     * @return a vector of (copies of) cached blocks of the file, which the caller must delete
      */
     std::vector<Block *> MemoryManager::getCachedBlocks(std::string filename) {
         std::vector<Block *> block_list;
 
-        for (unsigned int i = 0; i < inactive_list.size(); i++) {
-            if (inactive_list[i]->getFileId().compare(filename) == 0) {
-                block_list.push_back(new Block(inactive_list[i]));
+        for (auto list : {&inactive_list, &active_list}) {
+            auto file_blocks = list->files.find(filename);
+            if (file_blocks == list->files.end()) {
+                continue;
             }
-        }
-        for (unsigned int i = 0; i < active_list.size(); i++) {
-            if (active_list[i]->getFileId().compare(filename) == 0) {
-                block_list.push_back(new Block(active_list[i]));
+            for (Block *blk = file_blocks->second.head; blk != nullptr; blk = blk->file_next) {
+                block_list.push_back(new Block(blk));
             }
         }
 
@@ -660,6 +695,130 @@ namespace wrench {
         return block_list;
     }
 
+    /**
+     * @brief Get a new block (recycling a previously deleted block if possible)
+     * @param fid: file id
+     * @param location: file location
+     * @param sz: size in bytes
+     * @param last_access: time of last access
+     * @param is_dirty: dirty status
+     * @param dirty_time: dirty time
+     * @return a block (that is not in any LRU list)
+     */
+    Block *MemoryManager::newBlock(const std::string &fid, const std::shared_ptr<FileLocation> &location, double sz,
+                                   double last_access, bool is_dirty, double dirty_time) {
+        if (this->free_blocks.empty()) {
+            this->block_pool.emplace_back(fid, location, sz, last_access, is_dirty, dirty_time);
+            return &(this->block_pool.back());
+        }
+        Block *blk = this->free_blocks.back();
+        this->free_blocks.pop_back();
+        *blk = Block(fid, location, sz, last_access, is_dirty, dirty_time);
+        return blk;
+    }
+
+    /**
+     * @brief Remove a block from its LRU list, and recycle it
+     * @param blk: the block
+     */
+    void MemoryManager::deleteBlock(Block *blk) {
+        unlink(blk);
+        blk->location = nullptr;
+        this->free_blocks.push_back(blk);
+    }
+
+    /**
+     * @brief Append a block (that is not in any LRU list) to an LRU list
+     * @param list: the LRU list
+     * @param blk: the block
+     */
+    void MemoryManager::pushBack(LruList &list, Block *blk) {
+        blk->in_active_list = (&list == &this->active_list);
+
+        blk->lru_prev = list.tail;
+        blk->lru_next = nullptr;
+        if (list.tail) {
+            list.tail->lru_next = blk;
+        } else {
+            list.head = blk;
+        }
+        list.tail = blk;
+        list.size += blk->size;
+
+        auto &file_blocks = list.files[blk->file_id];
+        blk->file_prev = file_blocks.tail;
+        blk->file_next = nullptr;
+        if (file_blocks.tail) {
+            file_blocks.tail->file_next = blk;
+        } else {
+            file_blocks.head = blk;
+        }
+        file_blocks.tail = blk;
+    }
+
+    /**
+     * @brief Remove a block from its LRU list
+     * @param blk: the block
+     */
+    void MemoryManager::unlink(Block *blk) {
+        LruList &list = blk->in_active_list ? this->active_list : this->inactive_list;
+
+        if (blk->lru_prev) {
+            blk->lru_prev->lru_next = blk->lru_next;
+        } else {
+            list.head = blk->lru_next;
+        }
+        if (blk->lru_next) {
+            blk->lru_next->lru_prev = blk->lru_prev;
+        } else {
+            list.tail = blk->lru_prev;
+        }
+        if (list.head == nullptr) {
+            // Avoid accumulating rounding errors
+            list.size = 0;
+        } else {
+            list.size -= blk->size;
+        }
+
+        if ((blk->file_prev == nullptr) and (blk->file_next == nullptr)) {
+            list.files.erase(blk->file_id);
+        } else {
+            if (blk->file_prev) {
+                blk->file_prev->file_next = blk->file_next;
+            } else {
+                list.files[blk->file_id].head = blk->file_next;
+            }
+            if (blk->file_next) {
+                blk->file_next->file_prev = blk->file_prev;
+            } else {
+                list.files[blk->file_id].tail = blk->file_prev;
+            }
+        }
+
+        blk->lru_prev = blk->lru_next = blk->file_prev = blk->file_next = nullptr;
+    }
+
+    /**
+     * @brief Move a block to the end (most recently used) of an LRU list
+     * @param list: the LRU list
+     * @param blk: the block (in any LRU list)
+     */
+    void MemoryManager::moveToBack(LruList &list, Block *blk) {
+        unlink(blk);
+        pushBack(list, blk);
+    }
+
+    /**
+     * @brief Change the size of a block
+     * @param blk: the block (in any LRU list)
+     * @param size: the new size in bytes
+     */
+    void MemoryManager::resizeBlock(Block *blk, double size) {
+        LruList &list = blk->in_active_list ? this->active_list : this->inactive_list;
+        list.size += size - blk->size;
+        blk->size = size;
+    }
+
     /**
      * @brief Retrieve the disk where the file is stored.
      * @param mountpoint: mountpoint on the disk where the file is stored
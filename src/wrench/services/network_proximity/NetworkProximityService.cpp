@@ -17,6 +17,7 @@
 #include "wrench/services/network_proximity/NetworkProximityService.h"
 #include <wrench/simgrid_S4U_util/S4U_Simulation.h>
 #include <wrench/simulation/SimulationMessage.h>
+#include <wrench/simulation/SimulationMessageTypeSwitch.h>
 #include <wrench/simulation/Simulation.h>
 #include <wrench/simgrid_S4U_util/S4U_Mailbox.h>
 #include <wrench/services/ServiceMessage.h>
@@ -30,6 +31,21 @@ namespace wrench {
 
     constexpr double NetworkProximityService::NOT_AVAILABLE;
 
+    /**
+     * @brief Compute the greatest common divisor of two numbers
+     * @param a: a number
+     * @param b: a number
+     * @return the greatest common divisor of a and b
+     */
+    static unsigned long greatestCommonDivisor(unsigned long a, unsigned long b) {
+        while (b != 0) {
+            unsigned long r = a % b;
+            a = b;
+            b = r;
+        }
+        return a;
+    }
+
     /**
      * @brief Destructor
      */
@@ -61,6 +77,15 @@ namespace wrench {
 
         validateProperties();
 
+        this->is_vivaldi = boost::iequals(
+                this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
+                "vivaldi");
+
+        // Assign host IDs (if a host is listed more than once, its first ID is used)
+        for (unsigned long i = 0; i < this->hosts_in_network.size(); i++) {
+            this->host_ids.insert(std::make_pair(this->hosts_in_network[i], i));
+        }
+
         // Seed the master_rng
         this->master_rng.seed((unsigned int) (this->getPropertyValueAsDouble(
                 wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_PEER_LOOKUP_SEED)));
@@ -89,23 +114,17 @@ namespace wrench {
 
         WRENCH_INFO("Obtaining current coordinates of network daemon on host %s", requested_host.c_str());
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("network_get_coordinate_entry");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new CoordinateLookupRequestMessage(
                             answer_mailbox, requested_host,
                             this->getMessagePayloadValue(
-                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        std::unique_ptr<SimulationMessage> message = nullptr;
-
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -140,23 +159,17 @@ namespace wrench {
                              hosts.second.c_str());
         }
 
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("network_query_entry");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     this->mailbox_name,
                     new NetworkProximityLookupRequestMessage(
                             answer_mailbox, std::move(hosts),
                             this->getMessagePayloadValue(
-                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        std::unique_ptr<SimulationMessage> message = nullptr;
-
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -170,7 +183,21 @@ namespace wrench {
     }
 
     /**
-     * @brief Internal method to add an entry to the database
+     * @brief Internal method to get the ID of a host
+     * @param hostname: the host's name
+     * @return the host's ID, or -1 if the host does not participate in network measurements
+     */
+    long NetworkProximityService::getHostID(const std::string &hostname) {
+        auto it = this->host_ids.find(hostname);
+        if (it == this->host_ids.end()) {
+            return -1;
+        }
+        return (long) it->second;
+    }
+
+    /**
+     * @brief Internal method to add an entry to the database (only 'alltoall' services keep
+     *        pairwise proximity values, as 'vivaldi' services only answer queries based on coordinates)
      * @param pair: a pair of hosts
      * @param proximity_value: proximity value between the pair of hosts
      */
@@ -178,14 +205,17 @@ namespace wrench {
                                                      double proximity_value) {
         WRENCH_INFO("Received new measurement: %s-%s prox=%lf", pair_hosts.first.c_str(), pair_hosts.second.c_str(),
                     proximity_value);
-        if (this->entries.find(pair_hosts) == this->entries.end()) {
-            std::pair<std::pair<std::string, std::string>, std::pair<double, double>> value = std::make_pair(
-                    pair_hosts,
-                    std::make_pair(proximity_value, Simulation::getCurrentSimulatedDate()));
-            this->entries.insert(value);
-        } else {
-            this->entries[pair_hosts] = std::make_pair(proximity_value, Simulation::getCurrentSimulatedDate());
+        if (this->is_vivaldi) {
+            return;
+        }
+        long sender_id = this->getHostID(pair_hosts.first);
+        long peer_id = this->getHostID(pair_hosts.second);
+        if ((sender_id == -1) or (peer_id == -1)) {
+            return;
         }
+        unsigned long index = sender_id * this->hosts_in_network.size() + peer_id;
+        this->proximity_values[index] = proximity_value;
+        this->proximity_dates[index] = Simulation::getCurrentSimulatedDate();
     }
 
     /**
@@ -198,6 +228,16 @@ namespace wrench {
 
         WRENCH_INFO("Network Proximity Service starting on host %s!", S4U_Simulation::getHostName().c_str());
 
+        // Set up the proximity value database or the coordinates
+        unsigned long num_hosts = this->hosts_in_network.size();
+        if (this->is_vivaldi) {
+            this->coordinates.assign(num_hosts, std::complex<double>(0.0));
+            this->coordinate_dates.assign(num_hosts, Simulation::getCurrentSimulatedDate());
+        } else {
+            this->proximity_values.assign(num_hosts * num_hosts, NetworkProximityService::NOT_AVAILABLE);
+            this->proximity_dates.assign(num_hosts * num_hosts, NetworkProximityService::NOT_AVAILABLE);
+        }
+
         // Create  and start network daemons
         for (auto h : this->hosts_in_network) {
             std::shared_ptr<NetworkProximityDaemon> np_daemon = std::shared_ptr<NetworkProximityDaemon>(
@@ -210,15 +250,30 @@ namespace wrench {
                             this->getPropertyValueAsDouble(
                                     NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD_MAX_NOISE),
                             this->messagepayload_list));
+            this->daemon_indices[np_daemon.get()] = this->network_daemons.size();
             this->network_daemons.push_back(np_daemon);
+        }
 
-            // if this network service type is 'vivaldi', setup the coordinate lookup table
-            if (boost::iequals(
-                    this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
-                    "vivaldi")) {
-                this->coordinate_lookup_table.insert(
-                        std::make_pair(h, std::make_pair((0.0), Simulation::getCurrentSimulatedDate())));
-            }
+        // Pick each daemon's potential peers
+        // if the network_service type is 'alltoall', a daemon selects from a pool of all other network daemons
+        // if the network_service type is 'vivaldi', a daemon selects from a subset of all other network daemons
+        // coverage will be (0 < coverage <= 1.0) if this is a 'vivaldi' network service
+        // else if it is an 'alltoall' network service, coverage is set at 1.0
+        double coverage = this->getPropertyValueAsDouble(
+                NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE);
+        unsigned long num_peers = this->network_daemons.size() - 1;
+        this->peer_pool_size = std::max<unsigned long>(1, (unsigned long) std::ceil(coverage * num_peers));
+
+        // A daemon's peers are the first peer_pool_size elements of the permutation k -> (a * k + b) mod num_peers
+        // of the other daemons, which is a permutation as long as a and num_peers are coprime
+        std::uniform_int_distribution<unsigned long> multiplier_dist(1, std::max<unsigned long>(1, num_peers - 1));
+        std::uniform_int_distribution<unsigned long> offset_dist(0, num_peers - 1);
+        for (unsigned long i = 0; i < this->network_daemons.size(); i++) {
+            unsigned long multiplier;
+            do {
+                multiplier = multiplier_dist(this->master_rng);
+            } while (greatestCommonDivisor(multiplier, num_peers) != 1);
+            this->peer_permutations.emplace_back(multiplier, offset_dist(this->master_rng));
         }
 
         // Start all network daemons
@@ -259,160 +314,154 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage *>(message.get())) {
-            // This is Synchronous
-            try {
-                //Stop the network daemons
-                std::vector<std::shared_ptr<NetworkProximityDaemon>>::iterator it;
-                for (it = this->network_daemons.begin(); it != this->network_daemons.end(); it++) {
-                    if ((*it)->isUp()) {
-                        (*it)->stop();
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                NetworkProximityLookupRequestMessage,
+                NetworkProximityComputeAnswerMessage,
+                NextContactDaemonRequestMessage,
+                CoordinateLookupRequestMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                // This is Synchronous
+                try {
+                    //Stop the network daemons
+                    std::vector<std::shared_ptr<NetworkProximityDaemon>>::iterator it;
+                    for (it = this->network_daemons.begin(); it != this->network_daemons.end(); it++) {
+                        if ((*it)->isUp()) {
+                            (*it)->stop();
+                        }
                     }
+                    this->network_daemons.clear();
+                    this->daemon_indices.clear();
+                    this->hosts_in_network.clear();
+                    this->host_ids.clear();
+                    S4U_Mailbox::putMessage(
+                            msg->ack_mailbox,
+                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                    NetworkProximityServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr<NetworkError> &cause) {
+                    return false;
                 }
-                this->network_daemons.clear();
-                this->hosts_in_network.clear();
-                S4U_Mailbox::putMessage(
-                        msg->ack_mailbox,
-                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                NetworkProximityServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr<NetworkError> &cause) {
-                return false;
+                break;
             }
-
-        } else if (auto msg = dynamic_cast<NetworkProximityLookupRequestMessage *>(message.get())) {
-            double proximity_value = NetworkProximityService::NOT_AVAILABLE;
-            double timestamp = NetworkProximityService::NOT_AVAILABLE;
-
-            std::string network_service_type = this->getPropertyValueAsString("NETWORK_PROXIMITY_SERVICE_TYPE");
-
-            if (msg->hosts.first == msg->hosts.second) {
-                proximity_value = 0.0;
-                timestamp = Simulation::getCurrentSimulatedDate();
-            } else {
-
-                if (boost::iequals(network_service_type, "vivaldi")) {
-                    auto host1 = this->coordinate_lookup_table.find(msg->hosts.first);
-                    auto host2 = this->coordinate_lookup_table.find(msg->hosts.second);
-
-                    if (host1 != this->coordinate_lookup_table.end() && host2 != this->coordinate_lookup_table.end()) {
-                        proximity_value = std::sqrt(norm(host2->second.first - host1->second.first));
-                        timestamp = std::min(host1->second.second, host2->second.second);
-                    }
-                } else { // alltoall
-                    if (this->entries.find(msg->hosts) != this->entries.end()) {
-                        proximity_value = std::get<0>(this->entries[msg->hosts]);
-                        timestamp = std::get<1>(this->entries[msg->hosts]);
+            case MessageTypes::indexOf<NetworkProximityLookupRequestMessage>(): {
+                auto msg = static_cast<NetworkProximityLookupRequestMessage *>(message.get());
+                double proximity_value = NetworkProximityService::NOT_AVAILABLE;
+                double timestamp = NetworkProximityService::NOT_AVAILABLE;
+
+                if (msg->hosts.first == msg->hosts.second) {
+                    proximity_value = 0.0;
+                    timestamp = Simulation::getCurrentSimulatedDate();
+                } else {
+                    long host1_id = this->getHostID(msg->hosts.first);
+                    long host2_id = this->getHostID(msg->hosts.second);
+
+                    if ((host1_id != -1) and (host2_id != -1)) {
+                        if (this->is_vivaldi) {
+                            proximity_value = std::sqrt(norm(this->coordinates[host2_id] - this->coordinates[host1_id]));
+                            timestamp = std::min(this->coordinate_dates[host1_id], this->coordinate_dates[host2_id]);
+                        } else { // alltoall
+                            unsigned long index = host1_id * this->hosts_in_network.size() + host2_id;
+                            proximity_value = this->proximity_values[index];
+                            timestamp = this->proximity_dates[index];
+                        }
                     }
                 }
-            }
 
-            S4U_Mailbox::dputMessage(
-                    msg->answer_mailbox,
-                    new NetworkProximityLookupAnswerMessage(
-                            msg->hosts, proximity_value, timestamp,
-                            this->getMessagePayloadValue(
-                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-            return true;
-
-        } else if (auto msg = dynamic_cast<NetworkProximityComputeAnswerMessage *>(message.get())) {
-            this->addEntryToDatabase(msg->hosts, msg->proximity_value);
-
-            if (boost::iequals(
-                    this->getPropertyValueAsString(NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE),
-                    "vivaldi")) {
-                vivaldiUpdate(msg->proximity_value, msg->hosts.first, msg->hosts.second);
+                S4U_Mailbox::dputMessage(
+                        msg->answer_mailbox,
+                        new NetworkProximityLookupAnswerMessage(
+                                msg->hosts, proximity_value, timestamp,
+                                this->getMessagePayloadValue(
+                                        NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+                return true;
             }
-            return true;
+            case MessageTypes::indexOf<NetworkProximityComputeAnswerMessage>(): {
+                auto msg = static_cast<NetworkProximityComputeAnswerMessage *>(message.get());
+                this->addEntryToDatabase(msg->hosts, msg->proximity_value);
 
-        } else if (auto msg = dynamic_cast<NextContactDaemonRequestMessage *>(message.get())) {
-            std::shared_ptr<NetworkProximityDaemon> chosen_peer = NetworkProximityService::getCommunicationPeer(
-                    msg->daemon);
-
-            S4U_Mailbox::dputMessage(
-                    msg->daemon->mailbox_name,
-                    new NextContactDaemonAnswerMessage(
-                            chosen_peer->getHostname(),
-                            chosen_peer,
-                            chosen_peer->mailbox_name,
+                if (this->is_vivaldi) {
+                    vivaldiUpdate(msg->proximity_value, msg->hosts.first, msg->hosts.second);
+                }
+                return true;
+            }
+            case MessageTypes::indexOf<NextContactDaemonRequestMessage>(): {
+                auto msg = static_cast<NextContactDaemonRequestMessage *>(message.get());
+                std::shared_ptr<NetworkProximityDaemon> chosen_peer = NetworkProximityService::getCommunicationPeer(
+                        msg->daemon);
+
+                S4U_Mailbox::dputMessage(
+                        msg->daemon->mailbox_name,
+                        new NextContactDaemonAnswerMessage(
+                                chosen_peer->getHostname(),
+                                chosen_peer,
+                                chosen_peer->mailbox_name,
+                                this->getMessagePayloadValue(
+                                        NetworkProximityServiceMessagePayload::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)));
+                return true;
+            }
+            case MessageTypes::indexOf<CoordinateLookupRequestMessage>(): {
+                auto msg = static_cast<CoordinateLookupRequestMessage *>(message.get());
+                std::string requested_host = msg->requested_host;
+                long host_id = this->is_vivaldi ? this->getHostID(requested_host) : -1;
+                CoordinateLookupAnswerMessage *msg_to_send_back = nullptr;
+
+                if (host_id != -1) {
+                    msg_to_send_back = new CoordinateLookupAnswerMessage(
+                            requested_host,
+                            true,
+                            std::make_pair(
+                                    this->coordinates[host_id].real(),
+                                    this->coordinates[host_id].imag()),
+                            this->coordinate_dates[host_id],
                             this->getMessagePayloadValue(
-                                    NetworkProximityServiceMessagePayload::NETWORK_DAEMON_CONTACT_ANSWER_PAYLOAD)));
-            return true;
-
-        } else if (auto msg = dynamic_cast<CoordinateLookupRequestMessage *>(message.get())) {
-            std::string requested_host = msg->requested_host;
-            auto const coordinate_itr = this->coordinate_lookup_table.find(requested_host);
-            CoordinateLookupAnswerMessage *msg_to_send_back = nullptr;
-
-            if (coordinate_itr != this->coordinate_lookup_table.cend()) {
-                msg_to_send_back = new CoordinateLookupAnswerMessage(
-                        requested_host,
-                        true,
-                        std::make_pair(
-                                coordinate_itr->second.first.real(),
-                                coordinate_itr->second.first.imag()),
-                        coordinate_itr->second.second,
-                        this->getMessagePayloadValue(
-                                NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD));
-            } else {
-                msg_to_send_back = new CoordinateLookupAnswerMessage(
-                        requested_host,
-                        false,
-                        std::make_pair(0, 0),
-                        0,
-                        this->getMessagePayloadValue(
-                                NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD));
+                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD));
+                } else {
+                    msg_to_send_back = new CoordinateLookupAnswerMessage(
+                            requested_host,
+                            false,
+                            std::make_pair(0, 0),
+                            0,
+                            this->getMessagePayloadValue(
+                                    NetworkProximityServiceMessagePayload::NETWORK_DB_LOOKUP_ANSWER_MESSAGE_PAYLOAD));
+                }
+                S4U_Mailbox::dputMessage(msg->answer_mailbox, msg_to_send_back);
+                return true;
+            }
+            default: {
+                throw std::runtime_error(
+                        "NetworkProximityService::processNextMessage(): Unexpected [" + message->getName() + "] message");
             }
-            S4U_Mailbox::dputMessage(msg->answer_mailbox, msg_to_send_back);
-            return true;
-
-        } else {
-            throw std::runtime_error(
-                    "NetworkProximityService::processNextMessage(): Unexpected [" + message->getName() + "] message");
         }
         return false;
     }
 
     /**
-     * @brief Internal method to choose a communication peer for the requesting network proximity daemon
+     * @brief Internal method to choose a communication peer for the requesting network proximity daemon,
+     *        uniformly among that daemon's potential peers, in constant time
      * @param sender_daemon: the network daemon requesting a peer to communicate with next
      * @return a shared_ptr to the network daemon that is the selected communication peer
      */
     std::shared_ptr<NetworkProximityDaemon>
     NetworkProximityService::getCommunicationPeer(const std::shared_ptr<NetworkProximityDaemon> sender_daemon) {
-        // coverage will be (0 < coverage <= 1.0) if this is a 'vivaldi' network service
-        // else if it is an 'alltoall' network service, coverage is set at 1.0
-        double coverage = this->getPropertyValueAsDouble("NETWORK_DAEMON_COMMUNICATION_COVERAGE");
-        unsigned long max_pool_size = this->network_daemons.size() - 1;
-
-        // if the network_service type is 'alltoall', sender_daemon selects from a pool of all other network daemons
-        // if the network_service type is 'vivaldi', sender_daemon selects from a subset of the max_pool_size
-        auto pool_size = (unsigned long) (std::ceil(coverage * max_pool_size));
-
-        std::hash<std::string> hash_func;
-        std::default_random_engine sender_rng;
-        // uniform distribution to be used by the sending daemon's rng
-        std::uniform_int_distribution<unsigned long> s_udist;
-
-        // uniform distribution to be used by master rng
-        static std::uniform_int_distribution<unsigned long> m_udist(0, pool_size - 1);
-
-        std::vector<unsigned long> peer_list;
-
-        // all the network daemons EXCEPT the sender get pushed into this vector
-        for (unsigned long index = 0; index < this->network_daemons.size(); ++index) {
-            if (this->network_daemons[index]->mailbox_name != sender_daemon->mailbox_name) {
-                peer_list.push_back(index);
-            }
+        auto it = this->daemon_indices.find(sender_daemon.get());
+        if (it == this->daemon_indices.end()) {
+            throw std::runtime_error("NetworkProximityService::getCommunicationPeer(): Unknown network daemon");
         }
+        unsigned long sender_index = it->second;
+        unsigned long num_peers = this->network_daemons.size() - 1;
 
-        // set the seed unique to the sending daemon
-        sender_rng.seed((unsigned long) hash_func(sender_daemon->mailbox_name));
-
-        std::shuffle(peer_list.begin(), peer_list.end(), sender_rng);
+        // Pick one of the sender's potential peers, i.e., a rank in the sender's permutation of the other daemons
+        std::uniform_int_distribution<unsigned long> rank_dist(0, this->peer_pool_size - 1);
+        auto const &permutation = this->peer_permutations[sender_index];
+        unsigned long peer_rank = (permutation.first * rank_dist(this->master_rng) + permutation.second) % num_peers;
 
-        unsigned long chosen_peer_index = peer_list.at(m_udist(master_rng));
+        // Skip the sender itself
+        unsigned long peer_index = (peer_rank < sender_index) ? peer_rank : peer_rank + 1;
 
-        return std::shared_ptr<NetworkProximityDaemon>(this->network_daemons.at(chosen_peer_index));
+        return this->network_daemons[peer_index];
     }
 
     /**
@@ -427,15 +476,14 @@ namespace wrench {
 
         std::complex<double> sender_coordinates, peer_coordinates;
 
-        auto search = this->coordinate_lookup_table.find(
-                sender_hostname);
-        if (search != this->coordinate_lookup_table.end()) {
-            sender_coordinates = search->second.first;
+        long sender_id = this->getHostID(sender_hostname);
+        if (sender_id != -1) {
+            sender_coordinates = this->coordinates[sender_id];
         }
 
-        search = this->coordinate_lookup_table.find(peer_hostname);
-        if (search != this->coordinate_lookup_table.end()) {
-            peer_coordinates = search->second.first;
+        long peer_id = this->getHostID(peer_hostname);
+        if (peer_id != -1) {
+            peer_coordinates = this->coordinates[peer_id];
         }
 
         double estimated_distance = std::sqrt(norm(peer_coordinates - sender_coordinates));
@@ -461,11 +509,10 @@ namespace wrench {
         // compute the updated sender coordinates
         auto updated_sender_coordinates = sender_coordinates + (scaled_direction * sensitivity);
 
-        // update the coordinate_lookup_table with the updated sender_coordinates
-        search = this->coordinate_lookup_table.find(sender_hostname);
-        if (search != this->coordinate_lookup_table.end()) {
-            search->second.first = updated_sender_coordinates;
-            search->second.second = Simulation::getCurrentSimulatedDate();
+        // update the coordinates with the updated sender_coordinates
+        if (sender_id != -1) {
+            this->coordinates[sender_id] = updated_sender_coordinates;
+            this->coordinate_dates[sender_id] = Simulation::getCurrentSimulatedDate();
         }
 
         WRENCH_DEBUG("Vivaldi updated coordinates of %s from (%f,%f) to (%f,%f)", sender_hostname.c_str(),
@@ -127,21 +127,17 @@ namespace wrench {
     std::map<std::string, double> StorageService::getFreeSpace() {
         assertServiceIsUp();
 
-        // Send a message to the daemon
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("how_much_free_space");
-        try {
-            S4U_Mailbox::putMessage(this->mailbox_name, new StorageServiceFreeSpaceRequestMessage(
-                    answer_mailbox,
-                    this->getMessagePayloadValue(
-                            StorageServiceMessagePayload::FREE_SPACE_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Wait for a reply
+        // Send a message to the daemon and wait for a reply
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
         std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, this->network_timeout);
+            message = S4U_Mailbox::putRequestAndGetAnswer(
+                    this->mailbox_name,
+                    new StorageServiceFreeSpaceRequestMessage(
+                            answer_mailbox,
+                            this->getMessagePayloadValue(
+                                    StorageServiceMessagePayload::FREE_SPACE_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, this->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -174,25 +170,19 @@ namespace wrench {
 
         assertServiceIsUp(storage_service);
 
-        // Send a message to the daemon
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("lookup_file");
+        // Send a message to the daemon and wait for a reply
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
+        std::shared_ptr<SimulationMessage> message;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     location->getStorageService()->mailbox_name,
                     new StorageServiceFileLookupRequestMessage(
                             answer_mailbox,
                             file,
                             location,
                             storage_service->getMessagePayloadValue(
-                                    StorageServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Wait for a reply
-        std::shared_ptr<SimulationMessage> message;
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, storage_service->network_timeout);
+                                    StorageServiceMessagePayload::FILE_LOOKUP_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, storage_service->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -224,7 +214,7 @@ namespace wrench {
         assertServiceIsUp(storage_service);
 
         // Send a message to the daemon
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("read_file");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         try {
             S4U_Mailbox::putMessage(storage_service->mailbox_name,
@@ -256,42 +246,39 @@ namespace wrench {
                 throw WorkflowExecutionException(cause);
             }
 
-            if (storage_service->buffer_size == 0) {
-                throw std::runtime_error("StorageService::readFile(): Zero buffer size not implemented yet");
-
-            } else {
-                // Otherwise, retrieve the file chunks until the last one is received
-                while (true) {
-                    std::shared_ptr<SimulationMessage> file_content_message = nullptr;
-                    try {
-                        file_content_message = S4U_Mailbox::getMessage(answer_mailbox);
-                    } catch (std::shared_ptr<NetworkError> &cause) {
-                        throw WorkflowExecutionException(cause);
-                    }
-
-                    if (auto file_content_chunk_msg = dynamic_cast<StorageServiceFileContentChunkMessage *>(
-                            file_content_message.get())) {
-                        if (file_content_chunk_msg->last_chunk) {
-                            break;
-                        }
-                    } else {
-                        throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
-                                                 file_content_message->getName() + "] message!");
-                    }
-                }
-
-                //Waiting for the final ack
+            // Retrieve the file chunks until the last one is received (with a zero buffer size,
+            // i.e., the ideal fluid model, the whole file comes as a single chunk)
+            while (true) {
+                std::shared_ptr<SimulationMessage> file_content_message = nullptr;
                 try {
-                    message = S4U_Mailbox::getMessage(answer_mailbox, storage_service->network_timeout);
+                    file_content_message = S4U_Mailbox::getMessage(answer_mailbox);
                 } catch (std::shared_ptr<NetworkError> &cause) {
                     throw WorkflowExecutionException(cause);
                 }
-                if (not dynamic_cast<StorageServiceAckMessage *>(message.get())) {
+
+                if (auto file_content_chunk_msg = dynamic_cast<StorageServiceFileContentChunkMessage *>(
+                        file_content_message.get())) {
+                    if (file_content_chunk_msg->last_chunk) {
+                        break;
+                    }
+                } else {
                     throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
-                                             message->getName() + "] message!");
+                                             file_content_message->getName() + "] message!");
                 }
             }
 
+            //Waiting for the final ack
+            try {
+                message = S4U_Mailbox::getMessage(answer_mailbox, storage_service->network_timeout);
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                throw WorkflowExecutionException(cause);
+            }
+            if (not dynamic_cast<StorageServiceAckMessage *>(message.get())) {
+                throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
+                                         message->getName() + "] message!");
+            }
+            S4U_Mailbox::retireTemporaryMailbox(answer_mailbox);
+
         } else {
             throw std::runtime_error("StorageService::readFile(): Received an unexpected [" +
                                      message->getName() + "] message!");
@@ -317,7 +304,7 @@ namespace wrench {
         assertServiceIsUp(storage_service);
 
         // Send a  message to the daemon
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("write_file");
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
 
         try {
             S4U_Mailbox::putMessage(storage_service->mailbox_name,
@@ -347,36 +334,34 @@ namespace wrench {
                 throw WorkflowExecutionException(msg->failure_cause);
             }
 
-            if (storage_service->buffer_size == 0) {
-                throw std::runtime_error("StorageService::writeFile(): Zero buffer size not implemented yet");
-            } else {
-                try {
-                    double remaining = file->getSize();
-                    while (remaining > storage_service->buffer_size) {
-                        S4U_Mailbox::putMessage(msg->data_write_mailbox_name,
-                                                new StorageServiceFileContentChunkMessage(
-                                                        file, storage_service->buffer_size, false));
-                        remaining -= storage_service->buffer_size;
-                    }
-                    S4U_Mailbox::putMessage(msg->data_write_mailbox_name, new StorageServiceFileContentChunkMessage(
-                            file, remaining, true));
-
-                } catch (std::shared_ptr<NetworkError> &cause) {
-                    throw WorkflowExecutionException(cause);
+            try {
+                double remaining = file->getSize();
+                // With a zero buffer size (i.e., the ideal fluid model), the whole file is sent as a single chunk
+                while ((storage_service->buffer_size > 0) and (remaining > storage_service->buffer_size)) {
+                    S4U_Mailbox::putMessage(msg->data_write_mailbox_name,
+                                            new StorageServiceFileContentChunkMessage(
+                                                    file, storage_service->buffer_size, false));
+                    remaining -= storage_service->buffer_size;
                 }
+                S4U_Mailbox::putMessage(msg->data_write_mailbox_name, new StorageServiceFileContentChunkMessage(
+                        file, remaining, true));
 
-                //Waiting for the final ack
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                throw WorkflowExecutionException(cause);
+            }
 
-                try {
-                    message = S4U_Mailbox::getMessage(answer_mailbox, storage_service->network_timeout);
-                } catch (std::shared_ptr<NetworkError> &cause) {
-                    throw WorkflowExecutionException(cause);
-                }
-                if (not dynamic_cast<StorageServiceAckMessage *>(message.get())) {
-                    throw std::runtime_error("StorageService::writeFile(): Received an unexpected [" +
-                                             message->getName() + "] message!");
-                }
+            //Waiting for the final ack
+
+            try {
+                message = S4U_Mailbox::getMessage(answer_mailbox, storage_service->network_timeout);
+            } catch (std::shared_ptr<NetworkError> &cause) {
+                throw WorkflowExecutionException(cause);
             }
+            if (not dynamic_cast<StorageServiceAckMessage *>(message.get())) {
+                throw std::runtime_error("StorageService::writeFile(): Received an unexpected [" +
+                                         message->getName() + "] message!");
+            }
+            S4U_Mailbox::retireTemporaryMailbox(answer_mailbox);
 
         } else {
             throw std::runtime_error("StorageService::writeFile(): Received an unexpected [" +
@@ -480,25 +465,19 @@ namespace wrench {
         assertServiceIsUp(storage_service);
 
         bool unregister = (file_registry_service != nullptr);
-        // Send a message to the daemon
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("delete_file");
-        try {
-            S4U_Mailbox::putMessage(storage_service->mailbox_name,
-                                    new StorageServiceFileDeleteRequestMessage(
-                                            answer_mailbox,
-                                            file,
-                                            location,
-                                            storage_service->getMessagePayloadValue(
-                                                    StorageServiceMessagePayload::FILE_DELETE_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Wait for a reply
+        // Send a message to the daemon and wait for a reply
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
         std::unique_ptr<SimulationMessage> message = nullptr;
-
         try {
-            message = S4U_Mailbox::getMessage(answer_mailbox, storage_service->network_timeout);
+            message = S4U_Mailbox::putRequestAndGetAnswer(
+                    storage_service->mailbox_name,
+                    new StorageServiceFileDeleteRequestMessage(
+                            answer_mailbox,
+                            file,
+                            location,
+                            storage_service->getMessagePayloadValue(
+                                    StorageServiceMessagePayload::FILE_DELETE_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox, storage_service->network_timeout);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -539,14 +518,15 @@ namespace wrench {
         assertServiceIsUp(src_location->getStorageService());
         assertServiceIsUp(dst_location->getStorageService());
 
-        // Send a message to the daemon of the dst service
-        std::string answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("copy_file");
+        // Send a message to the daemon of the dst service and wait for a reply
+        std::string answer_mailbox = S4U_Mailbox::getTemporaryMailbox();
         src_location->getStorageService()->simulation->getOutput().addTimestampFileCopyStart(file,
                                                                                              src_location,
                                                                                              dst_location);
 
+        std::unique_ptr<SimulationMessage> message = nullptr;
         try {
-            S4U_Mailbox::putMessage(
+            message = S4U_Mailbox::putRequestAndGetAnswer(
                     dst_location->getStorageService()->mailbox_name,
                     new StorageServiceFileCopyRequestMessage(
                             answer_mailbox,
@@ -555,16 +535,8 @@ namespace wrench {
                             dst_location,
                             nullptr,
                             dst_location->getStorageService()->getMessagePayloadValue(
-                                    StorageServiceMessagePayload::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)));
-        } catch (std::shared_ptr<NetworkError> &cause) {
-            throw WorkflowExecutionException(cause);
-        }
-
-        // Wait for a reply
-        std::unique_ptr<SimulationMessage> message = nullptr;
-
-        try {
-            message = S4U_Mailbox::getMessage(answer_mailbox);
+                                    StorageServiceMessagePayload::FILE_COPY_REQUEST_MESSAGE_PAYLOAD)),
+                    answer_mailbox);
         } catch (std::shared_ptr<NetworkError> &cause) {
             throw WorkflowExecutionException(cause);
         }
@@ -23,6 +23,7 @@
 #include "wrench/workflow/WorkflowFile.h"
 #include "wrench/exceptions/WorkflowExecutionException.h"
 #include "wrench/simulation/SimulationTimestampTypes.h"
+#include "wrench/simulation/SimulationMessageTypeSwitch.h"
 #include "wrench/services/storage/storage_helpers/FileLocation.h"
 #include "wrench/services/memory/MemoryManager.h"
 
@@ -177,72 +178,93 @@ namespace wrench {
 
         WRENCH_DEBUG("Got a [%s] message", message->getName().c_str());
 
-        if (auto msg = dynamic_cast<ServiceStopDaemonMessage*>(message.get())) {
-            try {
-                S4U_Mailbox::putMessage(msg->ack_mailbox,
-                                        new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
-                                                SimpleStorageServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
-            } catch (std::shared_ptr <NetworkError> &cause) {
+        typedef SimulationMessageTypeSwitch<ServiceStopDaemonMessage,
+                StorageServiceFreeSpaceRequestMessage,
+                StorageServiceFileDeleteRequestMessage,
+                StorageServiceFileLookupRequestMessage,
+                StorageServiceFileWriteRequestMessage,
+                StorageServiceFileReadRequestMessage,
+                StorageServiceFileCopyRequestMessage,
+                FileTransferThreadNotificationMessage> MessageTypes;
+        static MessageTypes message_types;
+
+        switch (message_types.lookup(message.get())) {
+            case MessageTypes::indexOf<ServiceStopDaemonMessage>(): {
+                auto msg = static_cast<ServiceStopDaemonMessage *>(message.get());
+                try {
+                    S4U_Mailbox::putMessage(msg->ack_mailbox,
+                                            new ServiceDaemonStoppedMessage(this->getMessagePayloadValue(
+                                                    SimpleStorageServiceMessagePayload::DAEMON_STOPPED_MESSAGE_PAYLOAD)));
+                } catch (std::shared_ptr <NetworkError> &cause) {
+                    return false;
+                }
                 return false;
             }
-            return false;
+            case MessageTypes::indexOf<StorageServiceFreeSpaceRequestMessage>(): {
+                auto msg = static_cast<StorageServiceFreeSpaceRequestMessage *>(message.get());
+                std::map<std::string, double> free_space;
 
-        } else if (auto msg = dynamic_cast<StorageServiceFreeSpaceRequestMessage*>(message.get())) {
-            std::map<std::string, double> free_space;
+                for (auto const &mp : this->file_systems) {
+                    free_space[mp.first] = mp.second->getFreeSpace();
+                }
 
-            for (auto const &mp : this->file_systems) {
-                free_space[mp.first] = mp.second->getFreeSpace();
+                S4U_Mailbox::dputMessage(
+                        msg->answer_mailbox,
+                        new StorageServiceFreeSpaceAnswerMessage(
+                                free_space,
+                                this->getMessagePayloadValue(
+                                        SimpleStorageServiceMessagePayload::FREE_SPACE_ANSWER_MESSAGE_PAYLOAD)));
+                return true;
+            }
+            case MessageTypes::indexOf<StorageServiceFileDeleteRequestMessage>(): {
+                auto msg = static_cast<StorageServiceFileDeleteRequestMessage *>(message.get());
+                return processFileDeleteRequest(msg->file, msg->location, msg->answer_mailbox);
+            }
+            case MessageTypes::indexOf<StorageServiceFileLookupRequestMessage>(): {
+                auto msg = static_cast<StorageServiceFileLookupRequestMessage *>(message.get());
+                auto fs = this->file_systems[msg->location->getMountPoint()].get();
+                bool file_found = fs->isFileInDirectory(msg->file, msg->location->getAbsolutePathAtMountPoint());
+
+                S4U_Mailbox::dputMessage(
+                        msg->answer_mailbox,
+                        new StorageServiceFileLookupAnswerMessage(
+                                msg->file, file_found,
+                                this->getMessagePayloadValue(
+                                        SimpleStorageServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
+                return true;
+            }
+            case MessageTypes::indexOf<StorageServiceFileWriteRequestMessage>(): {
+                auto msg = static_cast<StorageServiceFileWriteRequestMessage *>(message.get());
+                return processFileWriteRequest(msg->file, msg->location, msg->answer_mailbox, msg->buffer_size);
+            }
+            case MessageTypes::indexOf<StorageServiceFileReadRequestMessage>(): {
+                auto msg = static_cast<StorageServiceFileReadRequestMessage *>(message.get());
+                return processFileReadRequest(msg->file, msg->location, msg->answer_mailbox,
+                                              msg->mailbox_to_receive_the_file_content, msg->buffer_size);
+            }
+            case MessageTypes::indexOf<StorageServiceFileCopyRequestMessage>(): {
+                auto msg = static_cast<StorageServiceFileCopyRequestMessage *>(message.get());
+                return processFileCopyRequest(msg->file, msg->src, msg->dst, msg->answer_mailbox);
+            }
+            case MessageTypes::indexOf<FileTransferThreadNotificationMessage>(): {
+                auto msg = static_cast<FileTransferThreadNotificationMessage *>(message.get());
+                return processFileTransferThreadNotification(
+                        msg->file_transfer_thread,
+                        msg->file,
+                        msg->src_mailbox,
+                        msg->src_location,
+                        msg->dst_mailbox,
+                        msg->dst_location,
+                        msg->success,
+                        msg->failure_cause,
+                        msg->answer_mailbox_if_read,
+                        msg->answer_mailbox_if_write,
+                        msg->answer_mailbox_if_copy);
+            }
+            default: {
+                throw std::runtime_error(
+                        "SimpleStorageService::processNextMessage(): Unexpected [" + message->getName() + "] message");
             }
-
-            S4U_Mailbox::dputMessage(
-                    msg->answer_mailbox,
-                    new StorageServiceFreeSpaceAnswerMessage(
-                            free_space,
-                            this->getMessagePayloadValue(
-                                    SimpleStorageServiceMessagePayload::FREE_SPACE_ANSWER_MESSAGE_PAYLOAD)));
-            return true;
-
-        } else if (auto msg = dynamic_cast<StorageServiceFileDeleteRequestMessage*>(message.get())) {
-            return processFileDeleteRequest(msg->file, msg->location, msg->answer_mailbox);
-
-        } else if (auto msg = dynamic_cast<StorageServiceFileLookupRequestMessage*>(message.get())) {
-            auto fs = this->file_systems[msg->location->getMountPoint()].get();
-            bool file_found = fs->isFileInDirectory(msg->file, msg->location->getAbsolutePathAtMountPoint());
-
-            S4U_Mailbox::dputMessage(
-                    msg->answer_mailbox,
-                    new StorageServiceFileLookupAnswerMessage(
-                            msg->file, file_found,
-                            this->getMessagePayloadValue(
-                                    SimpleStorageServiceMessagePayload::FILE_LOOKUP_ANSWER_MESSAGE_PAYLOAD)));
-            return true;
-
-        } else if (auto msg = dynamic_cast<StorageServiceFileWriteRequestMessage*>(message.get())) {
-            return processFileWriteRequest(msg->file, msg->location, msg->answer_mailbox, msg->buffer_size);
-
-        } else if (auto msg = dynamic_cast<StorageServiceFileReadRequestMessage*>(message.get())) {
-            return processFileReadRequest(msg->file, msg->location, msg->answer_mailbox,
-                                          msg->mailbox_to_receive_the_file_content, msg->buffer_size);
-
-        } else if (auto msg = dynamic_cast<StorageServiceFileCopyRequestMessage*>(message.get())) {
-            return processFileCopyRequest(msg->file, msg->src, msg->dst, msg->answer_mailbox);
-
-        } else if (auto msg = dynamic_cast<FileTransferThreadNotificationMessage*>(message.get())) {
-            return processFileTransferThreadNotification(
-                    msg->file_transfer_thread,
-                    msg->file,
-                    msg->src_mailbox,
-                    msg->src_location,
-                    msg->dst_mailbox,
-                    msg->dst_location,
-                    msg->success,
-                    msg->failure_cause,
-                    msg->answer_mailbox_if_read,
-                    msg->answer_mailbox_if_write,
-                    msg->answer_mailbox_if_copy);
-        } else {
-            throw std::runtime_error(
-                    "SimpleStorageService::processNextMessage(): Unexpected [" + message->getName() + "] message");
         }
     }
 
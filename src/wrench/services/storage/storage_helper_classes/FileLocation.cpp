@@ -19,6 +19,9 @@
 
 namespace wrench {
 
+    std::deque<std::string> FileLocation::interned_paths;
+    std::unordered_map<std::string, unsigned long> FileLocation::interned_path_ids;
+
     std::shared_ptr<FileLocation> FileLocation::SCRATCH = std::shared_ptr<FileLocation>(new FileLocation(nullptr, "", ""));
 
 
@@ -117,8 +120,7 @@ namespace wrench {
         if (this == FileLocation::SCRATCH.get()) {
             return "scratch";
         } else {
-            return this->storage_service->getName() + ":" +
-                   sanitizePath(this->mount_point + this->absolute_path_at_mount_point);
+            return this->storage_service->getName() + ":" + this->full_absolute_path;
         }
     }
 
@@ -171,16 +173,80 @@ namespace wrench {
         if (this == FileLocation::SCRATCH.get()) {
             throw std::invalid_argument("FileLocation::getFullAbsolutePath(): Method cannot be called on FileLocation::SCRATCH");
         }
-        return FileLocation::sanitizePath(this->mount_point + "/" + this->absolute_path_at_mount_point);
+        return this->full_absolute_path;
     }
 
 
     /**
      * @brief Method to sanitize an absolute path (and make it absolute if it's not)
      * @param path: an absolute path
-     * @return
+     * @return the sanitized path
+     *
+     * @throw std::invalid_argument
      */
     std::string FileLocation::sanitizePath(std::string path) {
+        return interned_paths[internPath(path)];
+    }
+
+    /**
+     * @brief Intern a path: the path is sanitized the first time it is seen, and later
+     *        calls for the same path (or for any path that sanitizes to the same path)
+     *        return the same ID without sanitizing again
+     * @param path: an absolute path
+     * @return the ID of the sanitized path
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned long FileLocation::internPath(const std::string &path) {
+        auto it = interned_path_ids.find(path);
+        if (it != interned_path_ids.end()) {
+            return it->second;
+        }
+
+        std::string sanitized = doSanitizePath(path);
+        unsigned long path_id;
+        auto sanitized_it = interned_path_ids.find(sanitized);
+        if (sanitized_it != interned_path_ids.end()) {
+            path_id = sanitized_it->second;
+        } else {
+            path_id = interned_paths.size();
+            interned_paths.push_back(sanitized);
+            interned_path_ids[sanitized] = path_id;
+        }
+        interned_path_ids[path] = path_id;
+        return path_id;
+    }
+
+    /**
+     * @brief Get an interned path
+     * @param path_id: a path ID, as returned by internPath()
+     * @return the sanitized path
+     *
+     * @throw std::invalid_argument
+     */
+    const std::string &FileLocation::getInternedPath(unsigned long path_id) {
+        if (path_id >= interned_paths.size()) {
+            throw std::invalid_argument("FileLocation::getInternedPath(): Invalid path ID");
+        }
+        return interned_paths[path_id];
+    }
+
+    /**
+     * @brief Get the number of interned paths
+     * @return a number of distinct sanitized paths
+     */
+    unsigned long FileLocation::getNumInternedPaths() {
+        return interned_paths.size();
+    }
+
+    /**
+     * @brief Sanitize an absolute path (without looking up the interned paths)
+     * @param path: an absolute path
+     * @return the sanitized path
+     *
+     * @throw std::invalid_argument
+     */
+    std::string FileLocation::doSanitizePath(std::string path) {
 
 
         if (path.empty()) {
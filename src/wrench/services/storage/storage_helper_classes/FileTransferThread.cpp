@@ -251,8 +251,35 @@ namespace wrench {
                                                     std::shared_ptr<FileLocation> location) {
         /** Ideal Fluid model buffer size */
         if (this->buffer_size == 0) {
-            throw std::runtime_error(
-                    "FileTransferThread::receiveFileFromNetwork(): Zero buffer size not implemented yet");
+            /** The whole file comes in a single message, and is written to disk while it is being received */
+            auto req = S4U_Mailbox::igetMessage(mailbox);
+
+            if (Simulation::isPageCachingEnabled()) {
+                simulation->getMemoryManagerByHost(location->getStorageService()->hostname)->log();
+
+                // In NFS, write to cache only if the current host not the server host where the file is stored
+                // If the current host is file server, write to disk directly
+                bool write_locally = location->getServerStorageService() == nullptr;
+
+                if (write_locally) {
+                    simulation->writebackWithMemoryCache(file, file->getSize(), location, true);
+                } else {
+                    simulation->writeThroughWithMemoryCache(file, file->getSize(), location);
+                }
+
+                simulation->getMemoryManagerByHost(location->getStorageService()->hostname)->log();
+            } else {
+                // Write to disk
+                simulation->writeToDisk(file->getSize(), location->getStorageService()->hostname,
+                                        location->getMountPoint());
+            }
+
+            // Wait for the comm to finish
+            auto msg = req->wait();
+            if (not dynamic_cast<StorageServiceFileContentChunkMessage *>(msg.get())) {
+                throw std::runtime_error("FileTransferThread::receiveFileFromNetwork() : Received an unexpected [" +
+                                         msg->getName() + "] message!");
+            }
 
         } else {
             /** Non-zero buffer size */
@@ -346,8 +373,25 @@ namespace wrench {
                                                     std::string mailbox) {
         /** Ideal Fluid model buffer size */
         if (this->buffer_size == 0) {
-            throw std::runtime_error(
-                    "FileTransferThread::sendLocalFileToNetwork(): Zero buffer size not implemented yet");
+            /** The whole file is sent as a single message, while it is being read from disk */
+            // Sending a zero-byte file is really sending a 1-byte file
+            double size = std::max<double>(1, file->getSize());
+
+            auto req = S4U_Mailbox::iputMessage(mailbox,
+                                                new StorageServiceFileContentChunkMessage(
+                                                        this->file, (unsigned long) size, true));
+
+            if (Simulation::isPageCachingEnabled()) {
+                simulation->getMemoryManagerByHost(location->getStorageService()->hostname)->log();
+                simulation->readWithMemoryCache(file, size, location);
+                simulation->getMemoryManagerByHost(location->getStorageService()->hostname)->log();
+            } else {
+                simulation->readFromDisk(size, location->getStorageService()->hostname,
+                                         location->getMountPoint());
+            }
+
+            req->wait();
+            WRENCH_INFO("Bytes sent over the network were received");
 
         } else {
             try {
@@ -413,8 +457,10 @@ namespace wrench {
 
         /** Ideal Fluid model buffer size */
         if (this->buffer_size == 0) {
-            throw std::runtime_error(
-                    "FileTransferThread::copyFileLocally(): Zero buffer size not implemented yet");
+            // Read and write the whole file concurrently
+            simulation->readFromDiskAndWriteToDiskConcurrently(
+                    remaining, remaining, src_location->getStorageService()->hostname,
+                    src_location->getMountPoint(), dst_location->getMountPoint());
 
         } else {
             // Read the first chunk
@@ -467,8 +513,7 @@ namespace wrench {
 
         // Send a message to the source
         std::string request_answer_mailbox = S4U_Mailbox::generateUniqueMailboxName("read_file_request");
-        std::string mailbox_that_should_receive_file_content = S4U_Mailbox::generateUniqueMailboxName(
-                "read_file_chunks");
+        std::string mailbox_that_should_receive_file_content = S4U_Mailbox::getTemporaryMailbox();
 
         try {
             S4U_Mailbox::putMessage(
@@ -509,8 +554,25 @@ namespace wrench {
                     mailbox_that_should_receive_file_content.c_str());
 
         if (this->buffer_size == 0) {
-            throw std::runtime_error(
-                    "FileTransferThread::downloadFileFromStorageService(): Zero buffer size not implemented yet");
+            /** The whole file comes in a single message, and is written to disk while it is being received */
+            auto req = S4U_Mailbox::igetMessage(mailbox_that_should_receive_file_content);
+
+            if (Simulation::isPageCachingEnabled()) {
+                simulation->writebackWithMemoryCache(file, file->getSize(), dst_location, false);
+            } else {
+                // Write to disk
+                simulation->writeToDisk(file->getSize(),
+                                        dst_location->getStorageService()->getHostname(),
+                                        dst_location->getMountPoint());
+            }
+
+            // Wait for the comm to finish
+            auto msg = req->wait();
+            if (not dynamic_cast<StorageServiceFileContentChunkMessage *>(msg.get())) {
+                throw std::runtime_error(
+                        "FileTransferThread::downloadFileFromStorageService(): Received an unexpected [" +
+                        msg->getName() + "] message!");
+            }
 
         } else {
             try {
@@ -566,6 +628,7 @@ namespace wrench {
                 throw;
             }
         }
+        S4U_Mailbox::retireTemporaryMailbox(mailbox_that_should_receive_file_content);
     }
 
 }
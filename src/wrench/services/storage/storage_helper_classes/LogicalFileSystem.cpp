@@ -39,7 +39,7 @@ namespace wrench {
         this->hostname = hostname;
         this->storage_service = storage_service;
         this->mount_point = mount_point;
-        this->content["/"] = {};
+        this->content[FileLocation::internPath("/")] = {};
         this->total_capacity = S4U_Simulation::getDiskCapacity(hostname, mount_point);
         this->occupied_space = 0;
         this->initialized = false;
@@ -76,8 +76,9 @@ namespace wrench {
     void LogicalFileSystem::createDirectory(std::string absolute_path) {
 
         assertInitHasBeenCalled();
-        assertDirectoryDoesNotExist(absolute_path);
-        this->content[absolute_path] = {};
+        auto directory_id = FileLocation::internPath(absolute_path);
+        assertDirectoryDoesNotExist(directory_id);
+        this->content[directory_id] = {};
     }
 
 /**
@@ -87,7 +88,7 @@ namespace wrench {
  */
     bool LogicalFileSystem::doesDirectoryExist(std::string absolute_path) {
         assertInitHasBeenCalled();
-        return (this->content.find(absolute_path) != this->content.end());
+        return (this->content.find(FileLocation::internPath(absolute_path)) != this->content.end());
     }
 
 /**
@@ -100,8 +101,7 @@ namespace wrench {
     bool LogicalFileSystem::isDirectoryEmpty(std::string absolute_path) {
 
         assertInitHasBeenCalled();
-        assertDirectoryExist(absolute_path);
-        return (this->content[absolute_path].empty());
+        return getDirectoryContent(FileLocation::internPath(absolute_path)).empty();
     }
 
 /**
@@ -112,9 +112,12 @@ namespace wrench {
  */
     void LogicalFileSystem::removeEmptyDirectory(std::string absolute_path) {
         assertInitHasBeenCalled();
-        assertDirectoryExist(absolute_path);
-        assertDirectoryIsEmpty(absolute_path);
-        this->content.erase(absolute_path);
+        auto directory_id = FileLocation::internPath(absolute_path);
+        if (not getDirectoryContent(directory_id).empty()) {
+            throw std::invalid_argument("LogicalFileSystem::assertDirectoryIsEmpty(): directory " +
+                                        FileLocation::getInternedPath(directory_id) + "is not empty");
+        }
+        this->content.erase(directory_id);
     }
 
 /**
@@ -127,17 +130,15 @@ namespace wrench {
  */
     void LogicalFileSystem::storeFileInDirectory(WorkflowFile *file, std::string absolute_path) {
         assertInitHasBeenCalled();
+        auto directory_id = FileLocation::internPath(absolute_path);
         // If directory does not exit, create it
-        if (not doesDirectoryExist(absolute_path)) {
-            createDirectory(absolute_path);
-        }
+        this->content[directory_id].insert(file);
 
-        this->content[absolute_path].insert(file);
-        std::string key = FileLocation::sanitizePath(absolute_path) + file->getID();
-        if (this->reserved_space.find(key) == this->reserved_space.end()) {
+        auto reserved = this->reserved_space.find(directory_id);
+        if ((reserved == this->reserved_space.end()) or (reserved->second.erase(file) == 0)) {
             this->occupied_space += file->getSize();
-        } else {
-            this->reserved_space.erase(key);
+        } else if (reserved->second.empty()) {
+            this->reserved_space.erase(reserved);
         }
     }
 
@@ -150,9 +151,11 @@ namespace wrench {
  */
     void LogicalFileSystem::removeFileFromDirectory(WorkflowFile *file, std::string absolute_path) {
         assertInitHasBeenCalled();
-        assertDirectoryExist(absolute_path);
-        assertFileIsInDirectory(file, absolute_path);
-        this->content[absolute_path].erase(file);
+        auto directory_id = FileLocation::internPath(absolute_path);
+        if (getDirectoryContent(directory_id).erase(file) == 0) {
+            throw std::invalid_argument("LogicalFileSystem::assertFileIsInDirectory(): File " + file->getID() +
+                                        " is not in directory " + FileLocation::getInternedPath(directory_id));
+        }
         this->occupied_space -= file->getSize();
     }
 
@@ -164,8 +167,7 @@ namespace wrench {
  */
     void LogicalFileSystem::removeAllFilesInDirectory(std::string absolute_path) {
         assertInitHasBeenCalled();
-        assertDirectoryExist(absolute_path);
-        this->content[absolute_path].clear();
+        getDirectoryContent(FileLocation::internPath(absolute_path)).clear();
     }
 
 /**
@@ -180,11 +182,12 @@ namespace wrench {
     bool LogicalFileSystem::isFileInDirectory(WorkflowFile *file, std::string absolute_path) {
         assertInitHasBeenCalled();
         // If directory does not exist, say "no"
-        if (not doesDirectoryExist(absolute_path)) {
+        auto it = this->content.find(FileLocation::internPath(absolute_path));
+        if (it == this->content.end()) {
             return false;
         }
 
-        return (this->content[absolute_path].find(file) != this->content[absolute_path].end());
+        return (it->second.find(file) != it->second.end());
     }
 
 /**
@@ -197,8 +200,8 @@ namespace wrench {
  */
     std::set<WorkflowFile *> LogicalFileSystem::listFilesInDirectory(std::string absolute_path) {
         assertInitHasBeenCalled();
-        assertDirectoryExist(absolute_path);
-        return this->content[absolute_path];
+        auto &files = getDirectoryContent(FileLocation::internPath(absolute_path));
+        return std::set<WorkflowFile *>(files.begin(), files.end());
     }
 
 /**
@@ -237,16 +240,15 @@ namespace wrench {
  */
     void LogicalFileSystem::reserveSpace(WorkflowFile *file, std::string absolute_path) {
         assertInitHasBeenCalled();
-        std::string key = FileLocation::sanitizePath(absolute_path) + file->getID();
+        auto directory_id = FileLocation::internPath(absolute_path);
 
         if (this->total_capacity - this->occupied_space < file->getSize()) {
             throw std::invalid_argument("LogicalFileSystem::reserveSpace(): Not enough free space");
         }
-        if (this->reserved_space.find(key) != this->reserved_space.end()) {
+        if (not this->reserved_space[directory_id].insert(file).second) {
             WRENCH_WARN("LogicalFileSystem::reserveSpace(): Space was already being reserved for storing file %s at path %s:%s. This is likely a redundant copy",
                         file->getID().c_str(), this->hostname.c_str(), absolute_path.c_str());
         } else {
-            this->reserved_space[key] = file->getSize();
             this->occupied_space += file->getSize();
         }
     }
@@ -259,18 +261,20 @@ namespace wrench {
  */
     void LogicalFileSystem::unreserveSpace(WorkflowFile *file, std::string absolute_path) {
         assertInitHasBeenCalled();
-        std::string key = FileLocation::sanitizePath(absolute_path) + file->getID();
+        auto reserved = this->reserved_space.find(FileLocation::internPath(absolute_path));
 
-        if (this->reserved_space.find(key) == this->reserved_space.end()) {
+        if ((reserved == this->reserved_space.end()) or (reserved->second.erase(file) == 0)) {
             return; // oh well, the transfer was cancelled/terminated/whatever
         }
+        if (reserved->second.empty()) {
+            this->reserved_space.erase(reserved);
+        }
 
 //         This will never happen
 //        if (this->occupied_space <  file->getSize()) {
 //            throw std::invalid_argument("LogicalFileSystem::unreserveSpace(): Occupied space is less than the file size... should not happen");
 //        }
 
-        this->reserved_space.erase(key);
         this->occupied_space -= file->getSize();
     }
 
@@ -289,14 +293,8 @@ namespace wrench {
                                         file->getID() + " at " + this->hostname + ":" + absolute_path);
         }
 
-        absolute_path = wrench::FileLocation::sanitizePath(absolute_path);
-
         // If directory does not exit, create it
-        if (this->content.find(absolute_path) == this->content.end()) {
-            this->content[absolute_path] = {};
-        }
-
-        this->content[absolute_path].insert(file);
+        this->content[FileLocation::internPath(absolute_path)].insert(file);
         this->occupied_space += file->getSize();
     }
 }
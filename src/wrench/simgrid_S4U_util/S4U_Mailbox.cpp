@@ -32,6 +32,9 @@ namespace wrench {
 
     class WorkflowTask;
 
+    std::vector<std::string> S4U_Mailbox::free_temporary_mailboxes;
+    unsigned long S4U_Mailbox::num_temporary_mailboxes = 0;
+
     /**
      * @brief Synchronously receive a message from a mailbox
      *
@@ -231,6 +234,75 @@ namespace wrench {
     }
 
 
+    /**
+     * @brief Synchronously send a request message to a mailbox and wait for its answer on
+     *        a temporary mailbox (obtained via getTemporaryMailbox()). The temporary mailbox
+     *        is retired once the answer has been received, and is never reused if anything
+     *        went wrong (in which case the answer may still show up later).
+     *
+     * @param mailbox_name: the mailbox name to which the request is sent
+     * @param request: the request message
+     * @param answer_mailbox: the temporary mailbox on which the answer is expected
+     * @param timeout: a timeout value in seconds for receiving the answer (<0 means never timeout)
+     * @return the answer message
+     *
+     * @throw std::shared_ptr<NetworkError>
+     */
+    std::unique_ptr<SimulationMessage> S4U_Mailbox::putRequestAndGetAnswer(std::string mailbox_name,
+                                                                           SimulationMessage *request,
+                                                                           const std::string &answer_mailbox,
+                                                                           double timeout) {
+        S4U_Mailbox::putMessage(mailbox_name, request);
+        auto answer = S4U_Mailbox::getMessage(answer_mailbox, timeout);
+        S4U_Mailbox::retireTemporaryMailbox(answer_mailbox);
+        return answer;
+    }
+
+    /**
+     * @brief Obtain a mailbox on which a single answer (or a sequence of messages with
+     *        a known end) is to be received. Mailboxes are taken from a pool of previously
+     *        retired mailboxes whenever possible, since SimGrid never frees mailboxes and
+     *        creating a new one for each request makes memory usage grow with the number of requests.
+     *
+     * @return a mailbox name, which the caller should pass to retireTemporaryMailbox() once
+     *         no more messages can be sent to it
+     */
+    std::string S4U_Mailbox::getTemporaryMailbox() {
+        if (not S4U_Mailbox::free_temporary_mailboxes.empty()) {
+            auto mailbox_name = S4U_Mailbox::free_temporary_mailboxes.back();
+            S4U_Mailbox::free_temporary_mailboxes.pop_back();
+            return mailbox_name;
+        }
+        S4U_Mailbox::num_temporary_mailboxes++;
+        return "tmp_mailbox_" + std::to_string(S4U_Mailbox::num_temporary_mailboxes);
+    }
+
+    /**
+     * @brief Return a temporary mailbox to the pool. This should only be called once all expected
+     *        messages have been received, as a late message would otherwise be received by the
+     *        next user of the mailbox. Mailboxes that still have pending communications are
+     *        not returned to the pool, and are simply abandoned.
+     *
+     * @param mailbox_name: a mailbox name obtained via getTemporaryMailbox()
+     */
+    void S4U_Mailbox::retireTemporaryMailbox(const std::string &mailbox_name) {
+        if (not simgrid::s4u::Mailbox::by_name(mailbox_name)->empty()) {
+            WRENCH_DEBUG("Not reusing temporary mailbox '%s' as it has pending communications",
+                         mailbox_name.c_str());
+            return;
+        }
+        S4U_Mailbox::free_temporary_mailboxes.push_back(mailbox_name);
+    }
+
+    /**
+     * @brief Get the number of temporary mailboxes created so far
+     *
+     * @return a number of mailboxes
+     */
+    unsigned long S4U_Mailbox::getNumTemporaryMailboxes() {
+        return S4U_Mailbox::num_temporary_mailboxes;
+    }
+
     /**
     * @brief Generate a unique sequence number
     *
@@ -25,6 +25,9 @@ WRENCH_LOG_CATEGORY(wrench_core_s4u_simulation, "Log category for S4U_Simulation
 
 namespace wrench {
 
+    std::vector<S4U_Simulation::HostInfo> S4U_Simulation::host_infos;
+    std::unordered_map<std::string, unsigned long> S4U_Simulation::host_ids;
+
     /**
      * @brief Initialize the Simgrid simulation
      *
@@ -107,6 +110,7 @@ namespace wrench {
             throw;
         }
 
+        buildHostRegistry();
         this->platform_setup = true;
     }
 
@@ -124,9 +128,153 @@ namespace wrench {
         } catch (std::exception &e) {
             throw;
         }
+        buildHostRegistry();
         this->platform_setup = true;
     }
 
+    /**
+     * @brief Build the dense host registry, i.e., assign an ID to each physical host and cache its
+     *        static attributes, so that host lookups do not go through S4U's by-name lookups, and so
+     *        that services can keep per-host state in arrays indexed by host ID
+     */
+    void S4U_Simulation::buildHostRegistry() {
+        host_infos.clear();
+        host_ids.clear();
+
+        auto host_list = simgrid::s4u::Engine::get_instance()->get_all_hosts();
+        host_infos.reserve(host_list.size());
+        host_ids.reserve(host_list.size());
+        for (auto h : host_list) {
+            HostInfo info;
+            info.name = h->get_name();
+            info.host = h;
+            info.num_cores = (unsigned int) h->get_core_count();
+            try {
+                info.memory_capacity = getHostMemoryCapacity(h);
+            } catch (std::invalid_argument &e) {
+                // The error will be reported to whoever asks for the RAM capacity of this host
+                info.memory_capacity = -1.0;
+            }
+            for (auto d : h->get_disks()) {
+                const char *mp = d->get_property("mount");
+                if (mp) {
+                    info.disks.emplace_back(FileLocation::sanitizePath(std::string(mp)), d);
+                }
+            }
+            host_ids[info.name] = host_infos.size();
+            host_infos.push_back(std::move(info));
+        }
+    }
+
+    /**
+     * @brief Get the number of physical hosts in the platform
+     * @return a number of hosts
+     */
+    unsigned long S4U_Simulation::getNumHosts() {
+        return host_infos.size();
+    }
+
+    /**
+     * @brief Get the ID of a physical host, i.e., its index in the dense host registry (from 0 to getNumHosts()-1)
+     * @param hostname: the name of the host
+     * @return the host ID
+     *
+     * @throw std::invalid_argument
+     */
+    unsigned long S4U_Simulation::getHostID(const std::string &hostname) {
+        auto it = host_ids.find(hostname);
+        if (it == host_ids.end()) {
+            throw std::invalid_argument("S4U_Simulation::getHostID(): Unknown (physical) host " + hostname);
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Get the cached static attributes of a physical host
+     * @param host_id: the host ID
+     * @return the host's attributes
+     *
+     * @throw std::invalid_argument
+     */
+    const S4U_Simulation::HostInfo &S4U_Simulation::getHostInfo(unsigned long host_id) {
+        if (host_id >= host_infos.size()) {
+            throw std::invalid_argument("S4U_Simulation::getHostInfo(): Invalid host ID " + std::to_string(host_id));
+        }
+        return host_infos[host_id];
+    }
+
+    /**
+     * @brief Get the S4U host (physical host or VM) with a given name
+     * @param hostname: the name of the host
+     * @return the host
+     *
+     * @throw std::invalid_argument
+     */
+    simgrid::s4u::Host *S4U_Simulation::getHost(const std::string &hostname) {
+        auto host = getHostOrNull(hostname);
+        if (host == nullptr) {
+            throw std::invalid_argument("S4U_Simulation::getHost(): Unknown host " + hostname);
+        }
+        return host;
+    }
+
+    /**
+     * @brief Look up a physical host in the host registry
+     * @param hostname: the name of the host
+     * @return the host's attributes, or nullptr if the host is not a physical host
+     */
+    const S4U_Simulation::HostInfo *S4U_Simulation::findHostInfo(const std::string &hostname) {
+        auto it = host_ids.find(hostname);
+        if (it == host_ids.end()) {
+            return nullptr;
+        }
+        return &(host_infos[it->second]);
+    }
+
+    /**
+     * @brief Get the S4U host (physical host or VM) with a given name
+     * @param hostname: the name of the host
+     * @return the host, or nullptr if there is no such host
+     */
+    simgrid::s4u::Host *S4U_Simulation::getHostOrNull(const std::string &hostname) {
+        auto info = findHostInfo(hostname);
+        if (info) {
+            return info->host;
+        }
+        // VMs are not in the registry
+        return simgrid::s4u::Host::by_name_or_null(hostname);
+    }
+
+    /**
+     * @brief Get the disk attached to a given mount point at a host
+     * @param hostname: the name of the host
+     * @param mount_point: the (sanitized) mount point
+     * @return the disk, or nullptr if there is no such disk
+     */
+    simgrid::s4u::Disk *S4U_Simulation::getDiskOrNull(const std::string &hostname, const std::string &mount_point) {
+        auto info = findHostInfo(hostname);
+        if (info) {
+            for (auto const &d : info->disks) {
+                if (d.first == mount_point) {
+                    return d.second;
+                }
+            }
+            return nullptr;
+        }
+        // VMs are not in the registry
+        auto host = getHostOrNull(hostname);
+        if (host == nullptr) {
+            return nullptr;
+        }
+        for (auto disk : host->get_disks()) {
+            const char *mp = disk->get_property("mount");
+            if (mp and (FileLocation::sanitizePath(std::string(mp)) == mount_point)) {
+                return disk;
+            }
+        }
+        return nullptr;
+    }
+
 
     /**
      * @brief Get the hostname on which the calling actor is running
@@ -235,7 +383,7 @@ namespace wrench {
  * @return true or false
  */
     bool S4U_Simulation::hostExists(std::string hostname) {
-        return (simgrid::s4u::Host::by_name_or_null(hostname) != nullptr);
+        return (getHostOrNull(hostname) != nullptr);
     }
 
 /**
@@ -256,7 +404,11 @@ namespace wrench {
  * @throw std::invalid_argument
  */
     unsigned int S4U_Simulation::getHostNumCores(std::string hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto info = findHostInfo(hostname);
+        if (info) {
+            return info->num_cores;
+        }
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -280,7 +432,7 @@ namespace wrench {
  * @throw std::invalid_argument
  */
     double S4U_Simulation::getHostFlopRate(std::string hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -296,7 +448,7 @@ namespace wrench {
  * @throw std::invalid_argument
  */
     bool S4U_Simulation::isHostOn(std::string hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -311,7 +463,7 @@ namespace wrench {
  * @throw std::invalid_argument
  */
     void S4U_Simulation::turnOffHost(std::string hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -326,7 +478,7 @@ namespace wrench {
  * @throw std::invalid_argument
  */
     void S4U_Simulation::turnOnHost(std::string hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -407,6 +559,17 @@ namespace wrench {
         simgrid::s4u::this_actor::execute(flops);
     }
 
+/**
+ * @brief Simulates a multi-threaded computation, as a single activity, on the host on which
+ *        the calling actor is running
+ * @param num_threads: the number of threads
+ * @param flops_per_thread: the number of flops performed by each thread
+ */
+    void S4U_Simulation::computeMultiThreaded(unsigned long num_threads, double flops_per_thread) {
+        simgrid::s4u::this_actor::thread_execute(simgrid::s4u::this_actor::get_host(), flops_per_thread,
+                                                 (int) num_threads);
+    }
+
 /**
  * @brief Simulates a disk write
  *
@@ -418,22 +581,17 @@ namespace wrench {
         mount_point  = FileLocation::sanitizePath(mount_point);
 
         WRENCH_DEBUG("Writing %lf bytes to disk %s:%s", num_bytes, hostname.c_str(), mount_point.c_str());
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (not host) {
             throw std::invalid_argument("S4U_Simulation::writeToDisk(): unknown host " + hostname);
         }
 
-        auto disk_list = simgrid::s4u::Host::by_name(hostname)->get_disks();
-        for (auto disk : disk_list) {
-            std::string disk_mountpoint =
-                    FileLocation::sanitizePath(std::string(std::string(disk->get_property("mount"))));
-            if (disk_mountpoint == mount_point) {
-                disk->write(num_bytes);
-                return;
-            }
+        auto disk = getDiskOrNull(hostname, mount_point);
+        if (disk == nullptr) {
+            throw std::invalid_argument("S4U_Simulation::writeToDisk(): unknown path " +
+                                        mount_point + " at host " + hostname);
         }
-        throw std::invalid_argument("S4U_Simulation::writeToDisk(): unknown path " +
-                                    mount_point + " at host " + hostname);
+        disk->write(num_bytes);
     }
 
 
@@ -451,24 +609,16 @@ namespace wrench {
                                                                 std::string read_mount_point,
                                                                 std::string write_mount_point) {
 
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
         WRENCH_DEBUG("Reading %.2lf bytes from disk %s:%s and writing %lf bytes to disk %s:%s",
                      num_bytes_to_read, hostname.c_str(), read_mount_point.c_str(),
                      num_bytes_to_write, hostname.c_str(), write_mount_point.c_str());
 
-        simgrid::s4u::Disk *read_disk = nullptr;
-        simgrid::s4u::Disk *write_disk = nullptr;
-
-        auto disk_list = simgrid::s4u::Host::by_name(hostname)->get_disks();
-        for (auto disk : disk_list) {
-            std::string disk_mountpoint =
-                    FileLocation::sanitizePath(std::string(std::string(disk->get_property("mount"))));
-            if (disk_mountpoint == read_mount_point) {
-                read_disk = disk;
-            }
-            if (disk_mountpoint == write_mount_point) {
-                write_disk = disk;
-            }
+        simgrid::s4u::Disk *read_disk = getDiskOrNull(hostname, FileLocation::sanitizePath(read_mount_point));
+        simgrid::s4u::Disk *write_disk = getDiskOrNull(hostname, FileLocation::sanitizePath(write_mount_point));
+        if ((read_disk == nullptr) or (write_disk == nullptr)) {
+            throw std::invalid_argument("S4U_Simulation::readFromDiskAndWriteToDiskConcurrently(): unknown path " +
+                                        (read_disk == nullptr ? read_mount_point : write_mount_point) +
+                                        " at host " + hostname);
         }
 
         // Start asynchronous read
@@ -495,23 +645,17 @@ namespace wrench {
 
         WRENCH_DEBUG("Reading %.2lf bytes from disk %s:%s", num_bytes, hostname.c_str(), mount_point.c_str());
 
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (not host) {
             throw std::invalid_argument("S4U_Simulation::readFromDisk(): unknown host " + hostname);
         }
 
-        auto disk_list = simgrid::s4u::Host::by_name(hostname)->get_disks();
-        for (auto disk : disk_list) {
-            std::string disk_mountpoint =
-                    FileLocation::sanitizePath(std::string(std::string(disk->get_property("mount"))));
-
-            if (disk_mountpoint == mount_point) {
-                disk->read(num_bytes);
-                return;
-            }
+        auto disk = getDiskOrNull(hostname, mount_point);
+        if (disk == nullptr) {
+            throw std::invalid_argument("S4U_Simulation::readFromDisk(): invalid mount point " +
+                                        mount_point + " at host " + hostname);
         }
-        throw std::invalid_argument("S4U_Simulation::readFromDisk(): invalid mount point " +
-                                    mount_point + " at host " + hostname);
+        disk->read(num_bytes);
     }
 
 
@@ -537,7 +681,11 @@ namespace wrench {
  * @return a memory_manager_service capacity in bytes
  */
     double S4U_Simulation::getHostMemoryCapacity(std::string hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto info = findHostInfo(hostname);
+        if (info and (info->memory_capacity >= 0)) {
+            return info->memory_capacity;
+        }
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -589,7 +737,7 @@ namespace wrench {
  * @return a string relating to the property specified in the platform file
  */
     std::string S4U_Simulation::getHostProperty(std::string hostname, std::string property_name) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -608,7 +756,7 @@ namespace wrench {
  */
     double S4U_Simulation::getEnergyConsumedByHost(const std::string &hostname) {
         double energy_consumed = 0;
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -655,7 +803,7 @@ namespace wrench {
  * @throw std::runtime_error
  */
     void S4U_Simulation::setPstate(const std::string &hostname, int pstate) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("S4U_Simulation::setPstate(): Unknown hostname " + hostname);
         }
@@ -682,7 +830,7 @@ namespace wrench {
  * @throw std::runtime_error
  */
     int S4U_Simulation::getNumberofPstates(const std::string &hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -703,7 +851,7 @@ namespace wrench {
  * @throw std::runtime_error
  */
     int S4U_Simulation::getCurrentPstate(const std::string &hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -725,7 +873,7 @@ namespace wrench {
  * @throw std::runtime_error
  */
     double S4U_Simulation::getMinPowerConsumption(const std::string &hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -747,7 +895,7 @@ namespace wrench {
  * @throw std::runtime_error
  */
     double S4U_Simulation::getMaxPowerConsumption(const std::string &hostname) {
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -772,7 +920,7 @@ namespace wrench {
  */
     std::vector<int> S4U_Simulation::getListOfPstates(const std::string &hostname) {
 
-        auto host = simgrid::s4u::Host::by_name_or_null(hostname);
+        auto host = getHostOrNull(hostname);
         if (host == nullptr) {
             throw std::invalid_argument("Unknown hostname " + hostname);
         }
@@ -0,0 +1,164 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "simulation/JSONStreamWriter.h"
+
+#include <stdexcept>
+
+namespace wrench {
+
+    /**
+     * @brief Constructor
+     * @param output: the output stream to write to
+     * @param pretty_print: whether to indent the output (4 spaces per level) or write it compactly
+     */
+    JSONStreamWriter::JSONStreamWriter(std::ostream &output, bool pretty_print) :
+            output(output), pretty_print(pretty_print) {
+    }
+
+    /**
+     * @brief Open a JSON object
+     */
+    void JSONStreamWriter::beginObject() {
+        this->beginValue();
+        this->output << "{";
+        this->scopes.push_back({false, true, false});
+    }
+
+    /**
+     * @brief Close the current JSON object
+     *
+     * @throws std::runtime_error
+     */
+    void JSONStreamWriter::endObject() {
+        if (this->scopes.empty() or this->scopes.back().is_array) {
+            throw std::runtime_error("JSONStreamWriter::endObject(): no object to close");
+        }
+        auto scope = this->scopes.back();
+        this->scopes.pop_back();
+        if (not scope.empty) {
+            this->newLine(this->scopes.size());
+        }
+        this->output << "}";
+    }
+
+    /**
+     * @brief Open a JSON array
+     * @param null_if_empty: if true, an array into which nothing is written is output as "null"
+     *        (which is what nlohmann::json produces for a never-pushed-to array)
+     */
+    void JSONStreamWriter::beginArray(bool null_if_empty) {
+        this->beginValue();
+        if (not null_if_empty) {
+            this->output << "[";
+        }
+        this->scopes.push_back({true, true, null_if_empty});
+    }
+
+    /**
+     * @brief Close the current JSON array
+     *
+     * @throws std::runtime_error
+     */
+    void JSONStreamWriter::endArray() {
+        if (this->scopes.empty() or not this->scopes.back().is_array) {
+            throw std::runtime_error("JSONStreamWriter::endArray(): no array to close");
+        }
+        auto scope = this->scopes.back();
+        this->scopes.pop_back();
+        if (scope.deferred) {
+            this->output << "null";
+            return;
+        }
+        if (not scope.empty) {
+            this->newLine(this->scopes.size());
+        }
+        this->output << "]";
+    }
+
+    /**
+     * @brief Write a key in the current JSON object
+     * @param key: the key
+     *
+     * @throws std::runtime_error
+     */
+    void JSONStreamWriter::key(const std::string &key) {
+        if (this->scopes.empty() or this->scopes.back().is_array or this->pending_key) {
+            throw std::runtime_error("JSONStreamWriter::key(): a key can only be written in an object");
+        }
+        this->separate();
+        this->output << nlohmann::json(key).dump() << (this->pretty_print ? ": " : ":");
+        this->pending_key = true;
+    }
+
+    /**
+     * @brief Write a complete JSON value (e.g., a record) in the current array or after a key
+     * @param value: the value
+     */
+    void JSONStreamWriter::value(const nlohmann::json &value) {
+        this->beginValue();
+        if (not this->pretty_print) {
+            this->output << value.dump();
+            return;
+        }
+        // Re-indent the (pretty-printed) value to the current depth
+        std::string indentation = "\n" + std::string(4 * this->scopes.size(), ' ');
+        std::string dumped = value.dump(4);
+        std::string::size_type start = 0;
+        std::string::size_type newline;
+        while ((newline = dumped.find('\n', start)) != std::string::npos) {
+            this->output.write(dumped.data() + start, newline - start);
+            this->output << indentation;
+            start = newline + 1;
+        }
+        this->output.write(dumped.data() + start, dumped.size() - start);
+    }
+
+    /**
+     * @brief Prepare for writing a value, which either follows a key or
+     *        is an element of the current array
+     */
+    void JSONStreamWriter::beginValue() {
+        if (this->pending_key) {
+            this->pending_key = false;
+        } else {
+            this->separate();
+        }
+    }
+
+    /**
+     * @brief Write whatever separates an element from the previous one in the current scope
+     */
+    void JSONStreamWriter::separate() {
+        if (this->scopes.empty()) {
+            return;
+        }
+        auto &scope = this->scopes.back();
+        if (scope.deferred) {
+            this->output << "[";
+            scope.deferred = false;
+        }
+        if (not scope.empty) {
+            this->output << ",";
+        }
+        scope.empty = false;
+        this->newLine(this->scopes.size());
+    }
+
+    /**
+     * @brief Start a new indented line (no-op if not pretty-printing)
+     * @param depth: the indentation depth
+     */
+    void JSONStreamWriter::newLine(size_t depth) {
+        if (this->pretty_print) {
+            this->output << "\n" << std::string(4 * depth, ' ');
+        }
+    }
+
+};
@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#ifndef WRENCH_JSONSTREAMWRITER_H
+#define WRENCH_JSONSTREAMWRITER_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace wrench {
+
+    /***********************/
+    /** \cond INTERNAL     */
+    /***********************/
+
+    /**
+     * @brief A helper class that writes a JSON document to an output stream piece
+     *        by piece, so that large documents never have to be built in memory.
+     *        Small values (e.g., individual records) are serialized with nlohmann::json,
+     *        and the pretty-printed layout matches that of nlohmann's std::setw(4) output.
+     */
+    class JSONStreamWriter {
+
+    public:
+
+        explicit JSONStreamWriter(std::ostream &output, bool pretty_print = true);
+
+        void beginObject();
+
+        void endObject();
+
+        void beginArray(bool null_if_empty = false);
+
+        void endArray();
+
+        void key(const std::string &key);
+
+        void value(const nlohmann::json &value);
+
+    private:
+
+        /** @brief An open object or array */
+        struct Scope {
+            /** @brief whether the scope is an array */
+            bool is_array;
+            /** @brief whether nothing has been written in the scope yet */
+            bool empty;
+            /** @brief whether the opening bracket has not been written yet (arrays that are null when empty) */
+            bool deferred;
+        };
+
+        void beginValue();
+
+        void separate();
+
+        void newLine(size_t depth);
+
+        std::ostream &output;
+        bool pretty_print;
+        bool pending_key = false;
+        std::vector<Scope> scopes;
+    };
+
+    /***********************/
+    /** \endcond           */
+    /***********************/
+
+};
+
+#endif //WRENCH_JSONSTREAMWRITER_H
@@ -687,6 +687,7 @@ namespace wrench {
         }
         memory_manager->simulation = this;
         this->memory_managers.insert(memory_manager);
+        this->memory_managers_by_host.insert(std::make_pair(memory_manager->getHostname(), memory_manager.get()));
     }
 
     /**
@@ -856,11 +857,7 @@ namespace wrench {
                                                     temp_unique_sequence_number);
 
         auto mem_mng = getMemoryManagerByHost(hostname);
-        std::vector<Block *> file_blocks = mem_mng->getCachedBlocks(file->getID());
-        long cached_amt = 0;
-        for (unsigned int i = 0; i < file_blocks.size(); i++) {
-            cached_amt += file_blocks[i]->getSize();
-        }
+        long cached_amt = mem_mng->getCachedAmount(file->getID());
 
         double from_disk = std::min(n_bytes, file->getSize() - cached_amt);
         double from_cache = n_bytes - from_disk;
@@ -969,13 +966,12 @@ namespace wrench {
      * @param hostname: name of the host
      * @return pointer to the memory manager running on the host (or nullptr)
      */
-    MemoryManager *Simulation::getMemoryManagerByHost(std::string hostname) {
-        for (const auto &ptr : this->memory_managers) {
-            if (strcmp(ptr->getHostname().c_str(), hostname.c_str()) == 0) {
-                return ptr.get();
-            }
+    MemoryManager *Simulation::getMemoryManagerByHost(const std::string &hostname) {
+        auto it = this->memory_managers_by_host.find(hostname);
+        if (it == this->memory_managers_by_host.end()) {
+            return nullptr;
         }
-        return nullptr;
+        return it->second;
     }
 
     /**
@@ -1387,6 +1383,7 @@ namespace wrench {
         service->simulation = this;
         std::shared_ptr<MemoryManager> shared_ptr = std::shared_ptr<MemoryManager>(service);
         this->memory_managers.insert(shared_ptr);
+        this->memory_managers_by_host.insert(std::make_pair(shared_ptr->getHostname(), shared_ptr.get()));
         shared_ptr->start(shared_ptr, true, false); // Daemonized, no auto-restart
 
         return shared_ptr;
@@ -12,11 +12,80 @@
 #include "wrench/simulation/SimulationMessage.h"
 #include "wrench/workflow/WorkflowFile.h"
 
+#include <typeindex>
+#include <vector>
+
 WRENCH_LOG_CATEGORY(wrench_core_simulation_message, "Log category for SimulationMessage");
 
 
 namespace wrench {
 
+    std::unordered_map<std::string, unsigned long> SimulationMessage::allocation_counts;
+
+    /** @brief Granularity (in bytes) of the size classes of pooled message memory blocks */
+    static constexpr size_t MESSAGE_SIZE_CLASS_GRANULARITY = 16;
+    /** @brief Size (in bytes) above which message memory blocks are not pooled */
+    static constexpr size_t MESSAGE_MAX_POOLED_SIZE = 1024;
+
+    /**
+     * @brief Get the free list of message memory blocks for a size class. The free lists
+     *        are never destroyed, so that messages can safely be deleted at any time
+     *        (e.g., by the MessageManager)
+     * @param size_class: the size class
+     * @return the free list
+     */
+    static std::vector<void *> &getMessageFreeList(size_t size_class) {
+        static auto free_lists = new std::vector<std::vector<void *>>(
+                MESSAGE_MAX_POOLED_SIZE / MESSAGE_SIZE_CLASS_GRANULARITY + 1);
+        return (*free_lists)[size_class];
+    }
+
+    /**
+     * @brief Allocate memory for a message. Messages are created and destroyed at a high
+     *        rate (e.g., one per file chunk), so memory blocks of deleted messages are kept in
+     *        per-size free lists and reused rather than returned to the system allocator.
+     *        All simulated processes run in turn, so no locking is needed.
+     * @param size: the size of the message object in bytes
+     * @return a memory block
+     */
+    void *SimulationMessage::operator new(size_t size) {
+        if (size > MESSAGE_MAX_POOLED_SIZE) {
+            return ::operator new(size);
+        }
+        size_t size_class = (size + MESSAGE_SIZE_CLASS_GRANULARITY - 1) / MESSAGE_SIZE_CLASS_GRANULARITY;
+        auto &free_list = getMessageFreeList(size_class);
+        if (free_list.empty()) {
+            return ::operator new(size_class * MESSAGE_SIZE_CLASS_GRANULARITY);
+        }
+        void *ptr = free_list.back();
+        free_list.pop_back();
+        return ptr;
+    }
+
+    /**
+     * @brief Release the memory of a deleted message
+     * @param ptr: the memory block
+     * @param size: the size of the (most derived) message object in bytes
+     */
+    void SimulationMessage::operator delete(void *ptr, size_t size) {
+        if (ptr == nullptr) {
+            return;
+        }
+        if (size > MESSAGE_MAX_POOLED_SIZE) {
+            ::operator delete(ptr);
+            return;
+        }
+        size_t size_class = (size + MESSAGE_SIZE_CLASS_GRANULARITY - 1) / MESSAGE_SIZE_CLASS_GRANULARITY;
+        getMessageFreeList(size_class).push_back(ptr);
+    }
+
+    /**
+     * @brief Get the number of messages created so far, per message type
+     * @return a map of message counts, indexed by message name
+     */
+    std::map<std::string, unsigned long> SimulationMessage::getAllocationCounts() {
+        return std::map<std::string, unsigned long>(allocation_counts.begin(), allocation_counts.end());
+    }
 
     SimulationMessage::~SimulationMessage() {
 //        WRENCH_INFO("DELETE: %s (%lu)", name.c_str(), (unsigned long)(this));
@@ -34,6 +103,8 @@ namespace wrench {
         }
         this->name = name;
         this->payload = payload;
+        this->type_tag = 0;
+        allocation_counts[this->name]++;
     }
 
     /**
@@ -45,4 +116,39 @@ namespace wrench {
     }
 
 
+    /**
+     * @brief Get the message's type tag, i.e., a small integer that uniquely identifies the
+     *        message's (most derived) class, and that services use to dispatch messages through
+     *        jump tables (see SimulationMessageTypeSwitch) rather than through chains of dynamic casts
+     * @return the type tag
+     */
+    unsigned int SimulationMessage::getTypeTag() {
+        if (this->type_tag == 0) {
+            this->type_tag = SimulationMessage::getTypeTag(typeid(*this));
+        }
+        return this->type_tag;
+    }
+
+    /**
+     * @brief Get the type tag of a message class. Tags are assigned in order of first
+     *        lookup, starting at 1, so that they can index dense tables.
+     * @param type: the message class' type info
+     * @return the type tag
+     */
+    unsigned int SimulationMessage::getTypeTag(const std::type_info &type) {
+        // Type infos are looked up by address first, and by (mangled) name only the first time
+        // around, since the same class may have more than one type info object across shared libraries
+        static auto tags_by_address = new std::unordered_map<const std::type_info *, unsigned int>();
+        static auto tags_by_type = new std::unordered_map<std::type_index, unsigned int>();
+
+        auto it = tags_by_address->find(&type);
+        if (it != tags_by_address->end()) {
+            return it->second;
+        }
+        auto inserted = tags_by_type->insert(std::make_pair(std::type_index(type), tags_by_type->size() + 1));
+        unsigned int tag = inserted.first->second;
+        (*tags_by_address)[&type] = tag;
+        return tag;
+    }
+
 };
@@ -10,6 +10,8 @@
 #include "wrench/simulation/Simulation.h"
 #include "wrench/simulation/SimulationOutput.h"
 #include "wrench/workflow/Workflow.h"
+#include "wrench/simulation/SimulationTraceFile.h"
+#include "simulation/JSONStreamWriter.h"
 #include "simgrid/s4u.hpp"
 #include "simgrid/plugins/energy.h"
 
@@ -24,6 +26,11 @@
 #include <vector>
 #include <cmath>
 #include <unordered_set>
+#include <set>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #define DBL_EQUAL(x, y) (std::abs<double>((x) - (y)) < 0.1)
 
@@ -174,41 +181,99 @@ namespace wrench {
                                            bool generate_host_utilization_layout,
                                            bool include_disk,
                                            bool include_bandwidth) {
-        nlohmann::json unified_json;
+        if (file_path.empty()) {
+            throw std::invalid_argument("SimulationOutput::dumpUnifiedJSON() requires a valid file_path");
+        }
+        if ((include_workflow_exec or include_workflow_graph) and (workflow == nullptr)) {
+            throw std::invalid_argument("SimulationOutput::dumpUnifiedJSON() requires a valid workflow");
+        }
 
-        if (include_platform) {
-            dumpPlatformGraphJSON(file_path, false);
-            unified_json["platform"] = platform_json_part;
+        std::ofstream output(file_path);
+        this->dumpUnifiedJSON(workflow, output,
+                              include_platform, include_workflow_exec, include_workflow_graph, include_energy,
+                              generate_host_utilization_layout, include_disk, include_bandwidth);
+        output.close();
+    }
+
+    /**
+     * @brief Function that writes the unified JSON document (see the file-based dumpUnifiedJSON()) to an output
+     *        stream. Each section is streamed record by record, without first building the whole document in
+     *        memory, which keeps peak memory usage low for large simulation traces.
+     *
+     * @param workflow: a pointer to the Workflow
+     * @param output: the output stream to write to
+     * @param include_platform: boolean whether to include platform in JSON
+     * @param include_workflow_exec: boolean whether to include workflow execution in JSON
+     * @param include_workflow_graph: boolean whether to include workflow graph in JSON
+     * @param include_energy: boolean whether to include energy consumption in JSON
+     * @param generate_host_utilization_layout: boolean specifying whether or not you would like a possible host utilization
+     *         layout to be generated
+     * @param include_disk: boolean specifying whether to include disk operation in JSON (disk timestamps must be enabled)
+     * @param include_bandwidth: boolean specifying whether to include link bandwidth measurements in JSON
+     * @param pretty_print: boolean specifying whether the JSON is indented (true) or written compactly (false)
+     *
+     * @throws std::invalid_argument
+     * @throws std::runtime_error
+     */
+    void SimulationOutput::dumpUnifiedJSON(Workflow *workflow, std::ostream &output,
+                                           bool include_platform,
+                                           bool include_workflow_exec,
+                                           bool include_workflow_graph,
+                                           bool include_energy,
+                                           bool generate_host_utilization_layout,
+                                           bool include_disk,
+                                           bool include_bandwidth,
+                                           bool pretty_print) {
+        if ((include_workflow_exec or include_workflow_graph) and (workflow == nullptr)) {
+            throw std::invalid_argument("SimulationOutput::dumpUnifiedJSON() requires a valid workflow");
         }
 
-        if (include_workflow_exec) {
-            dumpWorkflowExecutionJSON(workflow, file_path, generate_host_utilization_layout, false);
-            unified_json["workflow_execution"] = workflow_exec_json_part;
+        // The platform section and the host utilization layout are computed before anything
+        // is written, so that no partial output is produced if they cannot be generated
+        nlohmann::json platform_json;
+        if (include_platform) {
+            platform_json = this->generatePlatformGraphJSON();
+        }
+        if (include_workflow_exec and generate_host_utilization_layout) {
+            this->generateHostUtilizationLayout(workflow);
         }
 
-        if (include_workflow_graph) {
-            dumpWorkflowGraphJSON(workflow, file_path, false);
-            unified_json["workflow_graph"] = workflow_graph_json_part;
+        // Sections are written in alphabetical order of their keys, as nlohmann::json would
+        JSONStreamWriter writer(output, pretty_print);
+        writer.beginObject();
+
+        if (include_disk) {
+            writer.key("disk_operations");
+            this->writeDiskOperationsJSON(writer);
         }
 
         if (include_energy) {
-            dumpHostEnergyConsumptionJSON(file_path, false);
-            unified_json["energy_consumption"] = energy_json_part;
+            writer.key("energy_consumption");
+            this->writeHostEnergyConsumptionJSON(writer);
         }
 
-        if (include_disk) {
-            dumpDiskOperationsJSON(file_path, false);
-            unified_json["disk_operations"] = disk_json_part;
+        if (include_bandwidth) {
+            writer.key("link_usage");
+            this->writeLinkUsageJSON(writer);
         }
 
-        if (include_bandwidth) {
-            dumpLinkUsageJSON(file_path, false);
-            unified_json["link_usage"] = bandwidth_json_part;
+        if (include_platform) {
+            writer.key("platform");
+            writer.value(platform_json);
         }
 
-        std::ofstream output(file_path);
-        output << std::setw(4) << unified_json << std::endl;
-        output.close();
+        if (include_workflow_exec) {
+            writer.key("workflow_execution");
+            this->writeWorkflowExecutionJSON(writer, workflow);
+        }
+
+        if (include_workflow_graph) {
+            writer.key("workflow_graph");
+            this->writeWorkflowGraphJSON(writer, workflow);
+        }
+
+        writer.endObject();
+        output << std::endl;
     }
 
     /**
@@ -532,67 +597,63 @@ namespace wrench {
                     "SimulationOutput::dumpWorkflowExecutionJSON() requires a valid workflow and file_path");
         }
 
-        auto tasks = workflow->getTasks();
-        nlohmann::json task_json;
+        // Set the "vertical position" of each WorkflowExecutionInstance so we know where to plot each rectangle
+        if (generate_host_utilization_layout) {
+            this->generateHostUtilizationLayout(workflow);
+        }
 
-        auto read_start_timestamps = this->getTrace<SimulationTimestampFileReadStart>();
-        auto read_completion_timestamps = this->getTrace<wrench::SimulationTimestampFileReadCompletion>();
-        auto read_failure_timestamps = this->getTrace<wrench::SimulationTimestampFileReadFailure>();
+        if (writing_file) {
+            std::ofstream output(file_path);
+            JSONStreamWriter writer(output);
+            writer.beginObject();
+            writer.key("workflow_execution");
+            this->writeWorkflowExecutionJSON(writer, workflow);
+            writer.endObject();
+            output << std::endl;
+            output.close();
+        }
+    }
 
-        auto write_start_timestamps = this->getTrace<SimulationTimestampFileWriteStart>();
-        auto write_completion_timestamps = this->getTrace<wrench::SimulationTimestampFileWriteCompletion>();
-        auto write_failure_timestamps = this->getTrace<wrench::SimulationTimestampFileWriteFailure>();
+    /**
+     * @brief Writes the workflow execution section (see dumpWorkflowExecutionJSON()) one task execution at a time
+     * @param writer: the JSON writer
+     * @param workflow: a pointer to the Workflow
+     */
+    void SimulationOutput::writeWorkflowExecutionJSON(JSONStreamWriter &writer, Workflow *workflow) {
+        writer.beginObject();
+        writer.key("tasks");
+        writer.beginArray(true);
+
+        // Single pass over all task executions: the file reads/writes of each task are retrieved
+        // from the per-task indices maintained by addTimestampFileReadStart()/addTimestampFileWriteStart()
+        for (auto const &task : workflow->getTasks()) {
+            nlohmann::json file_reads;
+            auto read_starts = this->file_read_starts_by_task.find(task->getID());
+            if (read_starts != this->file_read_starts_by_task.end()) {
+                for (auto const &read_start_timestamp : read_starts->second) {
+                    file_reads.push_back(nlohmann::json::object(
+                            {{"end",   read_start_timestamp->getEndpoint()->getDate()},
+                             {"start", read_start_timestamp->getDate()},
+                             {"id",    read_start_timestamp->getFile()->getID()}}));
+                }
+            }
 
-        std::vector <WorkflowTaskExecutionInstance> data;
+            nlohmann::json file_writes;
+            auto write_starts = this->file_write_starts_by_task.find(task->getID());
+            if (write_starts != this->file_write_starts_by_task.end()) {
+                for (auto const &write_start_timestamp : write_starts->second) {
+                    file_writes.push_back(nlohmann::json::object(
+                            {{"end",   write_start_timestamp->getEndpoint()->getDate()},
+                             {"start", write_start_timestamp->getDate()},
+                             {"id",    write_start_timestamp->getFile()->getID()}}));
+                }
+            }
 
-        for (auto const &task : tasks) {
             auto execution_history = task->getExecutionHistory();
             while (not execution_history.empty()) {
                 auto current_task_execution = execution_history.top();
-                WorkflowTaskExecutionInstance current_execution_instance;
-
-                current_execution_instance.task_id = task->getID();
 
-                if (!read_start_timestamps.empty()) {
-                    for (auto &read_start_timestamp : read_start_timestamps) {
-                        if (read_start_timestamp->getContent()->getTask()->getID() ==
-                            current_execution_instance.task_id) {
-                            current_execution_instance.reads.emplace_back(
-                                    read_start_timestamp->getContent()->getDate(),
-                                    read_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                    read_start_timestamp->getContent()->getFile()->getID());
-                        }
-                    }
-                }
-
-                if (!write_start_timestamps.empty()) {
-                    for (auto &write_start_timestamp : write_start_timestamps) {
-                        if (write_start_timestamp->getContent()->getTask()->getID() ==
-                            current_execution_instance.task_id) {
-                            current_execution_instance.writes.emplace_back(
-                                    write_start_timestamp->getContent()->getDate(),
-                                    write_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                    write_start_timestamp->getContent()->getFile()->getID());
-                        }
-                    }
-                }
-
-                nlohmann::json file_reads;
-                for (auto const &r : current_execution_instance.reads) {
-                    nlohmann::json file_read = nlohmann::json::object({{"end",   std::get<1>(r)},
-                                                                       {"start", std::get<0>(r)},
-                                                                       {"id",    std::get<2>(r)}});
-                    file_reads.push_back(file_read);
-                }
-
-                nlohmann::json file_writes;
-                for (auto const &r : current_execution_instance.writes) {
-                    nlohmann::json file_write = nlohmann::json::object({{"end",   std::get<1>(r)},
-                                                                        {"start", std::get<0>(r)},
-                                                                        {"id",    std::get<2>(r)}});
-                    file_writes.push_back(file_write);
-                }
-                task_json.push_back(
+                writer.value(
                         {
                                 {"task_id",             task->getID()},
                                 {"color",               task->getColor()},
@@ -623,8 +684,22 @@ namespace wrench {
             }
         }
 
+        writer.endArray();
+        writer.endObject();
+    }
+
+    /**
+     * @brief Searches for a host utilization layout for all task executions and writes it
+     *        to the "host_utilization_layout.json" file
+     * @param workflow: a pointer to the Workflow
+     *
+     * @throws std::runtime_error
+     */
+    void SimulationOutput::generateHostUtilizationLayout(Workflow *workflow) {
+        std::vector <WorkflowTaskExecutionInstance> data;
+
         // For each attempted execution of a task, add a WorkflowTaskExecutionInstance to the list.
-        for (auto const &task : tasks) {
+        for (auto const &task : workflow->getTasks()) {
             auto execution_history = task->getExecutionHistory();
 
             while (not execution_history.empty()) {
@@ -634,30 +709,6 @@ namespace wrench {
 
                 current_execution_instance.task_id = task->getID();
 
-                if (!read_start_timestamps.empty()) {
-                    for (auto &read_start_timestamp : read_start_timestamps) {
-                        if (read_start_timestamp->getContent()->getTask()->getID() ==
-                            current_execution_instance.task_id) {
-                            current_execution_instance.reads.emplace_back(
-                                    read_start_timestamp->getContent()->getDate(),
-                                    read_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                    read_start_timestamp->getContent()->getFile()->getID());
-                        }
-                    }
-                }
-
-                if (!write_start_timestamps.empty()) {
-                    for (auto &write_start_timestamp : write_start_timestamps) {
-                        if (write_start_timestamp->getContent()->getTask()->getID() ==
-                            current_execution_instance.task_id) {
-                            current_execution_instance.writes.emplace_back(
-                                    write_start_timestamp->getContent()->getDate(),
-                                    write_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                    write_start_timestamp->getContent()->getFile()->getID());
-                        }
-                    }
-                }
-
                 current_execution_instance.hostname = current_task_execution.execution_host;
                 current_execution_instance.host_flop_rate = Simulation::getHostFlopRate(
                         current_task_execution.execution_host);
@@ -682,29 +733,10 @@ namespace wrench {
             }
         }
 
-        // Set the "vertical position" of each WorkflowExecutionInstance so we know where to plot each rectangle
-        if (generate_host_utilization_layout) {
-            try {
-                generateHostUtilizationGraphLayout(data);
-                std::ofstream output("host_utilization_layout.json");
-                output << std::setw(4) << host_utilization_layout << std::endl;
-                output.close();
-            } catch (std::runtime_error &e) {
-                throw;
-            }
-        }
-
-        nlohmann::json workflow_execution_json;
-        nlohmann::json workflow_execution_json_single;
-        workflow_execution_json["tasks"] = task_json;
-        workflow_execution_json_single["workflow_execution"] = workflow_execution_json;
-        workflow_exec_json_part = workflow_execution_json;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << workflow_execution_json_single << std::endl;
-            output.close();
-        }
+        generateHostUtilizationGraphLayout(data);
+        std::ofstream output("host_utilization_layout.json");
+        output << std::setw(4) << host_utilization_layout << std::endl;
+        output.close();
     }
 
     /**
@@ -756,39 +788,37 @@ namespace wrench {
                     "SimulationOutput::dumpWorkflowGraphJSON() requires a valid workflow and file_path");
         }
 
-        // schema
-        nlohmann::json vertices;
-        nlohmann::json edges;
-
-        // add the task vertices
-        for (const auto &task : workflow->getTasks()) {
-            vertices.push_back({
-                                       {"type",                   "task"},
-                                       {"id",                     task->getID()},
-                                       {"flops",                  task->getFlops()},
-                                       {"min_cores",              task->getMinNumCores()},
-                                       {"max_cores",              task->getMaxNumCores()},
-                                       {"memory_manager_service", task->getMemoryRequirement()}
-                               });
+        if (writing_file) {
+            std::ofstream output(file_path);
+            JSONStreamWriter writer(output);
+            writer.beginObject();
+            writer.key("workflow_graph");
+            this->writeWorkflowGraphJSON(writer, workflow);
+            writer.endObject();
+            output << std::endl;
+            output.close();
         }
+    }
 
-        // add the file vertices
-        for (const auto &file : workflow->getFiles()) {
-            vertices.push_back({
-                                       {"type", "file"},
-                                       {"id",   file->getID()},
-                                       {"size", file->getSize()}
-                               });
-        }
+    /**
+     * @brief Writes the workflow graph section (see dumpWorkflowGraphJSON()) one vertex/edge at a time
+     * @param writer: the JSON writer
+     * @param workflow: a pointer to the workflow
+     */
+    void SimulationOutput::writeWorkflowGraphJSON(JSONStreamWriter &writer, Workflow *workflow) {
+        // Keys are written in alphabetical order, as nlohmann::json would
+        writer.beginObject();
 
         // add the edges
+        writer.key("edges");
+        writer.beginArray(true);
         for (const auto &task : workflow->getTasks()) {
             // create edges between input files (if any) and the current task
             for (const auto &input_file : task->getInputFiles()) {
-                edges.push_back({
-                                        {"source", input_file->getID()},
-                                        {"target", task->getID()}
-                                });
+                writer.value({
+                                     {"source", input_file->getID()},
+                                     {"target", task->getID()}
+                             });
             }
 
             bool has_output_files = not task->getOutputFiles().empty();
@@ -797,31 +827,45 @@ namespace wrench {
             if (has_output_files) {
                 // create the edges between current task and its output files (if any)
                 for (const auto &output_file : task->getOutputFiles()) {
-                    edges.push_back({{"source", task->getID()},
-                                     {"target", output_file->getID()}});
+                    writer.value({{"source", task->getID()},
+                                  {"target", output_file->getID()}});
                 }
             } else if (has_children) {
                 // then create the edges from the current task to its children tasks (if it has not output files)
-                for (const auto &child : workflow->getTaskChildren(task)) {
-                    edges.push_back({
-                                            {"source", task->getID()},
-                                            {"target", child->getID()}});
+                for (const auto &child : workflow->getTaskChildrenView(task)) {
+                    writer.value({
+                                         {"source", task->getID()},
+                                         {"target", child->getID()}});
                 }
             }
         }
+        writer.endArray();
 
-        nlohmann::json workflow_task_graph;
-        workflow_task_graph["vertices"] = vertices;
-        workflow_task_graph["edges"] = edges;
-        nlohmann::json workflow_graph;
-        workflow_graph["workflow_graph"] = workflow_task_graph;
-        workflow_graph_json_part = workflow_task_graph;
+        writer.key("vertices");
+        writer.beginArray(true);
+        // add the task vertices
+        for (const auto &task : workflow->getTasks()) {
+            writer.value({
+                                 {"type",                   "task"},
+                                 {"id",                     task->getID()},
+                                 {"flops",                  task->getFlops()},
+                                 {"min_cores",              task->getMinNumCores()},
+                                 {"max_cores",              task->getMaxNumCores()},
+                                 {"memory_manager_service", task->getMemoryRequirement()}
+                         });
+        }
 
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << nlohmann::json(workflow_graph) << std::endl;
-            output.close();
+        // add the file vertices
+        for (const auto &file : workflow->getFiles()) {
+            writer.value({
+                                 {"type", "file"},
+                                 {"id",   file->getID()},
+                                 {"size", file->getSize()}
+                         });
         }
+        writer.endArray();
+
+        writer.endObject();
     }
 
     /**
@@ -879,98 +923,123 @@ namespace wrench {
             throw std::invalid_argument("SimulationOutput::dumpHostEnergyConsumptionJSON() requires a valid file_path");
         }
 
-        try {
-            std::vector < simgrid::s4u::Host * > hosts = get_all_physical_hosts();
-
-            nlohmann::json hosts_energy_consumption_information;
-            for (const auto &host : hosts) {
-                nlohmann::json datum;
-
-                datum["hostname"] = host->get_name();
-
-                const char *property_string = host->get_property("wattage_per_state");
-                if (property_string == nullptr) {
-                    throw std::runtime_error("Host " + std::string(host->get_name()) +
-                                             " does not have a wattage_per_state property!");
-                }
-                std::string watts_per_state_property_string = std::string(property_string);
-                std::vector <std::string> watts_per_state;
-                boost::split(watts_per_state, watts_per_state_property_string, boost::is_any_of(","));
-
-                for (size_t pstate = 0; pstate < watts_per_state.size(); ++pstate) {
-                    std::vector <std::string> current_state_watts;
-                    boost::split(current_state_watts, watts_per_state.at(pstate), boost::is_any_of(":"));
-
-                    if (current_state_watts.size() == 2) {
-                        datum["pstates"].push_back({
-                                                           {"pstate",    pstate},
-                                                           {"speed",     host->get_pstate_speed((int) pstate)},
-                                                           {"idle",      current_state_watts.at(0)},
-                                                           {"epsilon",   current_state_watts.at(0)},
-                                                           {"all_cores", current_state_watts.at(1)}
-                                                   });
-                    } else if (current_state_watts.size() == 3) {
-                        datum["pstates"].push_back({
-                                                           {"pstate",    pstate},
-                                                           {"speed",     host->get_pstate_speed((int) pstate)},
-                                                           {"idle",      current_state_watts.at(0)},
-                                                           {"epsilon",   current_state_watts.at(1)},
-                                                           {"all_cores", current_state_watts.at(2)}
-                                                   });
-                    } else {
-                        throw std::runtime_error("Host " + std::string(host->get_name()) +
-                                                 "'s wattage_per_state property is invalid (should have 2 or 3 " +
-                                                 "colon-separated numbers)");
-                    }
-                }
+        if (writing_file) {
+            std::ofstream output(file_path);
+            JSONStreamWriter writer(output);
+            writer.beginObject();
+            writer.key("energy_consumption");
+            this->writeHostEnergyConsumptionJSON(writer);
+            writer.endObject();
+            output << std::endl;
+            output.close();
+        }
+    }
 
-                const char *wattage_off_value = host->get_property("wattage_off");
-                if (wattage_off_value == nullptr) {
+    /**
+     * @brief Writes the energy consumption section (see dumpHostEnergyConsumptionJSON()) one host at a time
+     * @param writer: the JSON writer
+     *
+     * @throws std::runtime_error
+     */
+    void SimulationOutput::writeHostEnergyConsumptionJSON(JSONStreamWriter &writer) {
+        // Group the pstate and energy consumption timestamps by host, in a single pass over each trace
+        std::unordered_map<std::string, std::vector<SimulationTimestamp<SimulationTimestampPstateSet> *>> pstate_timestamps;
+        for (auto const &pstate_timestamp : this->getTraceView<SimulationTimestampPstateSet>()) {
+            pstate_timestamps[pstate_timestamp->getContent()->getHostname()].push_back(pstate_timestamp);
+        }
+        std::unordered_map<std::string, std::vector<SimulationTimestamp<SimulationTimestampEnergyConsumption> *>> energy_consumption_timestamps;
+        for (auto const &energy_consumption_timestamp : this->getTraceView<SimulationTimestampEnergyConsumption>()) {
+            energy_consumption_timestamps[energy_consumption_timestamp->getContent()->getHostname()].push_back(
+                    energy_consumption_timestamp);
+        }
+
+        writer.beginArray(true);
+        for (const auto &host : get_all_physical_hosts()) {
+            nlohmann::json pstates;
+
+            const char *property_string = host->get_property("wattage_per_state");
+            if (property_string == nullptr) {
+                throw std::runtime_error("Host " + std::string(host->get_name()) +
+                                         " does not have a wattage_per_state property!");
+            }
+            std::string watts_per_state_property_string = std::string(property_string);
+            std::vector <std::string> watts_per_state;
+            boost::split(watts_per_state, watts_per_state_property_string, boost::is_any_of(","));
+
+            for (size_t pstate = 0; pstate < watts_per_state.size(); ++pstate) {
+                std::vector <std::string> current_state_watts;
+                boost::split(current_state_watts, watts_per_state.at(pstate), boost::is_any_of(":"));
+
+                if (current_state_watts.size() == 2) {
+                    pstates.push_back({
+                                              {"pstate",    pstate},
+                                              {"speed",     host->get_pstate_speed((int) pstate)},
+                                              {"idle",      current_state_watts.at(0)},
+                                              {"epsilon",   current_state_watts.at(0)},
+                                              {"all_cores", current_state_watts.at(1)}
+                                      });
+                } else if (current_state_watts.size() == 3) {
+                    pstates.push_back({
+                                              {"pstate",    pstate},
+                                              {"speed",     host->get_pstate_speed((int) pstate)},
+                                              {"idle",      current_state_watts.at(0)},
+                                              {"epsilon",   current_state_watts.at(1)},
+                                              {"all_cores", current_state_watts.at(2)}
+                                      });
+                } else {
                     throw std::runtime_error("Host " + std::string(host->get_name()) +
-                                             " does not have a wattage_off property!");
+                                             "'s wattage_per_state property is invalid (should have 2 or 3 " +
+                                             "colon-separated numbers)");
                 }
+            }
 
-                if (wattage_off_value != nullptr) {
-                    datum["wattage_off"] = std::string(wattage_off_value);
-                }
+            const char *wattage_off_value = host->get_property("wattage_off");
+            if (wattage_off_value == nullptr) {
+                throw std::runtime_error("Host " + std::string(host->get_name()) +
+                                         " does not have a wattage_off property!");
+            }
 
-                for (const auto &pstate_timestamp : this->getTrace<SimulationTimestampPstateSet>()) {
-                    if (host->get_name() == pstate_timestamp->getContent()->getHostname()) {
-                        datum["pstate_trace"].push_back(
-                                {
-                                        {"time",   pstate_timestamp->getDate()},
-                                        {"pstate", pstate_timestamp->getContent()->getPstate()}
-                                });
-                    }
+            // Keys are written in alphabetical order, as nlohmann::json would
+            writer.beginObject();
+
+            auto energy_trace = energy_consumption_timestamps.find(host->get_name());
+            if (energy_trace != energy_consumption_timestamps.end()) {
+                writer.key("consumed_energy_trace");
+                writer.beginArray();
+                for (const auto &energy_consumption_timestamp : energy_trace->second) {
+                    writer.value({
+                                         {"time",   energy_consumption_timestamp->getDate()},
+                                         {"joules", energy_consumption_timestamp->getContent()->getConsumption()}
+                                 });
                 }
+                writer.endArray();
+            }
 
-                for (const auto &energy_consumption_timestamp : this->getTrace<SimulationTimestampEnergyConsumption>()) {
-                    if (host->get_name() == energy_consumption_timestamp->getContent()->getHostname()) {
-                        datum["consumed_energy_trace"].push_back(
-                                {
-                                        {"time",   energy_consumption_timestamp->getDate()},
-                                        {"joules", energy_consumption_timestamp->getContent()->getConsumption()}
-                                });
-                    }
+            writer.key("hostname");
+            writer.value(host->get_name());
+
+            auto pstate_trace = pstate_timestamps.find(host->get_name());
+            if (pstate_trace != pstate_timestamps.end()) {
+                writer.key("pstate_trace");
+                writer.beginArray();
+                for (const auto &pstate_timestamp : pstate_trace->second) {
+                    writer.value({
+                                         {"time",   pstate_timestamp->getDate()},
+                                         {"pstate", pstate_timestamp->getContent()->getPstate()}
+                                 });
                 }
-
-                hosts_energy_consumption_information.push_back(datum);
+                writer.endArray();
             }
 
-            nlohmann::json energy_consumption;
-            energy_consumption["energy_consumption"] = hosts_energy_consumption_information;
-            energy_json_part = hosts_energy_consumption_information;
+            writer.key("pstates");
+            writer.value(pstates);
 
-            if (writing_file) {
-                std::ofstream output(file_path);
-                output << std::setw(4) << nlohmann::json(energy_consumption) << std::endl;
-                output.close();
-            }
+            writer.key("wattage_off");
+            writer.value(std::string(wattage_off_value));
 
-        } catch (std::runtime_error &e) {
-            // Just re-throw
-            throw;
+            writer.endObject();
         }
+        writer.endArray();
     }
 
     /**
@@ -1034,8 +1103,28 @@ namespace wrench {
             throw std::invalid_argument("SimulationOutput::dumpPlatformGraphJSON() requires a valid file_path");
         }
 
+        nlohmann::json platform;
+        platform["platform"] = this->generatePlatformGraphJSON();
+
+        if (writing_file) {
+            std::ofstream output(file_path);
+            output << std::setw(4) << nlohmann::json(platform) << std::endl;
+            output.close();
+        }
+    }
+
+    /**
+     * @brief Generates the platform section (see dumpPlatformGraphJSON()). Unlike other sections, whose size
+     *        depends on the simulation trace, this one is built in memory as its size only depends on the platform.
+     *
+     * @return the platform graph as a JSON object
+     *
+     * @throws std::invalid_argument
+     */
+    nlohmann::json SimulationOutput::generatePlatformGraphJSON() {
         nlohmann::json platform_graph_json;
 
+
 //        simgrid::s4u::Engine *simgrid_engine = simgrid::s4u::Engine::get_instance();
 
         // Get all the hosts
@@ -1265,16 +1354,7 @@ namespace wrench {
             }
         }
 
-        //std::cerr << platform_graph_json.dump(4) << std::endl;
-        nlohmann::json platform;
-        platform["platform"] = platform_graph_json;
-        platform_json_part = platform_graph_json;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << nlohmann::json(platform) << std::endl;
-            output.close();
-        }
+        return platform_graph_json;
     }
 
     /**
@@ -1329,127 +1409,118 @@ namespace wrench {
         if (file_path.empty()) {
             throw std::invalid_argument("SimulationOutput::dumpDiskOperationJSON() requires a valid file_path");
         }
-        nlohmann::json disk_operations_json;
-
-        auto read_start_timestamps = this->getTrace<SimulationTimestampDiskReadStart>();
-        auto read_completion_timestamps = this->getTrace<wrench::SimulationTimestampDiskReadCompletion>();
-        auto read_failure_timestamps = this->getTrace<wrench::SimulationTimestampDiskReadFailure>();
 
-        auto write_start_timestamps = this->getTrace<SimulationTimestampDiskWriteStart>();
-        auto write_completion_timestamps = this->getTrace<wrench::SimulationTimestampDiskWriteCompletion>();
-        auto write_failure_timestamps = this->getTrace<wrench::SimulationTimestampDiskWriteFailure>();
+        if (writing_file) {
+            std::ofstream output(file_path);
+            JSONStreamWriter writer(output);
+            this->writeDiskOperationsJSON(writer);
+            output << std::endl;
+            output.close();
+        }
+    }
 
-        std::set <std::string> hostnames;
+    /**
+     * @brief Writes the disk operations section (see dumpDiskOperationsJSON()) one operation at a time
+     * @param writer: the JSON writer
+     */
+    void SimulationOutput::writeDiskOperationsJSON(JSONStreamWriter &writer) {
+        // Group the disk operations by host and mount point, in a single pass over each trace
+        std::map<std::string, std::map<std::string, std::vector<SimulationTimestampDiskReadStart *>>> reads;
+        for (auto const &timestamp : this->getTraceView<SimulationTimestampDiskReadStart>()) {
+            reads[timestamp->getContent()->getHostname()][timestamp->getContent()->getMount()].push_back(
+                    timestamp->getContent());
+        }
+        std::map<std::string, std::map<std::string, std::vector<SimulationTimestampDiskWriteStart *>>> writes;
+        for (auto const &timestamp : this->getTraceView<SimulationTimestampDiskWriteStart>()) {
+            writes[timestamp->getContent()->getHostname()][timestamp->getContent()->getMount()].push_back(
+                    timestamp->getContent());
+        }
 
-        //std::tuple<string, string, std::tuple<double, double, double>> disk_operation;
-        std::tuple<double, double, double> disk_operation;
+        // An operation is marked as failed if a failure timestamp has its (end, start) dates
+        std::set<std::pair<double, double>> failed_reads;
+        for (auto const &timestamp : this->getTraceView<SimulationTimestampDiskReadFailure>()) {
+            failed_reads.insert(std::make_pair(timestamp->getContent()->getDate(),
+                                               timestamp->getContent()->getEndpoint()->getDate()));
+        }
+        std::set<std::pair<double, double>> failed_writes;
+        for (auto const &timestamp : this->getTraceView<SimulationTimestampDiskWriteFailure>()) {
+            failed_writes.insert(std::make_pair(timestamp->getContent()->getDate(),
+                                                timestamp->getContent()->getEndpoint()->getDate()));
+        }
 
-        if (!read_start_timestamps.empty()) {
-            for (auto &timestamp : read_start_timestamps) {
-                hostnames.insert(timestamp->getContent()->getHostname());
-            }
+        std::set<std::string> hostnames;
+        for (auto const &r : reads) {
+            hostnames.insert(r.first);
         }
-        if (!write_start_timestamps.empty()) {
-            for (auto &timestamp : write_start_timestamps) {
-                hostnames.insert(timestamp->getContent()->getHostname());
-            }
+        for (auto const &w : writes) {
+            hostnames.insert(w.first);
         }
 
-        for (auto &host : hostnames) {
-            std::set <std::string> mounts;
-            if (!read_start_timestamps.empty()) {
-                for (auto &timestamp : read_start_timestamps) {
-                    if (timestamp->getContent()->getHostname().compare(host) == 0) {
-                        mounts.insert(timestamp->getContent()->getMount());
-                    }
+        if (hostnames.empty()) {
+            writer.value(nullptr);
+            return;
+        }
+
+        writer.beginObject();
+        for (auto const &host : hostnames) {
+            auto host_reads = reads.find(host);
+            auto host_writes = writes.find(host);
+
+            std::set<std::string> mounts;
+            if (host_reads != reads.end()) {
+                for (auto const &r : host_reads->second) {
+                    mounts.insert(r.first);
                 }
             }
-            if (!write_start_timestamps.empty()) {
-                for (auto &timestamp : write_start_timestamps) {
-                    if (timestamp->getContent()->getHostname().compare(host) == 0) {
-                        mounts.insert(timestamp->getContent()->getMount());
-                    }
+            if (host_writes != writes.end()) {
+                for (auto const &w : host_writes->second) {
+                    mounts.insert(w.first);
                 }
             }
-            for (auto &mount : mounts) {
-                std::vector <std::tuple<double, double, double>> reads;
-                std::vector <std::tuple<double, double, double>> writes;
-
-                if (!read_start_timestamps.empty()) {
-                    for (auto &read_start_timestamp : read_start_timestamps) {
-                        if (read_start_timestamp->getContent()->getHostname().compare(host) == 0 &&
-                            read_start_timestamp->getContent()->getMount().compare(mount) == 0) {
-                            disk_operation = std::make_tuple(read_start_timestamp->getContent()->getDate(),
-                                                             read_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                                             read_start_timestamp->getContent()->getBytes());
-                            reads.emplace_back(disk_operation);
-                        }
 
+            writer.key(host);
+            writer.beginObject();
+            for (auto const &mount : mounts) {
+                writer.key(mount);
+                writer.beginObject();
+
+                writer.key("reads");
+                writer.beginArray(true);
+                if ((host_reads != reads.end()) and
+                    (host_reads->second.find(mount) != host_reads->second.end())) {
+                    for (auto const &read : host_reads->second[mount]) {
+                        double start = read->getDate();
+                        double end = read->getEndpoint()->getDate();
+                        bool failed = failed_reads.find(std::make_pair(end, start)) != failed_reads.end();
+                        writer.value({{"start",  start},
+                                      {"end",    end},
+                                      {"bytes",  read->getBytes()},
+                                      {"failed", (failed ? "1" : "-1")}});
                     }
                 }
-                if (!write_start_timestamps.empty()) {
-                    for (auto &write_start_timestamp : write_start_timestamps) {
-                        if (write_start_timestamp->getContent()->getHostname().compare(host) == 0 &&
-                            write_start_timestamp->getContent()->getMount().compare(mount) == 0) {
-                            disk_operation = std::make_tuple(write_start_timestamp->getContent()->getDate(),
-                                                             write_start_timestamp->getContent()->getEndpoint()->getDate(),
-                                                             write_start_timestamp->getContent()->getBytes());
-                            writes.emplace_back(disk_operation);
-                        }
-
+                writer.endArray();
+
+                writer.key("writes");
+                writer.beginArray(true);
+                if ((host_writes != writes.end()) and
+                    (host_writes->second.find(mount) != host_writes->second.end())) {
+                    for (auto const &write : host_writes->second[mount]) {
+                        double start = write->getDate();
+                        double end = write->getEndpoint()->getDate();
+                        bool failed = failed_writes.find(std::make_pair(end, start)) != failed_writes.end();
+                        writer.value({{"start",  start},
+                                      {"end",    end},
+                                      {"bytes",  write->getBytes()},
+                                      {"failed", (failed ? "1" : "-1")}});
                     }
                 }
+                writer.endArray();
 
-                nlohmann::json disk_reads;
-                for (auto const &r : reads) {
-                    nlohmann::json disk_read = nlohmann::json::object({{"start",  std::get<0>(r)},
-                                                                       {"end",    std::get<1>(r)},
-                                                                       {"bytes",  std::get<2>(r)},
-                                                                       {"failed", "-1"}});
-                    disk_reads.push_back(disk_read);
-                }
-                if (!read_failure_timestamps.empty()) {
-                    for (auto &timestamp : read_failure_timestamps) {
-                        for (auto &disk_read : disk_reads) {
-                            if (timestamp->getContent()->getDate() == disk_read["end"] &&
-                                timestamp->getContent()->getEndpoint()->getDate() == disk_read["start"]) {
-                                disk_read["failed"] = "1";
-                            }
-                        }
-                    }
-                }
-
-                nlohmann::json disk_writes;
-                for (auto const &w : writes) {
-                    nlohmann::json disk_write = nlohmann::json::object({{"start",  std::get<0>(w)},
-                                                                        {"end",    std::get<1>(w)},
-                                                                        {"bytes",  std::get<2>(w)},
-                                                                        {"failed", "-1"}});
-                    disk_writes.push_back(disk_write);
-                }
-                if (!write_failure_timestamps.empty()) {
-                    for (auto &timestamp : write_failure_timestamps) {
-                        for (auto &disk_write : disk_writes) {
-                            if (timestamp->getContent()->getDate() == disk_write["end"] &&
-                                timestamp->getContent()->getEndpoint()->getDate() == disk_write["start"]) {
-                                disk_write["failed"] = "1";
-                            }
-                        }
-                    }
-                }
-
-                disk_operations_json[host][mount]["reads"] = disk_reads;
-                disk_operations_json[host][mount]["writes"] = disk_writes;
+                writer.endObject();
             }
+            writer.endObject();
         }
-
-        disk_json_part = disk_operations_json;
-
-        if (writing_file) {
-            std::ofstream output(file_path);
-            output << std::setw(4) << disk_operations_json << std::endl;
-            output.close();
-        }
+        writer.endObject();
     }
 
     /** Writes a JSON file containing link usage information as a JSON array.
@@ -1494,43 +1565,268 @@ namespace wrench {
             throw std::invalid_argument("SimulationOutput::dumpLinkUsageJSON() requires a valid file_path");
         }
 
-        nlohmann::json bandwidth_json;
-
-        try {
-            auto simgrid_engine = simgrid::s4u::Engine::get_instance();
-            std::vector < simgrid::s4u::Link * > links = get_all_links();
-
-            for (const auto &link: links) {
-                nlohmann::json datum;
-                datum["linkname"] = link->get_name();
+        if (writing_file) {
+            std::ofstream output(file_path);
+            JSONStreamWriter writer(output);
+            writer.beginObject();
+            writer.key("link_usage");
+            this->writeLinkUsageJSON(writer);
+            writer.endObject();
+            output << std::endl;
+            output.close();
+        }
+    }
 
-                for (const auto &link_usage_timestamp : this->getTrace<SimulationTimestampLinkUsage>()) {
-                    if (link->get_name() == link_usage_timestamp->getContent()->getLinkname()) {
-                        datum["link_usage_trace"].push_back(
-                                {
-                                        {"time",             link_usage_timestamp->getDate()},
-                                        {"bytes per second", link_usage_timestamp->getContent()->getUsage()}
-                                });
-                    }
+    /**
+     * @brief Writes the link usage section (see dumpLinkUsageJSON()) one link at a time
+     * @param writer: the JSON writer
+     */
+    void SimulationOutput::writeLinkUsageJSON(JSONStreamWriter &writer) {
+        // Group the link usage timestamps by link, in a single pass over the trace
+        std::unordered_map<std::string, std::vector<SimulationTimestamp<SimulationTimestampLinkUsage> *>> link_usage_timestamps;
+        for (auto const &link_usage_timestamp : this->getTraceView<SimulationTimestampLinkUsage>()) {
+            link_usage_timestamps[link_usage_timestamp->getContent()->getLinkname()].push_back(link_usage_timestamp);
+        }
+
+        writer.beginObject();
+        writer.key("links");
+        writer.beginArray(true);
+        for (const auto &link : get_all_links()) {
+            writer.beginObject();
+            auto link_trace = link_usage_timestamps.find(link->get_name());
+            if (link_trace != link_usage_timestamps.end()) {
+                writer.key("link_usage_trace");
+                writer.beginArray();
+                for (auto const &link_usage_timestamp : link_trace->second) {
+                    writer.value({
+                                         {"time",             link_usage_timestamp->getDate()},
+                                         {"bytes per second", link_usage_timestamp->getContent()->getUsage()}
+                                 });
                 }
+                writer.endArray();
+            }
+            writer.key("linkname");
+            writer.value(link->get_name());
+            writer.endObject();
+        }
+        writer.endArray();
+        writer.endObject();
+    }
 
-                bandwidth_json.push_back(datum);
+    /**
+     * @brief The columns of a binary trace, as built by dumpBinaryTrace() before they are written out
+     */
+    struct BinaryTraceColumns {
+        std::vector<double> dates;
+        std::vector<double> values;
+        std::vector<SimulationTimestampPair *> pairs;
+        std::vector<uint32_t> subjects;
+        std::vector<SimulationTraceFile::Kind> kinds;
+        std::unordered_map<std::string, uint32_t> string_indices;
+        std::vector<std::string> strings;
+
+        uint32_t intern(const std::string &string) {
+            auto it = this->string_indices.find(string);
+            if (it != this->string_indices.end()) {
+                return it->second;
             }
+            this->strings.push_back(string);
+            return this->string_indices[string] = (uint32_t) (this->strings.size() - 1);
+        }
+    };
+
+    static std::string binaryTraceSubject(SimulationTimestampTask *content) {
+        return content->getTask() ? content->getTask()->getID() : "";
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampFileRead *content) {
+        return content->getFile() ? content->getFile()->getID() : "";
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampFileWrite *content) {
+        return content->getFile() ? content->getFile()->getID() : "";
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampFileCopy *content) {
+        return content->getFile() ? content->getFile()->getID() : "";
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampDiskRead *content) {
+        return content->getHostname();
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampDiskWrite *content) {
+        return content->getHostname();
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampPstateSet *content) {
+        return content->getHostname();
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampEnergyConsumption *content) {
+        return content->getHostname();
+    }
+
+    static std::string binaryTraceSubject(SimulationTimestampLinkUsage *content) {
+        return content->getLinkname();
+    }
+
+    static double binaryTraceValue(SimulationTimestampType *content) {
+        return 0.0;
+    }
+
+    static double binaryTraceValue(SimulationTimestampDiskRead *content) {
+        return content->getBytes();
+    }
+
+    static double binaryTraceValue(SimulationTimestampDiskWrite *content) {
+        return content->getBytes();
+    }
 
-            nlohmann::json link_usage;
-            nlohmann::json links_list;
-            links_list["links"] = bandwidth_json;
-            link_usage["link_usage"] = links_list;
-            bandwidth_json_part = links_list;
+    static double binaryTraceValue(SimulationTimestampPstateSet *content) {
+        return content->getPstate();
+    }
+
+    static double binaryTraceValue(SimulationTimestampEnergyConsumption *content) {
+        return content->getConsumption();
+    }
+
+    static double binaryTraceValue(SimulationTimestampLinkUsage *content) {
+        return content->getUsage();
+    }
 
-            if (writing_file) {
-                std::ofstream output(file_path);
-                output << std::setw(4) << link_usage << std::endl;
-                output.close();
+    static SimulationTimestampPair *binaryTracePair(SimulationTimestampType *content) {
+        return nullptr;
+    }
+
+    static SimulationTimestampPair *binaryTracePair(SimulationTimestampPair *content) {
+        return content;
+    }
+
+    /**
+     * @brief Append all timestamps of a trace to binary trace columns
+     * @tparam a particular SimulationTimestampXXXX class (defined in SimulationTimestampTypes.h)
+     * @param output: the simulation output
+     * @param kind: the event kind of timestamps of class T
+     * @param columns: the columns
+     */
+    template<class T>
+    static void appendBinaryTraceColumns(SimulationOutput &output, SimulationTraceFile::Kind kind,
+                                         BinaryTraceColumns &columns) {
+        for (auto const &timestamp : output.getTraceView<T>()) {
+            auto content = timestamp->getContent();
+            columns.dates.push_back(content->getDate());
+            columns.values.push_back(binaryTraceValue(content));
+            columns.pairs.push_back(binaryTracePair(content));
+            columns.subjects.push_back(columns.intern(binaryTraceSubject(content)));
+            columns.kinds.push_back(kind);
+        }
+    }
+
+    /**
+     * @brief Writes all simulation timestamps to a binary trace file, in a columnar layout that
+     *        can be memory-mapped by analysis tools without any parsing (see SimulationTraceFile
+     *        for the file format, and for a reader)
+     *
+     * @param file_path: the path to the binary trace file
+     *
+     * @throws std::invalid_argument
+     * @throws std::runtime_error
+     */
+    void SimulationOutput::dumpBinaryTrace(std::string file_path) {
+        if (file_path.empty()) {
+            throw std::invalid_argument("SimulationOutput::dumpBinaryTrace() requires a valid file_path");
+        }
+
+        BinaryTraceColumns columns;
+        appendBinaryTraceColumns<SimulationTimestampTaskStart>(*this, SimulationTraceFile::TASK_START, columns);
+        appendBinaryTraceColumns<SimulationTimestampTaskFailure>(*this, SimulationTraceFile::TASK_FAILURE, columns);
+        appendBinaryTraceColumns<SimulationTimestampTaskCompletion>(*this, SimulationTraceFile::TASK_COMPLETION, columns);
+        appendBinaryTraceColumns<SimulationTimestampTaskTermination>(*this, SimulationTraceFile::TASK_TERMINATION, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileReadStart>(*this, SimulationTraceFile::FILE_READ_START, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileReadFailure>(*this, SimulationTraceFile::FILE_READ_FAILURE, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileReadCompletion>(*this, SimulationTraceFile::FILE_READ_COMPLETION, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileWriteStart>(*this, SimulationTraceFile::FILE_WRITE_START, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileWriteFailure>(*this, SimulationTraceFile::FILE_WRITE_FAILURE, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileWriteCompletion>(*this, SimulationTraceFile::FILE_WRITE_COMPLETION, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileCopyStart>(*this, SimulationTraceFile::FILE_COPY_START, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileCopyFailure>(*this, SimulationTraceFile::FILE_COPY_FAILURE, columns);
+        appendBinaryTraceColumns<SimulationTimestampFileCopyCompletion>(*this, SimulationTraceFile::FILE_COPY_COMPLETION, columns);
+        appendBinaryTraceColumns<SimulationTimestampDiskReadStart>(*this, SimulationTraceFile::DISK_READ_START, columns);
+        appendBinaryTraceColumns<SimulationTimestampDiskReadFailure>(*this, SimulationTraceFile::DISK_READ_FAILURE, columns);
+        appendBinaryTraceColumns<SimulationTimestampDiskReadCompletion>(*this, SimulationTraceFile::DISK_READ_COMPLETION, columns);
+        appendBinaryTraceColumns<SimulationTimestampDiskWriteStart>(*this, SimulationTraceFile::DISK_WRITE_START, columns);
+        appendBinaryTraceColumns<SimulationTimestampDiskWriteFailure>(*this, SimulationTraceFile::DISK_WRITE_FAILURE, columns);
+        appendBinaryTraceColumns<SimulationTimestampDiskWriteCompletion>(*this, SimulationTraceFile::DISK_WRITE_COMPLETION, columns);
+        appendBinaryTraceColumns<SimulationTimestampPstateSet>(*this, SimulationTraceFile::PSTATE_SET, columns);
+        appendBinaryTraceColumns<SimulationTimestampEnergyConsumption>(*this, SimulationTraceFile::ENERGY_CONSUMPTION, columns);
+        appendBinaryTraceColumns<SimulationTimestampLinkUsage>(*this, SimulationTraceFile::LINK_USAGE, columns);
+
+        // Resolve start/end timestamp pairs into event indices
+        size_t num_events = columns.dates.size();
+        std::unordered_map<SimulationTimestampPair *, int64_t> event_indices;
+        for (size_t i = 0; i < num_events; i++) {
+            if (columns.pairs[i] != nullptr) {
+                event_indices[columns.pairs[i]] = (int64_t) i;
+            }
+        }
+        std::vector<int64_t> endpoints(num_events, -1);
+        for (size_t i = 0; i < num_events; i++) {
+            if ((columns.pairs[i] != nullptr) and (columns.pairs[i]->getEndpoint() != nullptr)) {
+                auto endpoint = event_indices.find(columns.pairs[i]->getEndpoint());
+                if (endpoint != event_indices.end()) {
+                    endpoints[i] = endpoint->second;
+                }
             }
-        } catch (std::runtime_error &e) {
-            throw;
         }
+
+        std::vector<uint64_t> string_offsets;
+        string_offsets.reserve(columns.strings.size() + 1);
+        uint64_t string_bytes = 0;
+        for (auto const &string : columns.strings) {
+            string_offsets.push_back(string_bytes);
+            string_bytes += string.size();
+        }
+        string_offsets.push_back(string_bytes);
+
+        auto layout = SimulationTraceFile::computeLayout(num_events, columns.strings.size(), string_bytes);
+
+        // Write the columns directly into the memory-mapped file
+        int fd = open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            throw std::runtime_error("SimulationOutput::dumpBinaryTrace(): cannot create file " + file_path);
+        }
+        if (ftruncate(fd, (off_t) layout.size) != 0) {
+            close(fd);
+            throw std::runtime_error("SimulationOutput::dumpBinaryTrace(): cannot resize file " + file_path);
+        }
+        auto mapping = (char *) mmap(nullptr, layout.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd);
+            throw std::runtime_error("SimulationOutput::dumpBinaryTrace(): cannot map file " + file_path);
+        }
+
+        SimulationTraceFile::Header header;
+        memset(&header, 0, sizeof(header));
+        memcpy(header.magic, SimulationTraceFile::MAGIC, sizeof(header.magic));
+        header.version = SimulationTraceFile::VERSION;
+        header.num_events = num_events;
+        header.num_strings = columns.strings.size();
+        header.string_bytes = string_bytes;
+        memcpy(mapping, &header, sizeof(header));
+
+        memcpy(mapping + layout.dates, columns.dates.data(), num_events * sizeof(double));
+        memcpy(mapping + layout.values, columns.values.data(), num_events * sizeof(double));
+        memcpy(mapping + layout.endpoints, endpoints.data(), num_events * sizeof(int64_t));
+        memcpy(mapping + layout.subjects, columns.subjects.data(), num_events * sizeof(uint32_t));
+        memcpy(mapping + layout.kinds, columns.kinds.data(), num_events * sizeof(uint8_t));
+        memcpy(mapping + layout.string_offsets, string_offsets.data(), string_offsets.size() * sizeof(uint64_t));
+        for (size_t i = 0; i < columns.strings.size(); i++) {
+            memcpy(mapping + layout.strings + string_offsets[i], columns.strings[i].data(), columns.strings[i].size());
+        }
+
+        munmap(mapping, layout.size);
+        close(fd);
     }
 
     /**
@@ -1638,8 +1934,11 @@ namespace wrench {
                                                      StorageService *service,
                                                      WorkflowTask *task) {
         if (this->isEnabled<SimulationTimestampFileReadStart>()) {
-            this->addTimestamp<SimulationTimestampFileReadStart>(
-                    new SimulationTimestampFileReadStart(file, src, service, task));
+            auto timestamp = new SimulationTimestampFileReadStart(file, src, service, task);
+            this->addTimestamp<SimulationTimestampFileReadStart>(timestamp);
+            if (task != nullptr) {
+                this->file_read_starts_by_task[task->getID()].push_back(timestamp);
+            }
         }
     }
 
@@ -1690,8 +1989,11 @@ namespace wrench {
                                                       StorageService *service,
                                                       WorkflowTask *task) {
         if (this->isEnabled<SimulationTimestampFileWriteStart>()) {
-            this->addTimestamp<SimulationTimestampFileWriteStart>(
-                    new SimulationTimestampFileWriteStart(file, src, service, task));
+            auto timestamp = new SimulationTimestampFileWriteStart(file, src, service, task);
+            this->addTimestamp<SimulationTimestampFileWriteStart>(timestamp);
+            if (task != nullptr) {
+                this->file_write_starts_by_task[task->getID()].push_back(timestamp);
+            }
         }
     }
 
@@ -0,0 +1,179 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include "wrench/simulation/SimulationTraceFile.h"
+
+#include <cstring>
+#include <stdexcept>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace wrench {
+
+    constexpr char SimulationTraceFile::MAGIC[8];
+    constexpr uint32_t SimulationTraceFile::VERSION;
+
+    /**
+     * @brief Round up an offset to a multiple of 8 bytes
+     * @param offset: an offset
+     * @return the aligned offset
+     */
+    static size_t align8(size_t offset) {
+        return (offset + 7) & ~((size_t) 7);
+    }
+
+    /**
+     * @brief Compute the offsets of each section of a trace file
+     * @param num_events: the number of events
+     * @param num_strings: the number of strings in the string table
+     * @param string_bytes: the number of characters in the string table
+     * @return the layout of the file
+     */
+    SimulationTraceFile::Layout SimulationTraceFile::computeLayout(uint64_t num_events,
+                                                                   uint64_t num_strings,
+                                                                   uint64_t string_bytes) {
+        Layout layout;
+        layout.dates = sizeof(Header);
+        layout.values = align8(layout.dates + num_events * sizeof(double));
+        layout.endpoints = align8(layout.values + num_events * sizeof(double));
+        layout.subjects = align8(layout.endpoints + num_events * sizeof(int64_t));
+        layout.kinds = align8(layout.subjects + num_events * sizeof(uint32_t));
+        layout.string_offsets = align8(layout.kinds + num_events * sizeof(uint8_t));
+        layout.strings = align8(layout.string_offsets + (num_strings + 1) * sizeof(uint64_t));
+        layout.size = layout.strings + string_bytes;
+        return layout;
+    }
+
+    /**
+     * @brief Constructor: maps a binary trace file in memory (read-only)
+     * @param file_path: the path to a file written by SimulationOutput::dumpBinaryTrace()
+     *
+     * @throws std::invalid_argument
+     */
+    SimulationTraceFile::SimulationTraceFile(const std::string &file_path) {
+        this->fd = open(file_path.c_str(), O_RDONLY);
+        if (this->fd < 0) {
+            throw std::invalid_argument("SimulationTraceFile::SimulationTraceFile(): cannot open file " + file_path);
+        }
+
+        struct stat file_stat;
+        if ((fstat(this->fd, &file_stat) != 0) or ((size_t) file_stat.st_size < sizeof(Header))) {
+            close(this->fd);
+            throw std::invalid_argument("SimulationTraceFile::SimulationTraceFile(): file " + file_path +
+                                        " is not a WRENCH binary trace file");
+        }
+
+        this->mapping_size = (size_t) file_stat.st_size;
+        this->mapping = mmap(nullptr, this->mapping_size, PROT_READ, MAP_SHARED, this->fd, 0);
+        if (this->mapping == MAP_FAILED) {
+            close(this->fd);
+            throw std::invalid_argument("SimulationTraceFile::SimulationTraceFile(): cannot map file " + file_path);
+        }
+
+        this->header = (const Header *) this->mapping;
+        if ((memcmp(this->header->magic, MAGIC, sizeof(MAGIC)) != 0) or (this->header->version != VERSION)) {
+            munmap(this->mapping, this->mapping_size);
+            close(this->fd);
+            throw std::invalid_argument("SimulationTraceFile::SimulationTraceFile(): file " + file_path +
+                                        " is not a WRENCH binary trace file (or has an unsupported version)");
+        }
+
+        this->layout = computeLayout(this->header->num_events, this->header->num_strings,
+                                     this->header->string_bytes);
+        if (this->layout.size != this->mapping_size) {
+            munmap(this->mapping, this->mapping_size);
+            close(this->fd);
+            throw std::invalid_argument("SimulationTraceFile::SimulationTraceFile(): file " + file_path +
+                                        " is truncated or corrupted");
+        }
+    }
+
+    /**
+     * @brief Destructor
+     */
+    SimulationTraceFile::~SimulationTraceFile() {
+        munmap(this->mapping, this->mapping_size);
+        close(this->fd);
+    }
+
+    /**
+     * @brief Get the number of events in the trace
+     * @return a number of events
+     */
+    size_t SimulationTraceFile::getNumEvents() const {
+        return this->header->num_events;
+    }
+
+    /**
+     * @brief Get the date column
+     * @return an array of getNumEvents() dates
+     */
+    const double *SimulationTraceFile::getDates() const {
+        return (const double *) ((const char *) this->mapping + this->layout.dates);
+    }
+
+    /**
+     * @brief Get the value column
+     * @return an array of getNumEvents() values
+     */
+    const double *SimulationTraceFile::getValues() const {
+        return (const double *) ((const char *) this->mapping + this->layout.values);
+    }
+
+    /**
+     * @brief Get the endpoint column
+     * @return an array of getNumEvents() event indices (-1 for events without an endpoint)
+     */
+    const int64_t *SimulationTraceFile::getEndpoints() const {
+        return (const int64_t *) ((const char *) this->mapping + this->layout.endpoints);
+    }
+
+    /**
+     * @brief Get the subject column
+     * @return an array of getNumEvents() string table indices
+     */
+    const uint32_t *SimulationTraceFile::getSubjects() const {
+        return (const uint32_t *) ((const char *) this->mapping + this->layout.subjects);
+    }
+
+    /**
+     * @brief Get the kind column
+     * @return an array of getNumEvents() event kinds
+     */
+    const SimulationTraceFile::Kind *SimulationTraceFile::getKinds() const {
+        return (const Kind *) ((const char *) this->mapping + this->layout.kinds);
+    }
+
+    /**
+     * @brief Get the number of strings in the string table
+     * @return a number of strings
+     */
+    size_t SimulationTraceFile::getNumStrings() const {
+        return this->header->num_strings;
+    }
+
+    /**
+     * @brief Get a string from the string table
+     * @param index: a string index (e.g., a value from the subject column)
+     * @return the string
+     *
+     * @throws std::invalid_argument
+     */
+    std::string SimulationTraceFile::getString(uint32_t index) const {
+        if (index >= this->header->num_strings) {
+            throw std::invalid_argument("SimulationTraceFile::getString(): invalid string index");
+        }
+        auto offsets = (const uint64_t *) ((const char *) this->mapping + this->layout.string_offsets);
+        auto strings = (const char *) this->mapping + this->layout.strings;
+        return std::string(strings + offsets[index], offsets[index + 1] - offsets[index]);
+    }
+
+};
@@ -8,9 +8,9 @@
  */
 
 #include <vector>
+#include <algorithm>
 #include "wrench/workflow/DagOfTasks.h"
 #include "wrench/logging/TerminalOutput.h"
-#include <boost/property_map/property_map.hpp>
 
 
 WRENCH_LOG_CATEGORY(dag_of_tasks, "Log category for DagOfTasks");
@@ -22,37 +22,49 @@ namespace wrench {
  * @param task: the task
  */
     void wrench::DagOfTasks::addVertex(const wrench::WorkflowTask *task) {
+        this->thaw();
 
+        // Discard the const qualifier
+        auto vertex_task = (WorkflowTask *) task;
+        // Set the task's vertex index
+        vertex_task->dag_index = this->tasks.size();
         // Add a new vertex
-        VertexProperties p = {task};
-        boost::add_vertex(p, this->dag);
-        // Update the vertex vector
-        this->task_list.push_back(task);
-        // Set the task's vertex id in the task map
-        this->task_map[task] =  this->task_list.size() - 1;
+        this->tasks.push_back(vertex_task);
+        this->children.emplace_back();
+        this->parents.emplace_back();
     }
 
 /**
- * @brief Method to remove a task vertex from the DAG
+ * @brief Method to remove a task vertex from the DAG (the last vertex takes over
+ *        the index of the removed vertex)
  * @param task: the task
  */
     void wrench::DagOfTasks::removeVertex(wrench::WorkflowTask *task) {
-        // Find the vertex
-        if (this->task_map[task] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::removeVertex(): Trying to remove a non-existing vertex");
-        }
-        // Remove the correspond task list item
-        this->task_list.erase(this->task_list.begin() + this->task_map[task]);
-        // Update subsequent task's vertex indices
-        for (auto it = this->task_list.begin()  +  this->task_map[task]; it != this->task_list.end(); ++it) {
-            this->task_map[*it]--;
-        }
+        auto vertex = this->getVertex(task, "wrench::DagOfTasks::removeVertex(): Trying to remove a non-existing vertex");
+        this->thaw();
 
         // Remove all in and out edges at that vertex
-        boost::clear_vertex(this->task_map[task], this->dag);
+        for (auto const &child : this->children[vertex]) {
+            auto &child_parents = this->parents[child->dag_index];
+            child_parents.erase(std::remove(child_parents.begin(), child_parents.end(), task), child_parents.end());
+        }
+        for (auto const &parent : this->parents[vertex]) {
+            auto &parent_children = this->children[parent->dag_index];
+            parent_children.erase(std::remove(parent_children.begin(), parent_children.end(), task), parent_children.end());
+        }
 
-        // Remove the vertex
-        boost::remove_vertex(this->task_map[task], this->dag);
+        // Move the last vertex in place of the removed vertex
+        vertex_t last_vertex = this->tasks.size() - 1;
+        if (vertex != last_vertex) {
+            this->tasks[vertex] = this->tasks[last_vertex];
+            this->children[vertex] = std::move(this->children[last_vertex]);
+            this->parents[vertex] = std::move(this->parents[last_vertex]);
+            this->tasks[vertex]->dag_index = vertex;
+        }
+        this->tasks.pop_back();
+        this->children.pop_back();
+        this->parents.pop_back();
+        task->dag_index = -1;
     }
 
 
@@ -63,34 +75,31 @@ namespace wrench {
  */
     void wrench::DagOfTasks::addEdge( wrench::WorkflowTask *src,  wrench::WorkflowTask *dst) {
         // Check that vertices exist
-        if (this->task_map[src] >= this->task_list.size()) {
-            throw std::runtime_error(
-                    "wrench::DagOfTasks::removeVertex(): Trying to add an edge from a non-existing vertex");
-        }
-        if (this->task_map[dst] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::removeVertex(): Trying to add an edge to a non-existing vertex");
-        }
+        auto src_vertex = this->getVertex(src, "wrench::DagOfTasks::addEdge(): Trying to add an edge from a non-existing vertex");
+        auto dst_vertex = this->getVertex(dst, "wrench::DagOfTasks::addEdge(): Trying to add an edge to a non-existing vertex");
+        this->thaw();
 
         // Add the edge
-        boost::add_edge(this->task_map[src], this->task_map[dst], this->dag);
+        this->children[src_vertex].push_back(dst);
+        this->parents[dst_vertex].push_back(src);
     }
 
 /**
- * @brief Remove an edge between two task vertices
+ * @brief Remove an edge between two task vertices (and all its parallel edges, if any)
  * @param src: the source task
  * @param dst: the destination task
  */
     void wrench::DagOfTasks::removeEdge( wrench::WorkflowTask *src,  wrench::WorkflowTask *dst) {
         // Check that vertices exist
-        if (this->task_map[src] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::removeEdge(): Trying add an edge from a non-existing vertex");
-        }
-        if (this->task_map[dst] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::removeEdge(): Trying add an edge to a non-existing vertex");
-        }
+        auto src_vertex = this->getVertex(src, "wrench::DagOfTasks::removeEdge(): Trying to remove an edge from a non-existing vertex");
+        auto dst_vertex = this->getVertex(dst, "wrench::DagOfTasks::removeEdge(): Trying to remove an edge to a non-existing vertex");
+        this->thaw();
 
         // Remove the edge
-        boost::remove_edge(this->task_map[src], this->task_map[dst], this->dag);
+        auto &src_children = this->children[src_vertex];
+        src_children.erase(std::remove(src_children.begin(), src_children.end(), dst), src_children.end());
+        auto &dst_parents = this->parents[dst_vertex];
+        dst_parents.erase(std::remove(dst_parents.begin(), dst_parents.end(), src), dst_parents.end());
     }
 
 /**
@@ -100,34 +109,149 @@ namespace wrench {
  * @return true if there is a path between the tasks
  */
     bool wrench::DagOfTasks::doesPathExist(const wrench::WorkflowTask *src,  const wrench::WorkflowTask *dst) {
-        // Check that vertices exist
-        if (this->task_map[src] >= this->task_list.size()) {
-            throw std::runtime_error(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path from a non-existing vertex");
+        // Find the vertices
+        auto src_vertex = this->getVertex(src, "wrench::DagOfTasks::doesPathExist(): Trying to find a path from a non-existing vertex");
+        auto dst_vertex = this->getVertex(dst, "wrench::DagOfTasks::doesPathExist(): Trying to find a path to a non-existing vertex");
+
+        if (src_vertex == dst_vertex) {
+            return true;
         }
-        if (this->task_map[dst] >= this->task_list.size()) {
-            throw std::runtime_error(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path to a non-existing vertex");
+
+        return this->searchPath(src_vertex, dst_vertex, false, nullptr);
+    }
+
+/**
+ * @brief Depth-first search for a path between two vertices, which stops as soon as the destination is found
+ * @param src_vertex: the source vertex
+ * @param dst_vertex: the destination vertex (different from the source vertex)
+ * @param skip_direct_edge: if true, only look for paths that do not consist of a single edge
+ * @param topological_positions: if not nullptr, the position of each vertex in a topological order, which
+ *        is used to prune vertices that come after the destination vertex (as they cannot reach it)
+ * @return true if there is a path between the vertices
+ */
+    bool wrench::DagOfTasks::searchPath(vertex_t src_vertex, vertex_t dst_vertex, bool skip_direct_edge,
+                                        const std::vector<unsigned long> *topological_positions) {
+
+        auto num_vertices = this->tasks.size();
+        if (this->search_marks.size() < num_vertices) {
+            this->search_marks.resize(num_vertices, 0);
+        }
+        if (++this->search_generation == 0) {
+            // The generation counter wrapped around: reset all marks
+            std::fill(this->search_marks.begin(), this->search_marks.end(), 0);
+            this->search_generation = 1;
         }
-        // Find the vertices
-        auto src_vertex = this->task_map[src];
-        auto dst_vertex = this->task_map[dst];
 
-        auto indexmap = boost::get(boost::vertex_index, dag);
-        auto colormap = boost::make_vector_property_map<boost::default_color_type>(indexmap);
+        this->search_stack.clear();
+        this->search_marks[src_vertex] = this->search_generation;
+        this->search_stack.push_back(src_vertex);
 
-        using vertex_descriptor = boost::graph_traits<DAG>::vertex_descriptor;
-        boost::queue<vertex_descriptor> Q;
-        custom_bfs_visitor vis(dst);
+        while (not this->search_stack.empty()) {
+            vertex_t vertex = this->search_stack.back();
+            this->search_stack.pop_back();
 
-        try {
-            boost::breadth_first_visit(dag, src_vertex, Q, vis, colormap);
-        } catch (std::runtime_error &e) {
-            return true;
+            for (auto const &child : this->childrenOf(vertex)) {
+                vertex_t next = child->dag_index;
+                if (next == dst_vertex) {
+                    if (skip_direct_edge and (vertex == src_vertex)) {
+                        continue;
+                    }
+                    return true;
+                }
+                if (this->search_marks[next] == this->search_generation) {
+                    continue;
+                }
+                this->search_marks[next] = this->search_generation;
+                if ((topological_positions != nullptr) and
+                    ((*topological_positions)[next] > (*topological_positions)[dst_vertex])) {
+                    continue;
+                }
+                this->search_stack.push_back(next);
+            }
         }
         return false;
     }
 
+/**
+ * @brief Compute a topological order of the vertices (Kahn's algorithm)
+ * @return the vertices, in topological order
+ */
+    std::vector<vertex_t> wrench::DagOfTasks::getTopologicalVertexOrder() {
+        auto num_vertices = this->tasks.size();
+
+        std::vector<unsigned long> num_remaining_parents(num_vertices, 0);
+        std::vector<vertex_t> order;
+        order.reserve(num_vertices);
+        for (vertex_t vertex = 0; vertex < num_vertices; vertex++) {
+            num_remaining_parents[vertex] = this->parentsOf(vertex).size();
+            if (num_remaining_parents[vertex] == 0) {
+                order.push_back(vertex);
+            }
+        }
+
+        for (size_t i = 0; i < order.size(); i++) {
+            for (auto const &child : this->childrenOf(order[i])) {
+                if (--num_remaining_parents[child->dag_index] == 0) {
+                    order.push_back(child->dag_index);
+                }
+            }
+        }
+
+        if (order.size() != num_vertices) {
+            throw std::runtime_error("wrench::DagOfTasks::getTopologicalVertexOrder(): The graph has a cycle");
+        }
+        return order;
+    }
+
+/**
+ * @brief Method to get all tasks in a topological order (i.e., each task comes after its parents)
+ * @return the tasks, in topological order
+ */
+    std::vector<WorkflowTask *> wrench::DagOfTasks::getTopologicalOrder() {
+        std::vector<WorkflowTask *> ordered_tasks;
+        auto order = this->getTopologicalVertexOrder();
+        ordered_tasks.reserve(order.size());
+        for (auto const &vertex : order) {
+            ordered_tasks.push_back(this->tasks[vertex]);
+        }
+        return ordered_tasks;
+    }
+
+/**
+ * @brief Method to remove, among a set of edges, those that are redundant, i.e., that
+ *        connect two vertices between which there is another path. This is done in a single pass
+ *        over the edges, with searches pruned using a topological order of the vertices.
+ * @param edges: the (source task, destination task) edges that may be removed
+ */
+    void wrench::DagOfTasks::removeRedundantEdges(const std::vector<std::pair<WorkflowTask *, WorkflowTask *>> &edges) {
+        if (edges.empty()) {
+            return;
+        }
+        this->thaw();
+
+        auto order = this->getTopologicalVertexOrder();
+        std::vector<unsigned long> topological_positions(order.size());
+        for (unsigned long position = 0; position < order.size(); position++) {
+            topological_positions[order[position]] = position;
+        }
+
+        for (auto const &edge : edges) {
+            auto src_vertex = edge.first->dag_index;
+            auto dst_vertex = edge.second->dag_index;
+            auto &src_children = this->children[src_vertex];
+            auto child = std::find(src_children.begin(), src_children.end(), edge.second);
+            if (child == src_children.end()) {
+                continue;
+            }
+            if (this->searchPath(src_vertex, dst_vertex, true, &topological_positions)) {
+                // Remove a single occurrence of the edge
+                src_children.erase(child);
+                auto &dst_parents = this->parents[dst_vertex];
+                dst_parents.erase(std::find(dst_parents.begin(), dst_parents.end(), edge.first));
+            }
+        }
+    }
+
     /**
  * @brief Method to check whether an edge exists between to task vertices
  * @param src: the source task
@@ -135,20 +259,18 @@ namespace wrench {
  * @return true if there is a path between the tasks
  */
     bool wrench::DagOfTasks::doesEdgeExist(const wrench::WorkflowTask *src,  const wrench::WorkflowTask *dst) {
-        // Check that vertices exist
-        if (this->task_map[src] >= this->task_list.size()) {
-            throw std::runtime_error(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path from a non-existing vertex");
-        }
-        if (this->task_map[dst] >= this->task_list.size()) {
-            throw std::runtime_error(
-                    "wrench::DagOfTasks::doesPathExist(): Trying to find a path to a non-existing vertex");
-        }
         // Find the vertices
-        auto src_vertex = this->task_map[src];
-        auto dst_vertex = this->task_map[dst];
+        auto src_vertex = this->getVertex(src, "wrench::DagOfTasks::doesEdgeExist(): Trying to find an edge from a non-existing vertex");
+        auto dst_vertex = this->getVertex(dst, "wrench::DagOfTasks::doesEdgeExist(): Trying to find an edge to a non-existing vertex");
 
-        return boost::edge(src_vertex,dst_vertex,this->dag).second;
+        // Look in the shorter of the two adjacency lists
+        auto src_children = this->childrenOf(src_vertex);
+        auto dst_parents = this->parentsOf(dst_vertex);
+        if (src_children.size() <= dst_parents.size()) {
+            return std::find(src_children.begin(), src_children.end(), dst) != src_children.end();
+        } else {
+            return std::find(dst_parents.begin(), dst_parents.end(), src) != dst_parents.end();
+        }
     }
 
 /**
@@ -157,17 +279,8 @@ namespace wrench {
  * @return a number children
  */
     long wrench::DagOfTasks::getNumberOfChildren(const WorkflowTask *task) {
-        // Find the vertex
-        if (this->task_map[task] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::getNumberOfChildren(): Non-existing vertex");
-        }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
-        long count = 0;
-        for (boost::tie(eo, edge_end) = boost::out_edges(vertex, dag); eo != edge_end; ++eo) {
-            count++;
-        }
-        return count;
+        auto vertex = this->getVertex(task, "wrench::DagOfTasks::getNumberOfChildren(): Non-existing vertex");
+        return (long) this->childrenOf(vertex).size();
     }
 
 /**
@@ -176,18 +289,17 @@ namespace wrench {
  * @return the children
  */
     std::vector<WorkflowTask *> wrench::DagOfTasks::getChildren(const WorkflowTask *task) {
-        // Find the vertex
-        if (this->task_map[task] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::getChildren(): Non-existing vertex");
-        }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::out_edge_iterator eo, edge_end;
-        std::vector<WorkflowTask *> children;
-        for (boost::tie(eo, edge_end) = boost::out_edges(vertex, dag); eo != edge_end; ++eo) {
-            // Discard the const qualifier
-            children.push_back((WorkflowTask *)(dag[target(*eo, dag)].task));
-        }
-        return children;
+        return this->getChildrenView(task);
+    }
+
+/**
+ * @brief Method to get the children of a task vertex, without copying them
+ * @param task: the task
+ * @return a view of the children (valid until the DAG is next modified)
+ */
+    WorkflowTaskView wrench::DagOfTasks::getChildrenView(const WorkflowTask *task) {
+        auto vertex = this->getVertex(task, "wrench::DagOfTasks::getChildren(): Non-existing vertex");
+        return this->childrenOf(vertex);
     }
 
 /**
@@ -196,17 +308,8 @@ namespace wrench {
  * @return a number parents
  */
     long wrench::DagOfTasks::getNumberOfParents(const WorkflowTask *task) {
-        // Find the vertex
-        if (this->task_map[task] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::getNumberOfParents(): Non-existing vertex");
-        }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
-        long count = 0;
-        for (boost::tie(ei, edge_end) = boost::in_edges(vertex, dag); ei != edge_end; ++ei) {
-            count++;
-        }
-        return count;
+        auto vertex = this->getVertex(task, "wrench::DagOfTasks::getNumberOfParents(): Non-existing vertex");
+        return (long) this->parentsOf(vertex).size();
     }
 
     /**
@@ -215,18 +318,113 @@ namespace wrench {
      * @return the parents
      */
     std::vector< WorkflowTask *> wrench::DagOfTasks::getParents(const WorkflowTask *task) {
-        // Find the vertex
-        if (this->task_map[task] >= this->task_list.size()) {
-            throw std::runtime_error("wrench::DagOfTasks::getParents(): Non-existing vertex");
+        return this->getParentsView(task);
+    }
+
+/**
+ * @brief Method to get the parents of a task vertex, without copying them
+ * @param task: the task
+ * @return a view of the parents (valid until the DAG is next modified)
+ */
+    WorkflowTaskView wrench::DagOfTasks::getParentsView(const WorkflowTask *task) {
+        auto vertex = this->getVertex(task, "wrench::DagOfTasks::getParents(): Non-existing vertex");
+        return this->parentsOf(vertex);
+    }
+
+/**
+ * @brief Method to compact the DAG's edges into a CSR representation, which is more
+ *        cache-friendly for traversals. The DAG remains modifiable (the next modification
+ *        reverts to the non-compact representation).
+ */
+    void wrench::DagOfTasks::freeze() {
+        if (this->frozen) {
+            return;
+        }
+
+        auto num_vertices = this->tasks.size();
+        auto compact = [num_vertices](std::vector<std::vector<WorkflowTask *>> &lists,
+                                      std::vector<size_t> &offsets,
+                                      std::vector<WorkflowTask *> &csr) {
+            offsets.resize(num_vertices + 1);
+            offsets[0] = 0;
+            for (vertex_t vertex = 0; vertex < num_vertices; vertex++) {
+                offsets[vertex + 1] = offsets[vertex] + lists[vertex].size();
+            }
+            csr.clear();
+            csr.reserve(offsets[num_vertices]);
+            for (auto &list : lists) {
+                csr.insert(csr.end(), list.begin(), list.end());
+                std::vector<WorkflowTask *>().swap(list);
+            }
+        };
+        compact(this->children, this->children_offsets, this->children_csr);
+        compact(this->parents, this->parents_offsets, this->parents_csr);
+        this->frozen = true;
+    }
+
+/**
+ * @brief Revert the DAG's edges to the modifiable (non-compact) representation, if needed
+ */
+    void wrench::DagOfTasks::thaw() {
+        if (not this->frozen) {
+            return;
         }
-        auto vertex = this->task_map[task];
-        boost::graph_traits<DAG>::in_edge_iterator ei, edge_end;
-        std::vector< WorkflowTask *> parents;
-        for (boost::tie(ei, edge_end) = boost::in_edges(vertex, dag); ei != edge_end; ++ei) {
-            // Discard the const qualifier
-            parents.push_back((WorkflowTask *)(dag[source(*ei, dag)].task));
+
+        auto num_vertices = this->tasks.size();
+        auto expand = [num_vertices](std::vector<std::vector<WorkflowTask *>> &lists,
+                                     std::vector<size_t> &offsets,
+                                     std::vector<WorkflowTask *> &csr) {
+            for (vertex_t vertex = 0; vertex < num_vertices; vertex++) {
+                lists[vertex].assign(csr.begin() + offsets[vertex], csr.begin() + offsets[vertex + 1]);
+            }
+            std::vector<size_t>().swap(offsets);
+            std::vector<WorkflowTask *>().swap(csr);
+        };
+        expand(this->children, this->children_offsets, this->children_csr);
+        expand(this->parents, this->parents_offsets, this->parents_csr);
+        this->frozen = false;
+    }
+
+/**
+ * @brief Get the vertex of a task
+ * @param task: the task
+ * @param error_message: the message of the exception thrown if the task is not in the DAG
+ * @return the vertex
+ */
+    vertex_t wrench::DagOfTasks::getVertex(const WorkflowTask *task, const std::string &error_message) {
+        auto vertex = task->dag_index;
+        if ((vertex >= this->tasks.size()) or (this->tasks[vertex] != task)) {
+            throw std::runtime_error(error_message);
+        }
+        return vertex;
+    }
+
+/**
+ * @brief Get the children of a vertex
+ * @param vertex: the vertex
+ * @return a view of the children
+ */
+    WorkflowTaskView wrench::DagOfTasks::childrenOf(vertex_t vertex) {
+        if (this->frozen) {
+            return WorkflowTaskView(this->children_csr.data() + this->children_offsets[vertex],
+                                    this->children_offsets[vertex + 1] - this->children_offsets[vertex]);
+        } else {
+            return WorkflowTaskView(this->children[vertex].data(), this->children[vertex].size());
+        }
+    }
+
+/**
+ * @brief Get the parents of a vertex
+ * @param vertex: the vertex
+ * @return a view of the parents
+ */
+    WorkflowTaskView wrench::DagOfTasks::parentsOf(vertex_t vertex) {
+        if (this->frozen) {
+            return WorkflowTaskView(this->parents_csr.data() + this->parents_offsets[vertex],
+                                    this->parents_offsets[vertex + 1] - this->parents_offsets[vertex]);
+        } else {
+            return WorkflowTaskView(this->parents[vertex].data(), this->parents[vertex].size());
         }
-        return parents;
     }
 
-}
\ No newline at end of file
+}
@@ -7,6 +7,7 @@
  * (at your option) any later version.
  */
 
+#include <algorithm>
 #include <pugixml.hpp>
 #include <nlohmann/json.hpp>
 #include <wrench/util/UnitParser.h>
@@ -66,6 +67,9 @@ namespace wrench {
 
         tasks[task->id] = std::unique_ptr<WorkflowTask>(task); // owner
 
+        // upon creation, a task is ready
+        this->ready_tasks[task->id] = task;
+
         return task;
     }
 
@@ -126,12 +130,35 @@ namespace wrench {
         // Remove the task from the DAG
         this->dag.removeVertex(task);
 
+        // Forget the dependencies of the task that were to be pruned by endBulkConstruction()
+        if (this->bulk_construction) {
+            this->bulk_prunable_dependencies.erase(
+                    std::remove_if(this->bulk_prunable_dependencies.begin(), this->bulk_prunable_dependencies.end(),
+                                   [task](const std::pair<WorkflowTask *, WorkflowTask *> &dependency) {
+                                       return (dependency.first == task) or (dependency.second == task);
+                                   }),
+                    this->bulk_prunable_dependencies.end());
+        }
+
+        // Remove the task from the ready/completed/cluster indices
+        this->ready_tasks.erase(task->id);
+        if (task->getState() == WorkflowTask::State::COMPLETED) {
+            this->num_completed_tasks--;
+        }
+        if (not task->getClusterID().empty()) {
+            auto cluster = this->clustered_tasks.find(task->getClusterID());
+            cluster->second.erase(task->id);
+            if (cluster->second.empty()) {
+                this->clustered_tasks.erase(cluster);
+            }
+        }
+
         // Remove the task from the master list
         tasks.erase(tasks.find(task->id));
 
-        // Brute-force update of the top-level of all the children of the removed task
-        for (auto const &child : children) {
-            child->updateTopLevel();
+        // The top-levels of the children of the removed task (and of their descendants) may have changed
+        if (not children.empty()) {
+            this->toplevels_are_up_to_date = false;
         }
 
     }
@@ -168,12 +195,28 @@ namespace wrench {
             throw std::invalid_argument("Workflow::addControlDependency(): Invalid arguments");
         }
 
+        if (this->bulk_construction) {
+            // Redundant dependencies are pruned all at once by endBulkConstruction()
+            if (redundant_dependencies || not this->dag.doesEdgeExist(src, dst)) {
+                this->dag.addEdge(src, dst);
+                this->toplevels_are_up_to_date = false;
+                if (not redundant_dependencies) {
+                    this->bulk_prunable_dependencies.emplace_back(src, dst);
+                }
+                if (src->getState() != WorkflowTask::State::COMPLETED) {
+                    dst->setInternalState(WorkflowTask::InternalState::TASK_NOT_READY);
+                    dst->setState(WorkflowTask::State::NOT_READY);
+                }
+            }
+            return;
+        }
+
         if (redundant_dependencies || not this->dag.doesPathExist(src, dst)) {
 
             WRENCH_DEBUG("Adding control dependency %s-->%s", src->getID().c_str(), dst->getID().c_str());
             this->dag.addEdge(src, dst);
 
-            dst->updateTopLevel();
+            this->toplevels_are_up_to_date = false;
 
             if (src->getState() != WorkflowTask::State::COMPLETED) {
                 dst->setInternalState(WorkflowTask::InternalState::TASK_NOT_READY);
@@ -182,6 +225,50 @@ namespace wrench {
         }
     }
 
+    /**
+     * @brief Enter bulk construction mode, in which control dependencies are added without
+     *        any path check, until endBulkConstruction() is called. This is much faster than
+     *        adding dependencies one by one when building large workflows.
+     */
+    void Workflow::beginBulkConstruction() {
+        this->bulk_construction = true;
+    }
+
+    /**
+     * @brief Exit bulk construction mode: all dependencies added in bulk construction mode
+     *        without redundant_dependencies are removed if they are implied by other dependencies
+     *        (in a single pass, regardless of the order in which dependencies were added), and the
+     *        DAG is compacted
+     */
+    void Workflow::endBulkConstruction() {
+        if (not this->bulk_construction) {
+            return;
+        }
+        this->bulk_construction = false;
+
+        this->dag.removeRedundantEdges(this->bulk_prunable_dependencies);
+        this->bulk_prunable_dependencies.clear();
+        this->bulk_prunable_dependencies.shrink_to_fit();
+
+        // The workflow structure is likely final: compact the DAG for faster traversals
+        this->dag.freeze();
+    }
+
+    /**
+     * @brief Recompute the top-levels of all tasks, in a single sweep over the tasks
+     *        in topological order (so that each task is processed after its parents)
+     */
+    void Workflow::updateTopLevels() {
+        for (auto const &task : this->dag.getTopologicalOrder()) {
+            unsigned long toplevel = 0;
+            for (auto const &parent : this->dag.getParentsView(task)) {
+                toplevel = std::max<unsigned long>(toplevel, 1 + parent->toplevel);
+            }
+            task->toplevel = toplevel;
+        }
+        this->toplevels_are_up_to_date = true;
+    }
+
     /**
      * @brief Remove a control dependency between tasks  (does nothing if none)
      * @param src: the source task
@@ -203,12 +290,20 @@ namespace wrench {
         if (this->dag.doesEdgeExist(src, dst)) {
             this->dag.removeEdge(src, dst);
 
-            dst->updateTopLevel();
+            this->toplevels_are_up_to_date = false;
+
+            /* Forget the dependency if it was to be pruned by endBulkConstruction() */
+            if (this->bulk_construction) {
+                this->bulk_prunable_dependencies.erase(
+                        std::remove(this->bulk_prunable_dependencies.begin(), this->bulk_prunable_dependencies.end(),
+                                    std::make_pair(src, dst)),
+                        this->bulk_prunable_dependencies.end());
+            }
 
             /* Update state */
             if ((dst->getState() == WorkflowTask::State::NOT_READY) and (dst->getInternalState() == WorkflowTask::InternalState::TASK_NOT_READY)) {
                 bool ready = true;
-                for (auto const &p :  dst->getParents()) {
+                for (auto const &p : this->dag.getParentsView(dst)) {
                     if (p->getState() != WorkflowTask::State::COMPLETED) {
                         ready = false;
                         break;
@@ -316,15 +411,41 @@ namespace wrench {
     std::vector<WorkflowTask *> Workflow::getReadyTasks() {
 
         std::vector<WorkflowTask *> tasks_list;
+        tasks_list.reserve(this->ready_tasks.size());
 
-        for (auto &it : this->tasks) {
-            WorkflowTask *task = it.second.get();
+        for (auto const &it : this->ready_tasks) {
+            tasks_list.push_back(it.second);
+        }
+        return tasks_list;
+    }
 
-            if (task->getState() == WorkflowTask::State::READY) {
-                tasks_list.push_back(task);
+    /**
+     * @brief Add a task to a map of clusters composed of ready tasks (tasks must be added in
+     *        increasing ID order)
+     *
+     * @param task_map: map of workflow cluster tasks
+     * @param task: a task
+     */
+    void Workflow::addToReadyClusters(std::map<std::string, std::vector<WorkflowTask *>> &task_map,
+                                      WorkflowTask *task) {
+        if (task->getState() == WorkflowTask::State::READY) {
+
+            if (task->getClusterID().empty()) {
+                task_map[task->getID()] = {task};
+
+            } else {
+                if (task_map.find(task->getClusterID()) == task_map.end()) {
+                    task_map[task->getClusterID()] = {task};
+                } else {
+                    // add to clustered task
+                    task_map[task->getClusterID()].push_back(task);
+                }
+            }
+        } else {
+            if (task_map.find(task->getClusterID()) != task_map.end()) {
+                task_map[task->getClusterID()].push_back(task);
             }
         }
-        return tasks_list;
     }
 
     /**
@@ -332,32 +453,34 @@ namespace wrench {
      *
      * @return map of workflow cluster tasks
      */
-    // TODO: Implement this more efficiently
     std::map<std::string, std::vector<WorkflowTask *>> Workflow::getReadyClusters() {
 
         std::map<std::string, std::vector<WorkflowTask *>> task_map;
 
-        for (auto &it : this->tasks) {
-            WorkflowTask *task = it.second.get();
-
-            if (task->getState() == WorkflowTask::State::READY) {
-
-                if (task->getClusterID().empty()) {
-                    task_map[task->getID()] = {task};
-
-                } else {
-                    if (task_map.find(task->getClusterID()) == task_map.end()) {
-                        task_map[task->getClusterID()] = {task};
-                    } else {
-                        // add to clustered task
-                        task_map[task->getClusterID()].push_back(task);
-                    }
-                }
-            } else {
-                if (task_map.find(task->getClusterID()) != task_map.end()) {
-                    task_map[task->getClusterID()].push_back(task);
+        // Only ready tasks, and tasks in the same cluster as a ready task (or whose
+        // cluster ID is a ready task's ID), can appear in the map. These candidates
+        // are processed in ID order, as a full scan of all tasks would.
+        std::map<std::string, WorkflowTask *> candidates = this->ready_tasks;
+        for (auto const &it : this->ready_tasks) {
+            WorkflowTask *task = it.second;
+            std::string key = task->getClusterID().empty() ? task->getID() : task->getClusterID();
+
+            if (key.empty()) {
+                // All tasks with no cluster ID would be candidates: do a full scan
+                for (auto const &t : this->tasks) {
+                    addToReadyClusters(task_map, t.second.get());
                 }
+                return task_map;
             }
+
+            auto cluster = this->clustered_tasks.find(key);
+            if (cluster != this->clustered_tasks.end()) {
+                candidates.insert(cluster->second.begin(), cluster->second.end());
+            }
+        }
+
+        for (auto const &it : candidates) {
+            addToReadyClusters(task_map, it.second);
         }
         return task_map;
     }
@@ -368,13 +491,51 @@ namespace wrench {
      * @return true or false
      */
     bool Workflow::isDone() {
-        for (auto &it : this->tasks) {
-            WorkflowTask *task = it.second.get();
-            if (task->getState() != WorkflowTask::State::COMPLETED) {
-                return false;
+        return this->num_completed_tasks == this->tasks.size();
+    }
+
+    /**
+     * @brief Update the ready task and completed task indices after a task's visible state has changed
+     *
+     * @param task: the task
+     * @param previous_state: the task's previous visible state
+     */
+    void Workflow::updateTaskState(WorkflowTask *task, WorkflowTask::State previous_state) {
+        WorkflowTask::State state = task->getState();
+        if (state == previous_state) {
+            return;
+        }
+
+        if (previous_state == WorkflowTask::State::READY) {
+            this->ready_tasks.erase(task->getID());
+        } else if (state == WorkflowTask::State::READY) {
+            this->ready_tasks[task->getID()] = task;
+        }
+
+        if (previous_state == WorkflowTask::State::COMPLETED) {
+            this->num_completed_tasks--;
+        } else if (state == WorkflowTask::State::COMPLETED) {
+            this->num_completed_tasks++;
+        }
+    }
+
+    /**
+     * @brief Update the cluster index after a task's cluster ID has changed
+     *
+     * @param task: the task
+     * @param previous_cluster_id: the task's previous cluster ID
+     */
+    void Workflow::updateTaskClusterID(WorkflowTask *task, const std::string &previous_cluster_id) {
+        if (not previous_cluster_id.empty()) {
+            auto cluster = this->clustered_tasks.find(previous_cluster_id);
+            cluster->second.erase(task->getID());
+            if (cluster->second.empty()) {
+                this->clustered_tasks.erase(cluster);
             }
         }
-        return true;
+        if (not task->getClusterID().empty()) {
+            this->clustered_tasks[task->getClusterID()][task->getID()] = task;
+        }
     }
 
     /**
@@ -443,6 +604,20 @@ namespace wrench {
         return this->dag.getChildren(task);
     }
 
+    /**
+     * @brief Get the children of a task, without copying them
+     *
+     * @param task: a workflow task
+     *
+     * @return a view of the children, which is valid until tasks or dependencies are next added/removed
+     */
+    WorkflowTaskView Workflow::getTaskChildrenView(const WorkflowTask *task) {
+        if (task == nullptr) {
+            throw std::invalid_argument("Workflow::getTaskChildrenView(): Invalid arguments");
+        }
+        return this->dag.getChildrenView(task);
+    }
+
     /**
      * @brief Get the number of children for a task
      *
@@ -471,6 +646,20 @@ namespace wrench {
         return this->dag.getParents(task);
     }
 
+    /**
+     * @brief Get the parents of a task, without copying them
+     *
+     * @param task: a workflow task
+     *
+     * @return a view of the parents, which is valid until tasks or dependencies are next added/removed
+     */
+    WorkflowTaskView Workflow::getTaskParentsView(const WorkflowTask *task) {
+        if (task == nullptr) {
+            throw std::invalid_argument("Workflow::getTaskParentsView(): Invalid arguments");
+        }
+        return this->dag.getParentsView(task);
+    }
+
     /**
      * @brief Get the number of parents for a task
      *
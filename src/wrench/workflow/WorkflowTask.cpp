@@ -328,7 +328,11 @@ namespace wrench {
                                      stateToString(state) + " when its internal " +
                                      "state is " + stateToString(this->internal_state));
         }
+        WorkflowTask::State previous_state = this->visible_state;
         this->visible_state = state;
+        if (this->workflow != nullptr) {
+            this->workflow->updateTaskState(this, previous_state);
+        }
     }
 
     /**
@@ -371,7 +375,11 @@ namespace wrench {
      * @param id: cluster id the task belongs to
      */
     void WorkflowTask::setClusterID(std::string id) {
+        std::string previous_cluster_id = this->cluster_id;
         this->cluster_id = id;
+        if (this->workflow != nullptr) {
+            this->workflow->updateTaskClusterID(this, previous_cluster_id);
+        }
     }
 
     /**
@@ -711,25 +719,14 @@ namespace wrench {
     }
 
     /**
-     * @brief Update the task's top level (looking only at the parents, and updating children)
+     * @brief Update the task's top level. Top levels are computed lazily: this marks the top levels
+     *        of the whole workflow as out of date, and they are all recomputed (in a single sweep) the
+     *        first time one of them is needed
      * @return the task's updated top level
      */
     unsigned long WorkflowTask::updateTopLevel() {
-        std::vector<WorkflowTask *> parents = this->workflow->getTaskParents(this);
-        if (parents.empty()) {
-            this->toplevel = 0;
-        } else {
-            unsigned long max_toplevel = 0;
-            for (auto parent : parents) {
-                max_toplevel = (max_toplevel < parent->toplevel ? parent->toplevel : max_toplevel);
-            }
-            this->toplevel = 1 + max_toplevel;
-        }
-        std::vector<WorkflowTask *> children = this->workflow->getTaskChildren(this);
-        for (auto child : children) {
-            child->updateTopLevel();
-        }
-        return this->toplevel;
+        this->workflow->toplevels_are_up_to_date = false;
+        return this->getTopLevel();
     }
 
     /**
@@ -738,6 +735,9 @@ namespace wrench {
      * @return
      */
     unsigned long WorkflowTask::getTopLevel() const {
+        if (not this->workflow->toplevels_are_up_to_date) {
+            this->workflow->updateTopLevels();
+        }
         return this->toplevel;
     }
 
@@ -51,7 +51,7 @@ namespace wrench {
         // Check that this is a ready sub-graph
         for (auto t : tasks) {
             if (t->getState() != WorkflowTask::State::READY) {
-                std::vector<WorkflowTask *> parents = t->getWorkflow()->getTaskParents(t);
+                auto parents = t->getWorkflow()->getTaskParentsView(t);
                 for (auto parent : parents) {
                     if (parent->getState() != WorkflowTask::State::COMPLETED) {
                         if (std::find(tasks.begin(), tasks.end(), parent) == tasks.end()) {
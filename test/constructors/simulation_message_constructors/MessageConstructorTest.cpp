@@ -387,3 +387,26 @@ TEST_F(MessageConstructorTest, BatchComputeServiceMessages) {
 //  ASSERT_NO_THROW(new wrench::AlarmNotifyBatschedMessage("job_id", 666));
 }
 
+
+TEST_F(MessageConstructorTest, PooledAllocation) {
+
+    auto counts_before = wrench::SimulationMessage::getAllocationCounts();
+
+    // The memory of a deleted message is reused for the next message of the same size
+    auto msg = new wrench::StorageServiceFileContentChunkMessage(file, 100, false);
+    std::string name = msg->getName();
+    void *address = msg;
+    delete msg;
+    msg = new wrench::StorageServiceFileContentChunkMessage(file, 100, true);
+    ASSERT_EQ(address, (void *) msg);
+    delete msg;
+
+    auto counts_after = wrench::SimulationMessage::getAllocationCounts();
+    ASSERT_EQ(counts_before[name] + 2, counts_after[name]);
+
+    // The memory of a message that fails to construct is also reused
+    ASSERT_THROW(new wrench::StorageServiceFileContentChunkMessage(nullptr, 100, true), std::invalid_argument);
+    msg = new wrench::StorageServiceFileContentChunkMessage(file, 100, true);
+    ASSERT_EQ(address, (void *) msg);
+    delete msg;
+}
@@ -53,16 +53,16 @@ namespace wrench {
       tasks.push_back(t5);
       tasks.push_back(t6);
 
-      ASSERT_EQ(600, scheduler->getFlops(this->workflow, tasks));
+      ASSERT_EQ(600, scheduler->getFlops(this->workflow, WorkflowTaskView(tasks.data(), tasks.size())));
 
       tasks.erase(std::remove(tasks.begin(), tasks.end(), t1), tasks.end());
-      ASSERT_EQ(500, scheduler->getFlops(this->workflow, tasks));
+      ASSERT_EQ(500, scheduler->getFlops(this->workflow, WorkflowTaskView(tasks.data(), tasks.size())));
 
       tasks.erase(std::remove(tasks.begin(), tasks.end(), t2), tasks.end());
-      ASSERT_EQ(300, scheduler->getFlops(this->workflow, tasks));
+      ASSERT_EQ(300, scheduler->getFlops(this->workflow, WorkflowTaskView(tasks.data(), tasks.size())));
 
       tasks.erase(std::remove(tasks.begin(), tasks.end(), t4), tasks.end());
-      ASSERT_EQ(300, scheduler->getFlops(this->workflow, tasks));
+      ASSERT_EQ(300, scheduler->getFlops(this->workflow, WorkflowTaskView(tasks.data(), tasks.size())));
     }
 
     TEST_F(CriticalPathSchedulerTest, GetMaxParallelization) {
@@ -41,6 +41,7 @@ public:
     wrench::WorkflowTask *task8;
 
     std::shared_ptr<wrench::ComputeService> compute_service = nullptr;
+    std::shared_ptr<wrench::ComputeService> single_activity_compute_service = nullptr;
 
     void do_UnsupportedStandardJobs_test();
 
@@ -64,6 +65,12 @@ public:
 
     void do_ShutdownStorageServiceBeforeJobIsSubmitted_test();
 
+    void do_SingleActivityJobTermination_test();
+
+    void do_SingleActivityComputeServiceShutdown_test();
+
+    void createSingleActivitySimulationServices(wrench::Simulation *simulation);
+
 protected:
     BareMetalComputeServiceTestStandardJobs() {
 
@@ -1621,3 +1628,315 @@ void BareMetalComputeServiceTestStandardJobs::do_ShutdownStorageServiceBeforeJob
         free(argv[i]);
     free(argv);
 }
+
+
+/**********************************************************************/
+/**  SINGLE-ACTIVITY COMPUTATION TESTS                               **/
+/**  The same 2-core job runs on a compute service that uses compute **/
+/**  threads and on one that simulates computations as single        **/
+/**  activities, and both should behave identically                  **/
+/**********************************************************************/
+
+void BareMetalComputeServiceTestStandardJobs::createSingleActivitySimulationServices(wrench::Simulation *simulation) {
+
+    // Create A Storage Services
+    ASSERT_NO_THROW(storage_service = simulation->add(
+            new wrench::SimpleStorageService("DualCoreHost", {"/"})));
+
+    // Create a Compute Service that uses compute threads, on the 2 cores of DualCoreHost
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BareMetalComputeService("DualCoreHost",
+                                                {std::make_pair("DualCoreHost", std::make_tuple(wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM))},
+                                                "", {})));
+
+    // Create a Compute Service that simulates computations as single activities, on 2 cores of QuadCoreHost
+    ASSERT_NO_THROW(single_activity_compute_service = simulation->add(
+            new wrench::BareMetalComputeService("QuadCoreHost",
+                                                {std::make_pair("QuadCoreHost", std::make_tuple(2, wrench::ComputeService::ALL_RAM))},
+                                                "",
+                                                {{wrench::BareMetalComputeServiceProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY, "true"}})));
+}
+
+/**
+ * @brief Get the dates of the timestamps of a given type for a task
+ */
+template <class T> static std::vector<double> getTaskTimestampDates(wrench::Simulation *simulation, wrench::WorkflowTask *task) {
+    std::vector<double> dates;
+    for (auto const &timestamp : simulation->getOutput().getTrace<T>()) {
+        if (timestamp->getContent()->getTask() == task) {
+            dates.push_back(timestamp->getDate());
+        }
+    }
+    return dates;
+}
+
+class BareMetalComputeServiceSingleActivityJobTerminationTestWMS : public wrench::WMS {
+
+public:
+    BareMetalComputeServiceSingleActivityJobTerminationTestWMS(BareMetalComputeServiceTestStandardJobs *test,
+                                                               const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                                               const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                                               std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    BareMetalComputeServiceTestStandardJobs *test;
+
+    int main() {
+
+        // Create a job  manager
+        auto job_manager = this->createJobManager();
+
+        // One 200-flop 2-core task per compute service
+        std::vector<std::pair<wrench::WorkflowTask *, std::shared_ptr<wrench::ComputeService>>> runs = {
+                {this->getWorkflow()->addTask("task_compute_threads", 200.0, 2, 2, 0),
+                        this->test->compute_service},
+                {this->getWorkflow()->addTask("task_single_activity", 200.0, 2, 2, 0),
+                        this->test->single_activity_compute_service}};
+
+        // Submit both jobs, and terminate them in the middle of their computations
+        std::vector<std::shared_ptr<wrench::StandardJob>> jobs;
+        for (auto const &run : runs) {
+            jobs.push_back(job_manager->createStandardJob(run.first));
+            job_manager->submitJob(jobs.back(), run.second);
+        }
+
+        wrench::Simulation::sleep(50);
+
+        for (auto const &job : jobs) {
+            try {
+                job_manager->terminateJob(job);
+            } catch (std::exception &e) {
+                throw std::runtime_error("Unexpected exception while terminating job: " + std::string(e.what()));
+            }
+        }
+
+        for (unsigned long i = 0; i < runs.size(); i++) {
+            auto task = runs[i].first;
+            if (jobs[i]->getState() != wrench::StandardJob::TERMINATED) {
+                throw std::runtime_error("Terminated Standard Job is not in TERMINATED state");
+            }
+            if (task->getState() != wrench::WorkflowTask::READY) {
+                throw std::runtime_error("Task " + task->getID() + " in a TERMINATED job should be in the READY state");
+            }
+            if (task->getFailureCount() != 0) {
+                throw std::runtime_error("Task " + task->getID() + " should have no failure");
+            }
+            if (std::fabs(task->getTerminationDate() - 50) > EPSILON) {
+                throw std::runtime_error("Task " + task->getID() + " has an unexpected termination date (" +
+                                         std::to_string(task->getTerminationDate()) + ")");
+            }
+            auto termination_dates = getTaskTimestampDates<wrench::SimulationTimestampTaskTermination>(this->simulation, task);
+            if ((termination_dates.size() != 1) or (std::fabs(termination_dates[0] - 50) > EPSILON)) {
+                throw std::runtime_error("Task " + task->getID() + " should have one termination timestamp at time 50");
+            }
+            if (not getTaskTimestampDates<wrench::SimulationTimestampTaskFailure>(this->simulation, task).empty()) {
+                throw std::runtime_error("Task " + task->getID() + " should have no failure timestamp");
+            }
+            // All cores of the compute service should be idle again
+            for (auto const &idle_cores : runs[i].second->getPerHostNumIdleCores()) {
+                if (idle_cores.second != 2) {
+                    throw std::runtime_error("All cores of the compute service should be idle after the job termination");
+                }
+            }
+        }
+
+        // Resubmit both tasks: they run again from scratch
+        jobs.clear();
+        for (auto const &run : runs) {
+            jobs.push_back(job_manager->createStandardJob(run.first));
+            job_manager->submitJob(jobs.back(), run.second);
+        }
+
+        for (unsigned long i = 0; i < runs.size(); i++) {
+            auto event = this->getWorkflow()->waitForNextExecutionEvent();
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+        }
+
+        for (auto const &run : runs) {
+            auto task = run.first;
+            if (task->getState() != wrench::WorkflowTask::COMPLETED) {
+                throw std::runtime_error("Task " + task->getID() + " should be completed");
+            }
+            if (std::fabs(task->getEndDate() - task->getStartDate() - 100) > EPSILON) {
+                throw std::runtime_error("Task " + task->getID() + " has an unexpected execution time (" +
+                                         std::to_string(task->getEndDate() - task->getStartDate()) + ")");
+            }
+        }
+        if (std::fabs(runs[0].first->getEndDate() - runs[1].first->getEndDate()) > EPSILON) {
+            throw std::runtime_error("Both tasks should complete at the same date (" +
+                                     std::to_string(runs[0].first->getEndDate()) + " vs. " +
+                                     std::to_string(runs[1].first->getEndDate()) + ")");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BareMetalComputeServiceTestStandardJobs, SingleActivityJobTermination) {
+    DO_TEST_WITH_FORK(do_SingleActivityJobTermination_test);
+}
+
+void BareMetalComputeServiceTestStandardJobs::do_SingleActivityJobTermination_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create the storage and compute services
+    createSingleActivitySimulationServices(simulation);
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new BareMetalComputeServiceSingleActivityJobTerminationTestWMS(
+                    this, {compute_service, single_activity_compute_service}, {storage_service}, "DualCoreHost")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running a "run a single task" simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+class BareMetalComputeServiceSingleActivityComputeServiceShutdownTestWMS : public wrench::WMS {
+
+public:
+    BareMetalComputeServiceSingleActivityComputeServiceShutdownTestWMS(BareMetalComputeServiceTestStandardJobs *test,
+                                                                       const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                                                       const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                                                       std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    BareMetalComputeServiceTestStandardJobs *test;
+
+    int main() {
+
+        // Create a job  manager
+        auto job_manager = this->createJobManager();
+
+        // One 200-flop 2-core task per compute service
+        std::vector<std::pair<wrench::WorkflowTask *, std::shared_ptr<wrench::ComputeService>>> runs = {
+                {this->getWorkflow()->addTask("task_compute_threads", 200.0, 2, 2, 0),
+                        this->test->compute_service},
+                {this->getWorkflow()->addTask("task_single_activity", 200.0, 2, 2, 0),
+                        this->test->single_activity_compute_service}};
+
+        // Submit both jobs, and shutdown the compute services in the middle of the computations
+        std::map<std::shared_ptr<wrench::StandardJob>, wrench::WorkflowTask *> jobs;
+        for (auto const &run : runs) {
+            auto job = job_manager->createStandardJob(run.first);
+            job_manager->submitJob(job, run.second);
+            jobs[job] = run.first;
+        }
+
+        wrench::Simulation::sleep(50);
+
+        for (auto const &run : runs) {
+            run.second->stop();
+        }
+
+        // Both jobs should fail in the same way
+        for (unsigned long i = 0; i < runs.size(); i++) {
+            std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+            try {
+                event = this->getWorkflow()->waitForNextExecutionEvent();
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error("Error while getting and execution event: " + e.getCause()->toString());
+            }
+            auto real_event = std::dynamic_pointer_cast<wrench::StandardJobFailedEvent>(event);
+            if (not real_event) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+            auto cause = std::dynamic_pointer_cast<wrench::JobKilled>(real_event->failure_cause);
+            if (not cause) {
+                throw std::runtime_error("Got a job failure event, but an unexpected failure cause: " +
+                                         real_event->failure_cause->toString() + " (expected: JobKilled)");
+            }
+            if (jobs.find(std::dynamic_pointer_cast<wrench::StandardJob>(cause->getJob())) == jobs.end()) {
+                throw std::runtime_error("Got the expected failure cause, but it points to an unknown job");
+            }
+        }
+
+        for (auto const &run : runs) {
+            auto task = run.first;
+            if (task->getState() != wrench::WorkflowTask::READY) {
+                throw std::runtime_error("Task " + task->getID() + " in a failed job should be in the READY state");
+            }
+            if (task->getFailureCount() != 1) {
+                throw std::runtime_error("Task " + task->getID() + " should have failed once");
+            }
+            if (std::fabs(task->getFailureDate() - 50) > EPSILON) {
+                throw std::runtime_error("Task " + task->getID() + " has an unexpected failure date (" +
+                                         std::to_string(task->getFailureDate()) + ")");
+            }
+            auto failure_dates = getTaskTimestampDates<wrench::SimulationTimestampTaskFailure>(this->simulation, task);
+            if ((failure_dates.size() != 1) or (std::fabs(failure_dates[0] - 50) > EPSILON)) {
+                throw std::runtime_error("Task " + task->getID() + " should have one failure timestamp at time 50");
+            }
+            if (not getTaskTimestampDates<wrench::SimulationTimestampTaskCompletion>(this->simulation, task).empty()) {
+                throw std::runtime_error("Task " + task->getID() + " should have no completion timestamp");
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BareMetalComputeServiceTestStandardJobs, SingleActivityComputeServiceShutdown) {
+    DO_TEST_WITH_FORK(do_SingleActivityComputeServiceShutdown_test);
+}
+
+void BareMetalComputeServiceTestStandardJobs::do_SingleActivityComputeServiceShutdown_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Create the storage and compute services
+    createSingleActivitySimulationServices(simulation);
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new BareMetalComputeServiceSingleActivityComputeServiceShutdownTestWMS(
+                    this, {compute_service, single_activity_compute_service}, {storage_service}, "DualCoreHost")));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running a "run a single task" simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -0,0 +1,339 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <wrench-dev.h>
+#include <gtest/gtest.h>
+#include <wrench/services/compute/batch/BatchComputeService.h>
+
+#include "../../../include/TestWithFork.h"
+#include "../../../include/UniqueTmpPathPrefix.h"
+
+#define EPSILON 0.05
+
+WRENCH_LOG_CATEGORY(batch_service_easy_bf_test, "Log category for BatchServiceEASYBFTest");
+
+class BatchServiceEASY_BFTest : public ::testing::Test {
+
+public:
+    std::shared_ptr<wrench::ComputeService> compute_service = nullptr;
+
+    void do_SimpleEASY_BF_test();
+    void do_SimpleEASY_BFQueueWaitTimePrediction_test();
+
+protected:
+    BatchServiceEASY_BFTest() {
+
+        // Create the simplest workflow
+        workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+
+        // Create a four-host 10-core platform file
+        std::string xml = "<?xml version='1.0'?>"
+                          "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                          "<platform version=\"4.1\"> "
+                          "   <zone id=\"AS0\" routing=\"Full\"> "
+                          "       <host id=\"Host1\" speed=\"1f\" core=\"10\"/> "
+                          "       <host id=\"Host2\" speed=\"1f\" core=\"10\"/> "
+                          "       <host id=\"Host3\" speed=\"1f\" core=\"10\"/> "
+                          "       <host id=\"Host4\" speed=\"1f\" core=\"10\"/> "
+                          "       <link id=\"1\" bandwidth=\"50000GBps\" latency=\"0us\"/>"
+                          "       <route src=\"Host3\" dst=\"Host1\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"Host3\" dst=\"Host4\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"Host4\" dst=\"Host1\"> <link_ctn id=\"1\"/> </route>"
+                          "       <route src=\"Host1\" dst=\"Host2\"> <link_ctn id=\"1\"/> </route>"
+                          "   </zone> "
+                          "</platform>";
+        FILE *platform_file = fopen(platform_file_path.c_str(), "w");
+        fprintf(platform_file, "%s", xml.c_str());
+        fclose(platform_file);
+
+    }
+
+    std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    std::unique_ptr<wrench::Workflow> workflow;
+
+};
+
+/**
+ * @brief Submit 4 1-min jobs that cannot all run at once:
+ *   - job 0: 3 nodes, 10 min (starts right away)
+ *   - job 1: 4 nodes, 2 min (head of the queue, reservation at time 600)
+ *   - job 2: 1 node, 5 min (backfilled right away since it ends before time 600)
+ *   - job 3: 1 node, 20 min (cannot be backfilled as it would delay job 1)
+ */
+static void submitEASY_BFTestJobs(wrench::WMS *wms, std::shared_ptr<wrench::JobManager> job_manager,
+                                  std::shared_ptr<wrench::ComputeService> compute_service,
+                                  std::shared_ptr<wrench::StandardJob> *jobs) {
+
+    std::string num_nodes[4] = {"3", "4", "1", "1"};
+    std::string num_minutes[4] = {"10", "2", "5", "20"};
+
+    for (int i=0; i < 4; i++) {
+        auto task = wms->getWorkflow()->addTask("task" + std::to_string(i), 60, 1, 1, 0);
+        jobs[i] = job_manager->createStandardJob(task);
+    }
+
+    try {
+        for (int i=0; i < 4; i++) {
+            std::map<std::string, std::string> job_args;
+            job_args["-N"] = num_nodes[i];
+            job_args["-t"] = num_minutes[i];
+            job_args["-c"] = "10";
+            job_manager->submitJob(jobs[i], compute_service, job_args);
+        }
+    } catch (wrench::WorkflowExecutionException &e) {
+        throw std::runtime_error(
+                "Unexpected exception while submitting job"
+        );
+    }
+}
+
+/**********************************************************************/
+/**  SIMPLE EASY_BF TEST                                             **/
+/**********************************************************************/
+
+class SimpleEASY_BFTestWMS : public wrench::WMS {
+
+public:
+    SimpleEASY_BFTestWMS(BatchServiceEASY_BFTest *test,
+                         const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                         std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr, hostname,
+                        "test") {
+        this->test = test;
+    }
+
+private:
+
+    BatchServiceEASY_BFTest *test;
+
+    int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        std::shared_ptr<wrench::StandardJob> jobs[4];
+        submitEASY_BFTestJobs(this, job_manager, this->test->compute_service, jobs);
+
+        double expected_completion_times[4] = {
+                60,
+                120,
+                60,
+                180,
+        };
+
+        std::map<std::shared_ptr<wrench::StandardJob>, double> actual_completion_times;
+        for (int i=0; i < 4; i++) {
+            // Wait for a workflow execution event
+            std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+            try {
+                event = this->getWorkflow()->waitForNextExecutionEvent();
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error("Error while getting and execution event: " + e.getCause()->toString());
+            }
+            if (auto real_event = std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                actual_completion_times[real_event->standard_job] = wrench::Simulation::getCurrentSimulatedDate();
+            } else {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+        }
+
+        // Check
+        for (int i=0; i < 4; i++) {
+            double delta = std::abs(actual_completion_times[jobs[i]] - expected_completion_times[i]);
+            if (delta > EPSILON) {
+                throw std::runtime_error("Unexpected job completion time for job " + std::to_string(i) +
+                                         ": " +
+                                         std::to_string(actual_completion_times[jobs[i]]) +
+                                         "(expected: " +
+                                         std::to_string(expected_completion_times[i]) +
+                                         ")");
+            }
+        }
+
+        return 0;
+    }
+};
+
+#ifdef ENABLE_BATSCHED
+TEST_F(BatchServiceEASY_BFTest, DISABLED_SimpleEASY_BFTest)
+#else
+TEST_F(BatchServiceEASY_BFTest, SimpleEASY_BFTest)
+#endif
+{
+    DO_TEST_WITH_FORK(do_SimpleEASY_BF_test);
+}
+
+void BatchServiceEASY_BFTest::do_SimpleEASY_BF_test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "Host1";
+
+    // Create a Batch Service with an easy_bf scheduling algorithm
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {{wrench::BatchComputeServiceProperty::BATCH_SCHEDULING_ALGORITHM, "easy_bf"},
+                                             {wrench::BatchComputeServiceProperty::BATCH_RJMS_PADDING_DELAY,   "0"}})));
+
+    simulation->add(new wrench::FileRegistryService(hostname));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new SimpleEASY_BFTestWMS(
+                    this,  {compute_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+/**********************************************************************/
+/**  SIMPLE EASY_BF TEST WITH QUEUE PREDICTION                       **/
+/**********************************************************************/
+
+class SimpleEASY_BFQueueWaitTimePredictionWMS : public wrench::WMS {
+
+public:
+    SimpleEASY_BFQueueWaitTimePredictionWMS(BatchServiceEASY_BFTest *test,
+                                            const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                            std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, {}, {}, nullptr, hostname,
+                        "test") {
+        this->test = test;
+    }
+
+private:
+
+    BatchServiceEASY_BFTest *test;
+
+    int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        std::shared_ptr<wrench::StandardJob> jobs[4];
+        submitEASY_BFTestJobs(this, job_manager, this->test->compute_service, jobs);
+
+        // Sleep for 10 seconds
+        wrench::Simulation::sleep(10);
+
+        // Jobs 0 and 2 run on 4 nodes until time 300 and on 3 nodes until time 600, and
+        // queued jobs 1 and 3 are expected to run on 4 nodes in [600,720) and on 1 node in [720,1920)
+        std::set<std::tuple<std::string,unsigned long,unsigned long, double>> set_of_jobs = {
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job1",  1, 10, 100},   // 300
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job2",  1, 10, 1000},  // 720
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job3",  3, 10, 60},    // 720
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job4",  4, 10, 60},    // 1920
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job5",  5, 10, 60},    // -1
+                (std::tuple<std::string,unsigned long,unsigned long, double>){"job6",  1, 20, 60},    // -1
+        };
+
+        // Expectations
+        std::map<std::string, double> expectations;
+        expectations.insert(std::make_pair("job1", 300));
+        expectations.insert(std::make_pair("job2", 720));
+        expectations.insert(std::make_pair("job3", 720));
+        expectations.insert(std::make_pair("job4", 1920));
+        expectations.insert(std::make_pair("job5", -1));
+        expectations.insert(std::make_pair("job6", -1));
+
+        std::map<std::string,double> jobs_estimated_start_times =
+                (*(this->getAvailableComputeServices<wrench::BatchComputeService>().begin()))->getStartTimeEstimates(set_of_jobs);
+
+        for (auto job : set_of_jobs) {
+            std::string id = std::get<0>(job);
+            double estimated = jobs_estimated_start_times[id];
+            double expected = expectations[id];
+            if (std::abs(estimated - expected) > 1.0) {
+                throw std::runtime_error("invalid prediction for job '" + id + "': got " +
+                                         std::to_string(estimated) + " but expected is " + std::to_string(expected));
+            }
+        }
+
+        // Asking for estimates should not have changed the schedule
+        for (int i=0; i < 4; i++) {
+            auto event = this->getWorkflow()->waitForNextExecutionEvent();
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+        }
+        if (std::abs(wrench::Simulation::getCurrentSimulatedDate() - 180) > EPSILON) {
+            throw std::runtime_error("Unexpected completion time of the last job: " +
+                                     std::to_string(wrench::Simulation::getCurrentSimulatedDate()) + " (expected: 180)");
+        }
+
+        return 0;
+    }
+};
+
+#ifdef ENABLE_BATSCHED
+TEST_F(BatchServiceEASY_BFTest, DISABLED_SimpleEASY_BFQueueWaitTimePrediction)
+#else
+TEST_F(BatchServiceEASY_BFTest, SimpleEASY_BFQueueWaitTimePrediction)
+#endif
+{
+    DO_TEST_WITH_FORK(do_SimpleEASY_BFQueueWaitTimePrediction_test);
+}
+
+
+void BatchServiceEASY_BFTest::do_SimpleEASY_BFQueueWaitTimePrediction_test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "Host1";
+
+    // Create a Batch Service with an easy_bf scheduling algorithm
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {{wrench::BatchComputeServiceProperty::BATCH_SCHEDULING_ALGORITHM, "easy_bf"},
+                                             {wrench::BatchComputeServiceProperty::BATCH_RJMS_PADDING_DELAY,   "0"}})));
+
+    simulation->add(new wrench::FileRegistryService(hostname));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new SimpleEASY_BFQueueWaitTimePredictionWMS(
+                    this,  {compute_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
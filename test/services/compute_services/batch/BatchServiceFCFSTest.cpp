@@ -512,6 +512,13 @@ void BatchServiceFCFSTest::do_BrokenQueueWaitTimePrediction_test() {
     // Get a hostname
     std::string hostname = "Host1";
 
+    // Create a Batch Service with a bogus host selection algorithm
+    ASSERT_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {{wrench::BatchComputeServiceProperty::BATCH_SCHEDULING_ALGORITHM, "fcfs"},
+                                             {wrench::BatchComputeServiceProperty::HOST_SELECTION_ALGORITHM, "BOGUS"}})),
+                 std::invalid_argument);
+
     // Create a Batch Service with a fcfs scheduling algorithm
     ASSERT_NO_THROW(compute_service = simulation->add(
             new wrench::BatchComputeService(hostname, {"Host1", "Host2", "Host3", "Host4"}, "",
@@ -35,6 +35,7 @@ public:
     void do_BatchTraceFileReplayTest_test();
 
     void do_WorkloadTraceFileTestSWF_test();
+    void do_WorkloadTraceFileTestSWFAsReservations_test();
     void do_WorkloadTraceFileTestSWFBatchServiceShutdown_test();
     void do_WorkloadTraceFileRequestedTimesSWF_test();
     void do_WorkloadTraceFileDifferentTimeOriginSWF_test();
@@ -1850,3 +1851,150 @@ void BatchServiceTest::do_GetQueueState_test() {
         free(argv[i]);
     free(argv);
 }
+
+
+/**********************************************************************/
+/**  WORKLOAD TRACE FILE TEST SWF: JOBS REPLAYED AS RESERVATIONS     **/
+/**********************************************************************/
+
+class WorkloadTraceFileSWFAsReservationsTestWMS : public wrench::WMS {
+
+public:
+    WorkloadTraceFileSWFAsReservationsTestWMS(BatchServiceTest *test,
+                                              const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                              const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                              std::string hostname) :
+            wrench::WMS(nullptr, nullptr,  compute_services, storage_services, {}, nullptr,
+                        hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    BatchServiceTest *test;
+
+    int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        auto cs = *(this->getAvailableComputeServices<wrench::BatchComputeService>().begin());
+
+        wrench::Simulation::sleep(10);
+
+        // At this point, the 4-node background job should be running and the 2-node one should be pending
+        auto queue_state = cs->getQueue();
+        if (queue_state.size() != 2) {
+            throw std::runtime_error("Unexpected queue state (should have 2 entries - has " + std::to_string(queue_state.size()) + ")");
+        }
+        int num_started = 0;
+        for (auto const &j : queue_state) {
+            if (std::get<1>(j).find("background_job_") != 0) {
+                throw std::runtime_error("Unexpected job name in queue state: " + std::get<1>(j));
+            }
+            if (std::get<6>(j) >= 0) {
+                num_started++;
+            }
+        }
+        if (num_started != 1) {
+            throw std::runtime_error("Exactly one background job should be shown as having started");
+        }
+
+        // Create and submit a job that needs 2 nodes and 30 minutes, which should start when the
+        // 4-node background job releases its nodes at t=1 hour, alongside the 2-node background job
+        std::vector<wrench::WorkflowTask *> tasks;
+        for (size_t i = 0; i < 2; i++) {
+            double time_fudge = 1; // 1 second seems to make it all work!
+            double task_flops = 10 * (1 * (1800 - time_fudge));
+            int num_cores = 10;
+            double ram = 0.0;
+            tasks.push_back(this->getWorkflow()->addTask("test_job_1_task_" + std::to_string(i),
+                                                         task_flops,
+                                                         num_cores, num_cores, ram));
+        }
+        auto standard_job = job_manager->createStandardJob(tasks);
+
+        std::map<std::string, std::string> batch_job_args;
+        batch_job_args["-N"] = std::to_string(2); // Number of nodes/tasks
+        batch_job_args["-t"] = std::to_string(1800); // Time in minutes (at least 1 minute)
+        batch_job_args["-c"] = std::to_string(10); //number of cores per task
+
+        job_manager->submitJob(standard_job, cs, batch_job_args);
+
+        auto event = this->getWorkflow()->waitForNextExecutionEvent();
+        if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+            throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+        }
+
+        double completion_time = wrench::Simulation::getCurrentSimulatedDate();
+        double expected_completion_time = 3600 + 1800;
+        double delta = std::abs(expected_completion_time - completion_time);
+        double tolerance = 5;
+        if (delta > tolerance) {
+            throw std::runtime_error("Unexpected job completion time: " +
+                                     std::to_string(completion_time) + " (expected: " + std::to_string(expected_completion_time) + ")");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BatchServiceTest, WorkloadTraceFileSWFAsReservationsTest) {
+    DO_TEST_WITH_FORK(do_WorkloadTraceFileTestSWFAsReservations_test);
+}
+
+void BatchServiceTest::do_WorkloadTraceFileTestSWFAsReservations_test() {
+
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+//    argv[1] = strdup("--wrench-full-log");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "Host1";
+
+    std::string trace_file_path = UNIQUE_TMP_PATH_PREFIX + "swf_trace.swf";
+    FILE *trace_file;
+
+    // Create a trace file
+    trace_file = fopen(trace_file_path.c_str(), "w");
+    fprintf(trace_file, "1 0 -1 3600 -1 -1 -1 4 5600 -1\n");  // job that takes the whole machine
+    fprintf(trace_file, "2 1 -1 3600 -1 -1 -1 2 8666 -1\n");  // job that takes half the machine
+    fclose(trace_file);
+
+    // Create a Batch Service that replays the trace file as reservations
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BatchComputeService(hostname,
+                                            {"Host1", "Host2", "Host3", "Host4"}, "",
+                                            {
+                                                    {wrench::BatchComputeServiceProperty::SIMULATED_WORKLOAD_TRACE_FILE, trace_file_path},
+                                                    {wrench::BatchComputeServiceProperty::USE_REAL_RUNTIMES_AS_REQUESTED_RUNTIMES_IN_WORKLOAD_TRACE_FILE, "true"},
+                                                    {wrench::BatchComputeServiceProperty::SIMULATE_JOBS_IN_WORKLOAD_TRACE_FILE_AS_RESERVATIONS, "true"}
+                                            }
+            )));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(new WorkloadTraceFileSWFAsReservationsTestWMS(
+            this, {compute_service}, {}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(std::move(workflow.get())));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    // The background jobs should not have run any task
+    auto trace = simulation->getOutput().getTrace<wrench::SimulationTimestampTaskCompletion>();
+    ASSERT_EQ(2, trace.size());
+
+    delete simulation;
+
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -11,6 +11,7 @@
 #include <gtest/gtest.h>
 #include "../src/wrench/services/compute/batch/batch_schedulers/homegrown/conservative_bf/NodeAvailabilityTimeLine.h"
 #include "../src/wrench/services/compute/batch/batch_schedulers/homegrown/conservative_bf_core_level/CoreAvailabilityTimeLine.h"
+#include "../src/wrench/services/compute/batch/batch_schedulers/homegrown/AvailableCoresIndex.h"
 
 #include "../../../include/TestWithFork.h"
 #include "../../../include/UniqueTmpPathPrefix.h"
@@ -23,7 +24,9 @@ class BatchServiceAvailabilityTimeLineTest : public ::testing::Test {
 public:
 
     void do_NodeAvailabilityTimeLineTest_test();
+    void do_NodeAvailabilityTimeLineCompactionTest_test();
     void do_CoreAvailabilityTimeLineTest_test();
+    void do_AvailableCoresIndexTest_test();
 
 
 protected:
@@ -71,12 +74,130 @@ void BatchServiceAvailabilityTimeLineTest::do_NodeAvailabilityTimeLineTest_test(
     tl->print();
     tl->clear();
 
+    // 6 nodes used in [0,100) and 4 nodes used in [50,150)
+    auto bj4 = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj1, 4, 100, 6, 1, "who", 0, 0));
+    auto bj5 = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj1, 5, 100, 4, 1, "who", 0, 0));
+    tl->add(0, 100, bj4);
+    tl->add(50, 150, bj5);
+
+    ASSERT_EQ(0, tl->findEarliestStartTime(10, 4));
+    ASSERT_EQ(100, tl->findEarliestStartTime(10, 5));
+    ASSERT_EQ(100, tl->findEarliestStartTime(60, 1));
+    ASSERT_EQ(150, tl->findEarliestStartTime(10, 10));
+    ASSERT_EQ(UINT32_MAX, tl->findEarliestStartTime(10, 11));
+    ASSERT_EQ(std::set<std::shared_ptr<wrench::BatchJob>>({bj4}), tl->getJobsInFirstSlot());
+
+    // Removing a job frees up its whole reservation
+    tl->remove(bj4);
+    ASSERT_EQ(0, tl->findEarliestStartTime(10, 6));
+    ASSERT_EQ(0, tl->findEarliestStartTime(50, 6));
+    ASSERT_EQ(150, tl->findEarliestStartTime(60, 7));
+
+    // Moving the time origin forward
+    tl->setTimeOrigin(60);
+    ASSERT_EQ(std::set<std::shared_ptr<wrench::BatchJob>>({bj5}), tl->getJobsInFirstSlot());
+    ASSERT_EQ(60, tl->findEarliestStartTime(10, 6));
+    ASSERT_EQ(150, tl->findEarliestStartTime(10, 7));
+
+    // Re-adding a job replaces its previous reservation
+    tl->add(200, 300, bj5);
+    ASSERT_EQ(60, tl->findEarliestStartTime(10, 10));
+    ASSERT_EQ(300, tl->findEarliestStartTime(200, 10));
+
+    tl->clear();
+    delete tl;
+
     for (int i=0; i < argc; i++)
         free(argv[i]);
     free(argv);
 }
 
 
+/**********************************************************************/
+/**  NODE AVAILABILITY TIMELINE COMPACTION TEST                      **/
+/**********************************************************************/
+
+TEST_F(BatchServiceAvailabilityTimeLineTest, NodeAvailabilityTimeLineCompactionTest)
+{
+    DO_TEST_WITH_FORK(do_NodeAvailabilityTimeLineCompactionTest_test);
+}
+
+void BatchServiceAvailabilityTimeLineTest::do_NodeAvailabilityTimeLineCompactionTest_test() {
+
+    auto tl = new wrench::NodeAvailabilityTimeLine(10);
+
+    auto wj = std::shared_ptr<wrench::WorkflowJob>((wrench::WorkflowJob *)(1234), [](void *ptr){});
+
+    // Two running jobs (requested times are in minutes, dates in seconds)
+    auto bjA = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj, 1, 100, 6, 1, "who", 0, 0));
+    auto bjB = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj, 2, 50, 4, 1, "who", 0, 0));
+    tl->add(0, 6000, bjA);
+    tl->add(0, 3000, bjB);
+
+    // Four queued jobs, each inserted as early as possible
+    auto bjC = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj, 3, 50, 4, 1, "who", 0, 0));
+    auto bjD = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj, 4, 10, 10, 1, "who", 0, 0));
+    auto bjE = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj, 5, 20, 5, 1, "who", 0, 0));
+    auto bjF = std::shared_ptr<wrench::BatchJob>(new wrench::BatchJob(wj, 6, 30, 1, 1, "who", 0, 0));
+    std::vector<std::shared_ptr<wrench::BatchJob>> queue = {bjC, bjD, bjE, bjF};
+    std::map<std::shared_ptr<wrench::BatchJob>, u_int32_t> start_dates;
+    for (auto const &bj : queue) {
+        auto duration = (u_int32_t) bj->getRequestedTime();
+        auto est = tl->findEarliestStartTime(duration, bj->getRequestedNumNodes());
+        tl->add(est, est + duration, bj);
+        start_dates[bj] = est;
+    }
+    ASSERT_EQ(3000, start_dates[bjC]);
+    ASSERT_EQ(6000, start_dates[bjD]);
+    ASSERT_EQ(6600, start_dates[bjE]);
+    ASSERT_EQ(6600, start_dates[bjF]);
+
+    // Nothing was freed, so no reservation can move
+    for (auto const &bj : queue) {
+        ASSERT_FALSE(tl->canStartEarlier(bj));
+    }
+
+    // Job B completes early, freeing 4 nodes in [1200,3000)
+    tl->setTimeOrigin(1200);
+    tl->remove(bjB);
+
+    // Compact the schedule, re-inserting only the jobs that can start earlier
+    std::set<std::shared_ptr<wrench::BatchJob>> moved;
+    for (auto const &bj : queue) {
+        if (not tl->canStartEarlier(bj)) {
+            continue;
+        }
+        auto duration = (u_int32_t) bj->getRequestedTime();
+        tl->remove(bj);
+        auto est = tl->findEarliestStartTime(duration, bj->getRequestedNumNodes());
+        ASSERT_LT(est, start_dates[bj]);
+        tl->add(est, est + duration, bj);
+        start_dates[bj] = est;
+        moved.insert(bj);
+    }
+
+    // C moves into the freed nodes, and F into the gap C left behind, while D and E are left alone
+    ASSERT_EQ(std::set<std::shared_ptr<wrench::BatchJob>>({bjC, bjF}), moved);
+    ASSERT_EQ(1200, start_dates[bjC]);
+    ASSERT_EQ(6000, start_dates[bjD]);
+    ASSERT_EQ(6600, start_dates[bjE]);
+    ASSERT_EQ(4200, start_dates[bjF]);
+
+    // Re-inserting any job as early as possible would put it back where it is
+    for (auto const &bj : queue) {
+        ASSERT_FALSE(tl->canStartEarlier(bj));
+        auto duration = (u_int32_t) bj->getRequestedTime();
+        tl->remove(bj);
+        auto est = tl->findEarliestStartTime(duration, bj->getRequestedNumNodes());
+        ASSERT_EQ(start_dates[bj], est);
+        tl->add(est, est + duration, bj);
+    }
+
+    tl->clear();
+    delete tl;
+}
+
+
 /**********************************************************************/
 /**  CORE AVAILABILITY TIMELINE TEST                                 **/
 /**********************************************************************/
@@ -120,3 +241,47 @@ void BatchServiceAvailabilityTimeLineTest::do_CoreAvailabilityTimeLineTest_test(
         free(argv[i]);
     free(argv);
 }
+
+
+/**********************************************************************/
+/**  AVAILABLE CORES INDEX TEST                                      **/
+/**********************************************************************/
+
+TEST_F(BatchServiceAvailabilityTimeLineTest, AvailableCoresIndexTest)
+{
+    DO_TEST_WITH_FORK(do_AvailableCoresIndexTest_test);
+}
+
+void BatchServiceAvailabilityTimeLineTest::do_AvailableCoresIndexTest_test() {
+
+    auto index = new wrench::AvailableCoresIndex({"h3", "h1", "h2", "h4"}, 4);
+
+    ASSERT_THROW(index->setNumAvailableCores("bogus", 1), std::invalid_argument);
+    ASSERT_THROW(index->setNumAvailableCores("h1", 5), std::invalid_argument);
+
+    // FIRSTFIT goes by host name
+    ASSERT_EQ(std::vector<std::string>({"h1", "h2"}), index->findFirstFit(2, 2));
+    ASSERT_TRUE(index->findFirstFit(5, 1).empty());
+    ASSERT_TRUE(index->findFirstFit(1, 5).empty());
+
+    index->setNumAvailableCores("h1", 1);
+    index->setNumAvailableCores("h2", 3);
+    ASSERT_EQ(1, index->getNumAvailableCores("h1"));
+    ASSERT_EQ(std::vector<std::string>({"h2", "h3"}), index->findFirstFit(2, 2));
+
+    // BESTFIT goes by fewest left-over cores, then by host name
+    ASSERT_EQ(std::vector<std::string>({"h2", "h3"}), index->findBestFit(2, 2));
+    ASSERT_EQ(std::vector<std::string>({"h1"}), index->findBestFit(1, 1));
+    ASSERT_TRUE(index->findBestFit(4, 2).empty());
+
+    // ROUNDROBIN goes by host order, starting after the cursor
+    unsigned long cursor = 0;
+    ASSERT_EQ(std::vector<std::string>({"h2", "h4"}), index->findRoundRobin(2, 2, cursor));
+    ASSERT_EQ(3, cursor);
+    ASSERT_EQ(std::vector<std::string>({"h3", "h4"}), index->findRoundRobin(2, 4, cursor));
+    ASSERT_EQ(3, cursor);
+    ASSERT_TRUE(index->findRoundRobin(3, 4, cursor).empty());
+    ASSERT_EQ(3, cursor);
+
+    delete index;
+}
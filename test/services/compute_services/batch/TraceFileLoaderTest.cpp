@@ -0,0 +1,323 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+
+#include <wrench-dev.h>
+#include <wrench/util/TraceFileLoader.h>
+
+#include "../../../include/TestWithFork.h"
+#include "../../../include/UniqueTmpPathPrefix.h"
+
+#include <fstream>
+#include <sys/stat.h>
+
+#define NUM_LARGE_TRACE_JOBS 100000
+
+/**********************************************************************/
+/**                       TraceFileLoaderTest                        **/
+/**********************************************************************/
+
+class TraceFileLoaderTest : public ::testing::Test {
+
+public:
+    void do_LargeSWFWithInvalidJob_test(bool ignore_invalid_jobs);
+    void do_SWFDesiredSubmitTime_test();
+    void do_JobIds_test();
+
+protected:
+    TraceFileLoaderTest() {
+    }
+
+    // Initialize a simulation (for logging to work) and enable the trace file loader's warnings
+    void initSimulation() {
+        int argc = 1;
+        auto argv = (char **) calloc(argc, sizeof(char *));
+        argv[0] = strdup("unit_test");
+        simulation = std::unique_ptr<wrench::Simulation>(new wrench::Simulation());
+        simulation->init(&argc, argv);
+        for (int i = 0; i < argc; i++)
+            free(argv[i]);
+        free(argv);
+
+        wrench::TerminalOutput::disableColor();
+        xbt_log_control_set("wrench_core_trace_file_loader.thresh:warning");
+    }
+
+    // Redirect stderr, and thus logged warnings, to a (new) file
+    void captureWarnings() {
+        fflush(stderr);
+        if (freopen(stderr_file_path.c_str(), "w", stderr) == nullptr) {
+            throw std::runtime_error("Cannot redirect stderr");
+        }
+    }
+
+    // Get the warnings logged since the last call to captureWarnings()
+    std::vector<std::string> getCapturedWarnings() {
+        fflush(stderr);
+        std::vector<std::string> warnings;
+        std::ifstream file(stderr_file_path);
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.find("TraceFileLoader::") != std::string::npos) {
+                warnings.push_back(line);
+            }
+        }
+        return warnings;
+    }
+
+    static bool contains(const std::string &str, const std::string &substr) {
+        return (str.find(substr) != std::string::npos);
+    }
+
+    std::unique_ptr<wrench::Simulation> simulation;
+    std::string trace_file_path = UNIQUE_TMP_PATH_PREFIX + "trace_file_loader_test.swf";
+    std::string json_trace_file_path = UNIQUE_TMP_PATH_PREFIX + "trace_file_loader_test.json";
+    std::string stderr_file_path = UNIQUE_TMP_PATH_PREFIX + "trace_file_loader.stderr";
+};
+
+/**********************************************************************/
+/**  LARGE SWF FILE WITH AN INVALID JOB IN A LATER CHUNK              **/
+/**********************************************************************/
+
+TEST_F(TraceFileLoaderTest, LargeSWFWithInvalidJob) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_LargeSWFWithInvalidJob_test, false);
+    DO_TEST_WITH_FORK_ONE_ARG(do_LargeSWFWithInvalidJob_test, true);
+}
+
+void TraceFileLoaderTest::do_LargeSWFWithInvalidJob_test(bool ignore_invalid_jobs) {
+
+    initSimulation();
+
+    // A trace file large enough to be split into several chunks (of at least 1 MiB), with a job
+    // with a requested time smaller than its run time (a warning) early in the file, an invalid
+    // job late in the file, and another such warning after it
+    unsigned long early_warning_job = 10;
+    unsigned long invalid_job = (NUM_LARGE_TRACE_JOBS * 3) / 4;
+    unsigned long late_warning_job = (NUM_LARGE_TRACE_JOBS * 7) / 8;
+
+    FILE *trace_file = fopen(trace_file_path.c_str(), "w");
+    fprintf(trace_file, "; A generated trace\n");
+    for (unsigned long i = 0; i < NUM_LARGE_TRACE_JOBS; i++) {
+        if (i == NUM_LARGE_TRACE_JOBS / 2) {
+            fprintf(trace_file, "; A comment in the middle of the trace\n");
+        }
+        unsigned long requested_time = 200;
+        if (i == early_warning_job) {
+            requested_time = 50;
+        } else if (i == late_warning_job) {
+            requested_time = 60;
+        }
+        if (i == invalid_job) {
+            fprintf(trace_file, "%lu bogus 10 100 4 -1 -1 4 %lu 1 1 %lu 1 1 1 1 -1 -1\n",
+                    i + 1, requested_time, 1 + i % 5);
+        } else {
+            fprintf(trace_file, "%lu %lu 10 100 4 -1 -1 4 %lu 1 1 %lu 1 1 1 1 -1 -1\n",
+                    i + 1, 1000 + i, requested_time, 1 + i % 5);
+        }
+    }
+    fclose(trace_file);
+
+    struct stat trace_file_stat;
+    ASSERT_EQ(0, stat(trace_file_path.c_str(), &trace_file_stat));
+    ASSERT_GT(trace_file_stat.st_size, 4 * (1 << 20));
+
+    std::string invalid_job_error =
+            "TraceFileLoader::loadFromTraceFileSWF(): Invalid submission time 'bogus' in batch workload trace file";
+
+    captureWarnings();
+
+    if (not ignore_invalid_jobs) {
+        // The error is the one for the invalid job, and only the warnings that precede it are logged
+        try {
+            wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, false, -1);
+            throw std::runtime_error("Should not be able to load a trace file with an invalid job");
+        } catch (std::invalid_argument &e) {
+            ASSERT_EQ("Error while reading batch workload trace file " + trace_file_path + ": " + invalid_job_error,
+                      std::string(e.what()));
+        }
+
+        auto warnings = getCapturedWarnings();
+        ASSERT_EQ(1, warnings.size());
+        ASSERT_TRUE(contains(warnings[0], "requested time (50.000000) smaller than actual time (100.000000)"));
+
+    } else {
+        // The invalid job is skipped, and all warnings are logged in file order
+        std::shared_ptr<wrench::WorkloadTrace> trace;
+        ASSERT_NO_THROW(trace = wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, true, -1));
+
+        auto warnings = getCapturedWarnings();
+        ASSERT_EQ(3, warnings.size());
+        ASSERT_TRUE(contains(warnings[0], "requested time (50.000000) smaller than actual time (100.000000)"));
+        ASSERT_TRUE(contains(warnings[1], invalid_job_error + " (in batch workload file " + trace_file_path + ") IGNORING"));
+        ASSERT_TRUE(contains(warnings[2], "requested time (60.000000) smaller than actual time (100.000000)"));
+
+        ASSERT_EQ(NUM_LARGE_TRACE_JOBS - 1, trace->size());
+        for (unsigned long i = 0; i < trace->size(); i++) {
+            auto job = trace->getJob(i);
+            unsigned long line = (i < invalid_job ? i : i + 1);
+            ASSERT_DOUBLE_EQ(1000.0 + line, job.submit_time);
+            ASSERT_DOUBLE_EQ(100.0, job.time);
+            ASSERT_DOUBLE_EQ(((line == early_warning_job) or (line == late_warning_job)) ? 100.0 : 200.0,
+                             job.requested_time);
+            ASSERT_DOUBLE_EQ(1024.0, job.requested_ram);
+            ASSERT_EQ(4, job.num_nodes);
+        }
+
+        // The tuple-based API sees the same jobs
+        auto tuples = wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, true, -1);
+        ASSERT_EQ(trace->size(), tuples.size());
+        for (unsigned long i = 0; i < trace->size(); i += 997) {
+            auto job = trace->getJob(i);
+            ASSERT_EQ(job.username, std::get<0>(tuples[i]));
+            ASSERT_DOUBLE_EQ(job.submit_time, std::get<1>(tuples[i]));
+            ASSERT_DOUBLE_EQ(job.requested_time, std::get<3>(tuples[i]));
+            ASSERT_EQ(job.username, std::get<6>(tuples[i]));
+        }
+    }
+}
+
+/**********************************************************************/
+/**  SWF DESIRED SUBMIT TIME WITH INVALID JOBS BEFORE THE FIRST ONE   **/
+/**********************************************************************/
+
+TEST_F(TraceFileLoaderTest, SWFDesiredSubmitTime) {
+    DO_TEST_WITH_FORK(do_SWFDesiredSubmitTime_test);
+}
+
+void TraceFileLoaderTest::do_SWFDesiredSubmitTime_test() {
+
+    initSimulation();
+
+    // An invalid submission time and negative submission times before the first valid one
+    std::vector<std::string> submit_times = {"bogus", "-50", "-20", "500", "450", "530", "-100", "100"};
+    FILE *trace_file = fopen(trace_file_path.c_str(), "w");
+    fprintf(trace_file, "; A trace with invalid jobs first\n");
+    for (unsigned long i = 0; i < submit_times.size(); i++) {
+        fprintf(trace_file, "%lu %s 10 100 4 -1 -1 4 200 1 1 1 1 1 1 1 -1 -1\n", i + 1, submit_times[i].c_str());
+    }
+    fclose(trace_file);
+
+    std::string invalid_submission_time_error =
+            "TraceFileLoader::loadFromTraceFileSWF(): Invalid submission time 'bogus' in batch workload trace file";
+    std::string negative_submission_time_error =
+            "TraceFileLoader::loadFromTraceFileSWF(): invalid job with negative submission time in batch workload trace file";
+
+    // Not ignoring invalid jobs: the first line is an error
+    try {
+        wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, false, 1000);
+        throw std::runtime_error("Should not be able to load a trace file with an invalid job");
+    } catch (std::invalid_argument &e) {
+        ASSERT_EQ("Error while reading batch workload trace file " + trace_file_path + ": " + invalid_submission_time_error,
+                  std::string(e.what()));
+    }
+
+    // No desired submit time: jobs with negative submission times are invalid
+    {
+        captureWarnings();
+        auto trace = wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, true, -1);
+        std::vector<double> expected_submit_times = {500, 450, 530, 100};
+        ASSERT_EQ(expected_submit_times.size(), trace->size());
+        for (unsigned long i = 0; i < trace->size(); i++) {
+            ASSERT_DOUBLE_EQ(expected_submit_times[i], trace->getJob(i).submit_time);
+        }
+        auto warnings = getCapturedWarnings();
+        ASSERT_EQ(4, warnings.size());
+        ASSERT_TRUE(contains(warnings[0], invalid_submission_time_error));
+        for (unsigned long i = 1; i < 4; i++) {
+            ASSERT_TRUE(contains(warnings[i], negative_submission_time_error));
+        }
+    }
+
+    // Desired submit time: a job before the first valid submission time is submitted at the desired
+    // time, and the others are shifted by the first valid submission time
+    {
+        captureWarnings();
+        auto trace = wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, true, 1000);
+        std::vector<double> expected_submit_times = {1000, 1000, 1000, 950, 1030, 400, 600};
+        ASSERT_EQ(expected_submit_times.size(), trace->size());
+        for (unsigned long i = 0; i < trace->size(); i++) {
+            ASSERT_DOUBLE_EQ(expected_submit_times[i], trace->getJob(i).submit_time);
+        }
+        auto warnings = getCapturedWarnings();
+        ASSERT_EQ(1, warnings.size());
+        ASSERT_TRUE(contains(warnings[0], invalid_submission_time_error));
+    }
+
+    // Desired submit time that makes shifted submission times negative
+    {
+        captureWarnings();
+        auto trace = wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, true, 0);
+        std::vector<double> expected_submit_times = {0, 0, 0, 30};
+        ASSERT_EQ(expected_submit_times.size(), trace->size());
+        for (unsigned long i = 0; i < trace->size(); i++) {
+            ASSERT_DOUBLE_EQ(expected_submit_times[i], trace->getJob(i).submit_time);
+        }
+        auto warnings = getCapturedWarnings();
+        ASSERT_EQ(4, warnings.size());
+        ASSERT_TRUE(contains(warnings[0], invalid_submission_time_error));
+        for (unsigned long i = 1; i < 4; i++) {
+            ASSERT_TRUE(contains(warnings[i], negative_submission_time_error));
+        }
+    }
+}
+
+/**********************************************************************/
+/**  JOB IDS                                                         **/
+/**********************************************************************/
+
+TEST_F(TraceFileLoaderTest, JobIds) {
+    DO_TEST_WITH_FORK(do_JobIds_test);
+}
+
+void TraceFileLoaderTest::do_JobIds_test() {
+
+    initSimulation();
+
+    // JSON traces have job ids, which are the first field of the tuples
+    FILE *trace_file = fopen(json_trace_file_path.c_str(), "w");
+    fprintf(trace_file, "{\"jobs\": ["
+                        "{\"id\": 7, \"res\": 2, \"subtime\": 10, \"walltime\": 100},"
+                        "{\"id\": 3, \"res\": 4, \"subtime\": 20, \"walltime\": 200}"
+                        "]}\n");
+    fclose(trace_file);
+
+    auto trace = wrench::TraceFileLoader::loadWorkloadTrace(json_trace_file_path, false, -1);
+    ASSERT_EQ(2, trace->size());
+    ASSERT_EQ("7", trace->getJob(0).job_id);
+    ASSERT_EQ("3", trace->getJob(1).job_id);
+
+    auto tuples = wrench::TraceFileLoader::loadFromTraceFile(json_trace_file_path, false, -1);
+    ASSERT_EQ(2, tuples.size());
+    ASSERT_EQ("7", std::get<0>(tuples[0]));
+    ASSERT_EQ("3", std::get<0>(tuples[1]));
+    ASSERT_DOUBLE_EQ(20, std::get<1>(tuples[1]));
+    ASSERT_EQ(4, std::get<5>(tuples[1]));
+    ASSERT_EQ("user", std::get<6>(tuples[0]));
+    ASSERT_EQ("user", std::get<6>(tuples[1]));
+
+    // SWF traces do not, and the first field of the tuples is the username
+    trace_file = fopen(trace_file_path.c_str(), "w");
+    fprintf(trace_file, "1 0 10 100 4 -1 -1 4 200 1 1 0 1 1 1 1 -1 -1\n");
+    fprintf(trace_file, "2 10 10 100 4 -1 -1 4 200 1 1 42 1 1 1 1 -1 -1\n");
+    fclose(trace_file);
+
+    trace = wrench::TraceFileLoader::loadWorkloadTrace(trace_file_path, false, -1);
+    ASSERT_EQ(2, trace->size());
+    ASSERT_EQ("", trace->getJob(0).job_id);
+    ASSERT_EQ("user", trace->getJob(0).username);
+
+    tuples = wrench::TraceFileLoader::loadFromTraceFile(trace_file_path, false, -1);
+    ASSERT_EQ(2, tuples.size());
+    for (unsigned long i = 0; i < tuples.size(); i++) {
+        ASSERT_EQ(trace->getJob(i).username, std::get<0>(tuples[i]));
+        ASSERT_EQ(trace->getJob(i).username, std::get<6>(tuples[i]));
+    }
+    ASSERT_NE("user", std::get<0>(tuples[1]));
+}
@@ -49,6 +49,7 @@ public:
     void do_NoNonGridUniverseSupportTest_test();
     void do_NoPilotJobSupportTest_test();
     void do_NotEnoughResourcesTest_test();
+    void do_NegotiationCycleTest_test();
 
 protected:
     HTCondorServiceTest() {
@@ -1445,3 +1446,126 @@ void HTCondorServiceTest::do_NotEnoughResourcesTest_test() {
     free(argv[0]);
     free(argv);
 }
+
+/**********************************************************************/
+/**  MANY STANDARD JOBS MATCHED IN A NEGOTIATION CYCLE TEST          **/
+/**********************************************************************/
+
+class HTCondorNegotiationCycleTestWMS : public wrench::WMS {
+
+public:
+    HTCondorNegotiationCycleTestWMS(HTCondorServiceTest *test,
+                                    const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                    std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    HTCondorServiceTest *test;
+
+    int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Check the resource snapshot of the bare-metal service
+        auto bm_cs = *(this->getAvailableComputeServices<wrench::BareMetalComputeService>().begin());
+        auto idle_resources = bm_cs->getPerHostIdleResources();
+        if ((idle_resources.size() != 1) or (std::get<0>(idle_resources["QuadCoreHost"]) != 4)) {
+            throw std::runtime_error("Unexpected idle resources on the bare-metal compute service");
+        }
+
+        // Submit 5 1-core jobs to a 4-core host, so that exactly one job has to wait
+        for (int i=0; i < 5; i++) {
+            auto task = this->getWorkflow()->addTask("one_core_task_" + std::to_string(i), 10.0, 1, 1, 0);
+            auto job = job_manager->createStandardJob(task);
+            try {
+                job_manager->submitJob(job, this->test->compute_service);
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error(e.what());
+            }
+        }
+
+        std::vector<double> completion_dates;
+        for (int i=0; i < 5; i++) {
+            std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+            try {
+                event = this->getWorkflow()->waitForNextExecutionEvent();
+            } catch (wrench::WorkflowExecutionException &e) {
+                throw std::runtime_error("Error while getting an execution event: " + e.getCause()->toString());
+            }
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+            completion_dates.push_back(wrench::Simulation::getCurrentSimulatedDate());
+        }
+
+        if (completion_dates[3] - completion_dates[0] > 1.0) {
+            throw std::runtime_error("The first 4 jobs should have run concurrently");
+        }
+        if (completion_dates[4] - completion_dates[0] < 10.0) {
+            throw std::runtime_error("The last job should have waited for a core");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(HTCondorServiceTest, HTCondorNegotiationCycleTest) {
+    DO_TEST_WITH_FORK(do_NegotiationCycleTest_test);
+}
+
+void HTCondorServiceTest::do_NegotiationCycleTest_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "DualCoreHost";
+
+    // Create a BareMetalComputeService
+    std::string execution_host = "QuadCoreHost";
+    std::set<std::shared_ptr<wrench::ComputeService>> compute_services;
+    ASSERT_NO_THROW(compute_services.insert(simulation->add(
+            new wrench::BareMetalComputeService(
+                    execution_host,
+                    {std::make_pair(
+                            execution_host,
+                            std::make_tuple(wrench::Simulation::getHostNumCores(execution_host),
+                                            wrench::Simulation::getHostMemoryCapacity(execution_host)))},
+                    "/scratch"))));
+    auto baremetal_compute_service = *(compute_services.begin());
+
+    // Create a HTCondor Service
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::HTCondorComputeService(
+                    hostname, std::move(compute_services),
+                    {
+                            {wrench::HTCondorComputeServiceProperty::SUPPORTS_PILOT_JOBS, "false"},
+                            {wrench::HTCondorComputeServiceProperty::SUPPORTS_STANDARD_JOBS, "true"},
+                    })));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new HTCondorNegotiationCycleTestWMS(this, {compute_service, baremetal_compute_service}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -59,6 +59,8 @@ public:
 
     void do_VMStartShutdownStartShutdown_test();
 
+    void do_VMJobAfterShutdownAndRestart_test();
+
     void do_VMShutdownWhileJobIsRunning_test();
 
     void do_VMComputeServiceStopWhileJobIsRunning_test();
@@ -1588,6 +1590,130 @@ void VirtualizedClusterServiceTest::do_VMStartShutdownStartShutdown_test() {
     free(argv);
 }
 
+/**********************************************************************/
+/**              VM JOB AFTER SHUTDOWN AND RESTART                   **/
+/**********************************************************************/
+
+class CloudServiceVMJobAfterShutdownAndRestartTestWMS : public wrench::WMS {
+
+public:
+    CloudServiceVMJobAfterShutdownAndRestartTestWMS(VirtualizedClusterServiceTest *test,
+                                                    std::string &hostname, std::shared_ptr<wrench::ComputeService> cs,
+                                                    std::shared_ptr<wrench::StorageService> ss) :
+            wrench::WMS(nullptr, nullptr, {cs}, {ss}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+    VirtualizedClusterServiceTest *test;
+
+    void runTask(std::shared_ptr<wrench::JobManager> job_manager,
+                 std::shared_ptr<wrench::BareMetalComputeService> vm_cs,
+                 wrench::WorkflowTask *task, wrench::WorkflowFile *output_file,
+                 const std::string &vm_name) {
+        auto job = job_manager->createStandardJob(
+                {task},
+                {{this->test->input_file, wrench::FileLocation::LOCATION(this->test->storage_service)},
+                 {output_file, wrench::FileLocation::LOCATION(this->test->storage_service)}});
+        job_manager->submitJob(job, vm_cs);
+
+        std::shared_ptr<wrench::WorkflowExecutionEvent> event;
+        try {
+            event = this->getWorkflow()->waitForNextExecutionEvent();
+        } catch (wrench::WorkflowExecutionException &e) {
+            throw std::runtime_error("Error while getting and execution event: " + e.getCause()->toString());
+        }
+        if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+            throw std::runtime_error("Unexpected workflow execution event: " + event->toString() +
+                                     " (should be StandardJobCompletedEvent)");
+        }
+        if (task->getExecutionHost() != vm_name) {
+            throw std::runtime_error("Task " + task->getID() + " should have run on VM " + vm_name +
+                                     " but ran on " + task->getExecutionHost());
+        }
+        if (std::abs(task->getEndDate() - task->getStartDate() - 10.0) > EPSILON) {
+            throw std::runtime_error("Unexpected execution time for task " + task->getID() + ": " +
+                                     std::to_string(task->getEndDate() - task->getStartDate()));
+        }
+    }
+
+    int main() override {
+        auto cloud_service = *(this->getAvailableComputeServices<wrench::CloudComputeService>().begin());
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // Create a VM on the Cloud Service
+        auto vm_name = cloud_service->createVM(2, 1024);
+
+        // Start the VM and run a job on it
+        auto vm_cs = cloud_service->startVM(vm_name);
+        runTask(job_manager, vm_cs, this->test->task1, this->test->output_file1, vm_name);
+
+        // Shutdown the VM, which destroys the underlying S4U VM
+        cloud_service->shutdownVM(vm_name);
+        wrench::Simulation::sleep(10);
+
+        // Restart the VM (with the same compute service, on a new S4U VM) and run another job on it
+        vm_cs = cloud_service->startVM(vm_name);
+        runTask(job_manager, vm_cs, this->test->task2, this->test->output_file2, vm_name);
+
+        cloud_service->shutdownVM(vm_name);
+
+        return 0;
+    }
+};
+
+TEST_F(VirtualizedClusterServiceTest, VMJobAfterShutdownAndRestart) {
+    DO_TEST_WITH_FORK(do_VMJobAfterShutdownAndRestart_test);
+}
+
+void VirtualizedClusterServiceTest::do_VMJobAfterShutdownAndRestart_test() {
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    simulation->instantiatePlatform(platform_file_path);
+
+    // Get a hostname
+    std::string hostname = "DualCoreHost";
+    std::vector<std::string> compute_hosts;
+    compute_hosts.push_back("QuadCoreHost");
+
+    // Create a Cloud Service
+    compute_service = simulation->add(
+            new wrench::CloudComputeService(hostname,
+                                            compute_hosts,
+                                            "/scratch",
+                                            {}));
+
+    // Create a Storage Service
+    storage_service = simulation->add(new wrench::SimpleStorageService(hostname, {"/"}));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    wms = simulation->add(
+            new CloudServiceVMJobAfterShutdownAndRestartTestWMS(this, hostname, compute_service, storage_service));
+
+    wms->addWorkflow(workflow);
+
+    // Create a File Registry Service
+    simulation->add(new wrench::FileRegistryService(hostname));
+    simulation->stageFile(input_file, storage_service);
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    for (int i = 0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
 /**********************************************************************/
 /**                VM SHUTDOWN WHILE JOB IS RUNNING                  **/
 /**********************************************************************/
@@ -43,6 +43,8 @@ public:
 
     void do_OneMultiCoreTaskTestCase3_test();
 
+    void do_OneMultiCoreTaskTestCase4_test();
+
     void do_DependentTasksTest_test();
 
     void do_TwoMultiCoreTasksTest_test();
@@ -1762,6 +1764,163 @@ void StandardJobExecutorTest::do_OneMultiCoreTaskTestCase3_test() {
     free(argv);
 }
 
+/*******************************************************************************************************/
+/**  ONE MULTI-CORE TASK SIMULATION TEST : CASE 4                                                     **/
+/**  Case 4: Create a multicore Amdahl task, and simulate its computation as a single activity        **/
+/*******************************************************************************************************/
+
+class OneMultiCoreTaskTestWMSCase4 : public wrench::WMS {
+
+public:
+    OneMultiCoreTaskTestWMSCase4(StandardJobExecutorTest *test,
+                                 const std::set<std::shared_ptr<wrench::ComputeService>> &compute_services,
+                                 const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+                                 std::string hostname) :
+            wrench::WMS(nullptr, nullptr, compute_services, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+    StandardJobExecutorTest *test;
+
+    int main() {
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        auto task = this->getWorkflow()->addTask("task4", 3600, 1, 10, 0);
+        double alpha = 0.5;
+        task->setParallelModel(wrench::ParallelModel::AMDAHL(alpha));
+        task->addInputFile(this->getWorkflow()->getFileByID("input_file"));
+        task->addOutputFile(this->getWorkflow()->getFileByID("output_file"));
+
+        // Create a StandardJob
+        auto job = job_manager->createStandardJob(
+                task,
+                {
+                        {*(task->getInputFiles().begin()),  wrench::FileLocation::LOCATION(
+                                this->test->storage_service1)},
+                        {*(task->getOutputFiles().begin()), wrench::FileLocation::LOCATION(
+                                this->test->storage_service1)}
+                });
+
+        std::string my_mailbox = "test_callback_mailbox";
+
+        double before = wrench::S4U_Simulation::getClock();
+
+        // Create a StandardJobExecutor that will run stuff on one host and 10 cores, without compute threads
+        std::shared_ptr<wrench::StandardJobExecutor> executor = std::unique_ptr<wrench::StandardJobExecutor>(
+                new wrench::StandardJobExecutor(
+                        test->simulation,
+                        my_mailbox,
+                        wrench::Simulation::getHostnameList()[1],
+                        job,
+                        {std::make_pair(wrench::Simulation::getHostnameList()[1],
+                                        std::make_tuple(10, wrench::ComputeService::ALL_RAM))},
+                        nullptr,
+                        false,
+                        nullptr,
+                        {{wrench::StandardJobExecutorProperty::TASK_STARTUP_OVERHEAD, "0"},
+                         {wrench::StandardJobExecutorProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY, "true"}}, {}
+                ));
+        executor->start(executor, true, false); // Daemonized, no auto-restart
+
+        // Wait for a message on my mailbox_name
+        std::shared_ptr<wrench::SimulationMessage> message;
+        try {
+            message = wrench::S4U_Mailbox::getMessage(my_mailbox);
+        } catch (std::shared_ptr<wrench::NetworkError> &cause) {
+            throw std::runtime_error("Network error while getting reply from StandardJobExecutor!" + cause->toString());
+        }
+
+        // Did we get the expected message?
+        auto msg = std::dynamic_pointer_cast<wrench::StandardJobExecutorDoneMessage>(message);
+        if (!msg) {
+            throw std::runtime_error("Unexpected '" + message->getName() + "' message");
+        }
+
+        double after = wrench::S4U_Simulation::getClock();
+
+        double observed_duration = after - before;
+
+        // Same as with one compute thread per core: the sequential part plus a 10th of the parallel part
+        double expected_duration = (1 - alpha) * task->getFlops() + alpha * task->getFlops() / 10;
+
+        // Does the task completion time make sense?
+        if (!StandardJobExecutorTest::isJustABitGreater(expected_duration, observed_duration, EPSILON)) {
+            throw std::runtime_error(
+                    "Case 4: Unexpected job duration (should be around " + std::to_string(expected_duration) +
+                    " but is " +
+                    std::to_string(observed_duration) + ")");
+        }
+
+        wrench::StorageService::deleteFile(
+                this->getWorkflow()->getFileByID("output_file"),
+                wrench::FileLocation::LOCATION(this->test->storage_service1));
+
+        return 0;
+    }
+};
+
+TEST_F(StandardJobExecutorTest, OneMultiCoreTaskTestCase4) {
+    DO_TEST_WITH_FORK(do_OneMultiCoreTaskTestCase4_test);
+}
+
+void StandardJobExecutorTest::do_OneMultiCoreTaskTestCase4_test() {
+    // Create and initialize a simulation
+    simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = wrench::Simulation::getHostnameList()[0];
+
+    // Create a Compute Service (we don't use it)
+    std::shared_ptr<wrench::ComputeService> compute_service;
+    ASSERT_NO_THROW(compute_service = simulation->add(
+            new wrench::BareMetalComputeService(hostname,
+                                                {std::make_pair(hostname,
+                                                                std::make_tuple(wrench::ComputeService::ALL_CORES,
+                                                                                wrench::ComputeService::ALL_RAM))},
+                                                {})));
+    // Create a Storage Service
+    ASSERT_NO_THROW(storage_service1 = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/disk1"})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new OneMultiCoreTaskTestWMSCase4(
+                    this, {compute_service}, {storage_service1}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+    simulation->add(new wrench::FileRegistryService(hostname));
+
+    // Create two workflow files
+    wrench::WorkflowFile *input_file = this->workflow->addFile("input_file", 10000.0);
+    wrench::WorkflowFile *output_file = this->workflow->addFile("output_file", 20000.0);
+
+    // Staging the input_file on the storage service
+    ASSERT_NO_THROW(simulation->stageFile(input_file, storage_service1));
+
+    // Running a "run a single task" simulation
+    // Note that in these tests the WMS creates workflow tasks, which a user would
+    // of course not be likely to do
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
 /**********************************************************************/
 /**  TWO MULTI-CORE TASKS SIMULATION TEST ON ONE HOST               **/
 /**********************************************************************/
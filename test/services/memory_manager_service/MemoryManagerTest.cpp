@@ -20,6 +20,7 @@ WRENCH_LOG_CATEGORY(memory_manager_test, "Log category for MemoryManager test");
 #define GB (1000.0*1000.0*1000.0)
 #define PAGE_CACHE_RAM_SIZE  32
 #define FILE_SIZE 20
+#define MB (1000.0*1000.0)
 
 class MemoryManagerTest : public ::testing::Test {
 public:
@@ -29,6 +30,7 @@ public:
 
     void do_MemoryManagerBadSetupTest_test();
     void do_MemoryManagerChainOfTasksTest_test();
+    void do_MemoryManagerCacheTest_test(std::string test_name);
 
 protected:
     MemoryManagerTest() {
@@ -181,6 +183,22 @@ private:
             }
         }
 
+        // Check that the memory manager lookup works
+        auto memory_manager = this->simulation->getMemoryManagerByHost("TwoCoreHost");
+        if (memory_manager == nullptr) {
+            throw std::runtime_error("There should be a memory manager on host TwoCoreHost");
+        }
+        if (this->simulation->getMemoryManagerByHost("BogusHost") != nullptr) {
+            throw std::runtime_error("There should be no memory manager on a bogus host");
+        }
+
+        // Check that all dirty data is eventually flushed while the system is idle
+        wrench::Simulation::sleep(3600);
+        if (memory_manager->getDirty() > 0) {
+            throw std::runtime_error("All dirty data should have been flushed (" +
+                                     std::to_string(memory_manager->getDirty()) + " bytes still dirty)");
+        }
+
         return 0;
     }
 };
@@ -259,3 +277,249 @@ void MemoryManagerTest::do_MemoryManagerChainOfTasksTest_test() {
 }
 
 
+
+
+/**********************************************************************/
+/** CACHE DATA STRUCTURE TESTS                                       **/
+/**********************************************************************/
+
+class MemoryManagerCacheTestWMS : public wrench::WMS {
+public:
+    MemoryManagerCacheTestWMS(
+            MemoryManagerTest *test,
+            std::string test_name,
+            const std::set<std::shared_ptr<wrench::StorageService>> &storage_services,
+            std::string &hostname) :
+            wrench::WMS(nullptr, nullptr, {}, storage_services, {}, nullptr, hostname, "test") {
+        this->test = test;
+        this->test_name = test_name;
+    }
+
+private:
+    MemoryManagerTest *test;
+    std::string test_name;
+
+    static void checkAmount(const std::string &what, double expected, double actual) {
+        if (std::fabs(expected - actual) > 1.0) {
+            throw std::runtime_error(what + ": expected " + std::to_string(expected) +
+                                     " bytes but got " + std::to_string(actual) + " bytes");
+        }
+    }
+
+    // Returns the sizes of the cached blocks of a file (ordered by last access), and the number of dirty blocks
+    static std::vector<double> getCachedBlockSizes(wrench::MemoryManager *memory_manager, const std::string &filename,
+                                                   int *num_dirty_blocks) {
+        std::vector<double> sizes;
+        *num_dirty_blocks = 0;
+        for (auto blk : memory_manager->getCachedBlocks(filename)) {
+            sizes.push_back(blk->getSize());
+            if (blk->isDirty()) {
+                (*num_dirty_blocks)++;
+            }
+            delete blk;
+        }
+        return sizes;
+    }
+
+    static void checkBlockSizes(const std::string &what, const std::vector<double> &expected,
+                                const std::vector<double> &actual) {
+        if (expected.size() != actual.size()) {
+            throw std::runtime_error(what + ": expected " + std::to_string(expected.size()) +
+                                     " cached blocks but got " + std::to_string(actual.size()));
+        }
+        for (unsigned long i = 0; i < expected.size(); i++) {
+            checkAmount(what + " (block #" + std::to_string(i) + ")", expected[i], actual[i]);
+        }
+    }
+
+    void doPartialReads(wrench::MemoryManager *memory_manager, const std::shared_ptr<wrench::FileLocation> &location) {
+        int num_dirty_blocks;
+
+        memory_manager->addToCache("file", location, 100 * MB, false);
+        wrench::Simulation::sleep(10);
+
+        // Read a first chunk: it goes to the active list
+        memory_manager->readChunkFromCache("file", 30 * MB);
+        checkAmount("Cached amount after a first partial read", 100 * MB, memory_manager->getCachedAmount("file"));
+        checkAmount("Evictable memory after a first partial read", 70 * MB, memory_manager->getEvictableMemory());
+        checkBlockSizes("Blocks after a first partial read", {70 * MB, 30 * MB},
+                        getCachedBlockSizes(memory_manager, "file", &num_dirty_blocks));
+        wrench::Simulation::sleep(10);
+
+        // Read a second chunk: the active list becomes more than twice as large as the
+        // inactive list, and the least recently used active block goes back to the inactive list
+        memory_manager->readChunkFromCache("file", 50 * MB);
+        checkAmount("Cached amount after a second partial read", 100 * MB, memory_manager->getCachedAmount("file"));
+        checkAmount("Evictable memory after a second partial read", 50 * MB, memory_manager->getEvictableMemory());
+        checkBlockSizes("Blocks after a second partial read", {20 * MB, 30 * MB, 50 * MB},
+                        getCachedBlockSizes(memory_manager, "file", &num_dirty_blocks));
+        wrench::Simulation::sleep(10);
+
+        // Read the whole file
+        memory_manager->readChunkFromCache("file", 100 * MB);
+        checkAmount("Cached amount after a full read", 100 * MB, memory_manager->getCachedAmount("file"));
+        checkAmount("Evictable memory after a full read", 50 * MB, memory_manager->getEvictableMemory());
+        checkBlockSizes("Blocks after a full read", {50 * MB, 50 * MB},
+                        getCachedBlockSizes(memory_manager, "file", &num_dirty_blocks));
+        if (num_dirty_blocks != 0) {
+            throw std::runtime_error("There should be no dirty block");
+        }
+        checkAmount("Total cached amount", 100 * MB, memory_manager->getTotalCachedAmount());
+
+        // Unknown file
+        checkAmount("Cached amount of an unknown file", 0, memory_manager->getCachedAmount("bogus"));
+        if (not memory_manager->getCachedBlocks("bogus").empty()) {
+            throw std::runtime_error("There should be no cached block for an unknown file");
+        }
+    }
+
+    void doListBalancing(wrench::MemoryManager *memory_manager, const std::shared_ptr<wrench::FileLocation> &location) {
+        memory_manager->addToCache("a", location, 30 * MB, false);
+        memory_manager->addToCache("b", location, 30 * MB, false);
+        memory_manager->addToCache("c", location, 30 * MB, false);
+        memory_manager->addToCache("d", location, 10 * MB, false);
+        wrench::Simulation::sleep(10);
+
+        // Active: a (30), inactive: b, c, d (70)
+        memory_manager->readChunkFromCache("a", 30 * MB);
+        checkAmount("Evictable memory after reading a", 70 * MB, memory_manager->getEvictableMemory());
+        // Active: a, b (60), inactive: c, d (40)
+        memory_manager->readChunkFromCache("b", 30 * MB);
+        checkAmount("Evictable memory after reading b", 40 * MB, memory_manager->getEvictableMemory());
+        // Active: a, b, c (90), inactive: d (10), which is unbalanced: all of a and 10MB of b
+        // move to the inactive list, so that both lists hold 50MB
+        memory_manager->readChunkFromCache("c", 30 * MB);
+        checkAmount("Evictable memory after reading c", 50 * MB, memory_manager->getEvictableMemory());
+        checkAmount("Total cached amount", 100 * MB, memory_manager->getTotalCachedAmount());
+        for (auto const &f : std::vector<std::pair<std::string, double>>({{"a", 30 * MB}, {"b", 30 * MB},
+                                                                           {"c", 30 * MB}, {"d", 10 * MB}})) {
+            checkAmount("Cached amount of " + f.first, f.second, memory_manager->getCachedAmount(f.first));
+        }
+
+        // Evicting 50MB evicts exactly the inactive list (d, then a, then part of b)
+        checkAmount("Evicted amount", 50 * MB, memory_manager->evict(50 * MB, ""));
+        checkAmount("Evictable memory after eviction", 0, memory_manager->getEvictableMemory());
+        checkAmount("Cached amount of a after eviction", 0, memory_manager->getCachedAmount("a"));
+        checkAmount("Cached amount of b after eviction", 20 * MB, memory_manager->getCachedAmount("b"));
+        checkAmount("Cached amount of c after eviction", 30 * MB, memory_manager->getCachedAmount("c"));
+        checkAmount("Cached amount of d after eviction", 0, memory_manager->getCachedAmount("d"));
+    }
+
+    void doEvictionAndFlush(wrench::MemoryManager *memory_manager, const std::shared_ptr<wrench::FileLocation> &location) {
+        int num_dirty_blocks;
+
+        // Inactive list: a (clean), b (dirty), c (clean)
+        memory_manager->addToCache("a", location, 10 * MB, false);
+        wrench::Simulation::sleep(1);
+        memory_manager->addToCache("b", location, 10 * MB, true);
+        wrench::Simulation::sleep(1);
+        memory_manager->addToCache("c", location, 10 * MB, false);
+        checkAmount("Dirty amount", 10 * MB, memory_manager->getDirty());
+        double free_memory = memory_manager->getFreeMemory();
+
+        // Eviction goes in LRU order and skips dirty blocks: all of a, then part of c
+        checkAmount("Evicted amount", 15 * MB, memory_manager->evict(15 * MB, ""));
+        checkAmount("Cached amount of a after eviction", 0, memory_manager->getCachedAmount("a"));
+        checkAmount("Cached amount of b after eviction", 10 * MB, memory_manager->getCachedAmount("b"));
+        checkAmount("Cached amount of c after eviction", 5 * MB, memory_manager->getCachedAmount("c"));
+        checkAmount("Free memory after eviction", free_memory + 15 * MB, memory_manager->getFreeMemory());
+
+        // Excluded files are not evicted, and dirty blocks cannot be evicted
+        checkAmount("Evicted amount (c excluded)", 0, memory_manager->evict(100 * MB, "c"));
+        checkAmount("Cached amount of c", 5 * MB, memory_manager->getCachedAmount("c"));
+
+        // Excluded files are not flushed
+        checkAmount("Flushed amount (b excluded)", 0, memory_manager->flush(100 * MB, "b"));
+        checkAmount("Dirty amount", 10 * MB, memory_manager->getDirty());
+
+        // A partial flush splits the dirty block
+        checkAmount("Flushed amount", 4 * MB, memory_manager->flush(4 * MB, ""));
+        checkAmount("Dirty amount after a partial flush", 6 * MB, memory_manager->getDirty());
+        checkAmount("Cached amount of b after a partial flush", 10 * MB, memory_manager->getCachedAmount("b"));
+        auto sizes = getCachedBlockSizes(memory_manager, "b", &num_dirty_blocks);
+        if ((sizes.size() != 2) or (num_dirty_blocks != 1)) {
+            throw std::runtime_error("After a partial flush there should be one dirty and one clean block of b");
+        }
+
+        // Only the clean data can be evicted: c and the flushed part of b
+        checkAmount("Evicted amount after a partial flush", 9 * MB, memory_manager->evict(100 * MB, ""));
+        checkAmount("Cached amount of b", 6 * MB, memory_manager->getCachedAmount("b"));
+        checkAmount("Cached amount of c", 0, memory_manager->getCachedAmount("c"));
+
+        // Once flushed, everything can be evicted
+        checkAmount("Flushed amount", 6 * MB, memory_manager->flush(100 * MB, ""));
+        checkAmount("Dirty amount after a full flush", 0, memory_manager->getDirty());
+        checkAmount("Evicted amount after a full flush", 6 * MB, memory_manager->evict(100 * MB, ""));
+        checkAmount("Total cached amount", 0, memory_manager->getTotalCachedAmount());
+        checkAmount("Free memory", free_memory + 30 * MB, memory_manager->getFreeMemory());
+    }
+
+    int main() {
+        auto memory_manager = this->simulation->getMemoryManagerByHost("TwoCoreHost");
+        if (memory_manager == nullptr) {
+            throw std::runtime_error("There should be a memory manager on host TwoCoreHost");
+        }
+        auto location = wrench::FileLocation::LOCATION(test->storage_service1);
+
+        if (this->test_name == "partial_reads") {
+            doPartialReads(memory_manager, location);
+        } else if (this->test_name == "list_balancing") {
+            doListBalancing(memory_manager, location);
+        } else if (this->test_name == "eviction_and_flush") {
+            doEvictionAndFlush(memory_manager, location);
+        } else {
+            throw std::runtime_error("Unknown test " + this->test_name);
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(MemoryManagerTest, PartialReads) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_MemoryManagerCacheTest_test, "partial_reads")
+}
+
+TEST_F(MemoryManagerTest, ListBalancing) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_MemoryManagerCacheTest_test, "list_balancing")
+}
+
+TEST_F(MemoryManagerTest, EvictionAndFlush) {
+    DO_TEST_WITH_FORK_ONE_ARG(do_MemoryManagerCacheTest_test, "eviction_and_flush")
+}
+
+void MemoryManagerTest::do_MemoryManagerCacheTest_test(std::string test_name) {
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 2;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+    argv[1] = strdup("--wrench-pagecache-simulation");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Get a hostname
+    std::string hostname = "TwoCoreHost";
+
+    // Create a Storage Service (which starts the memory manager of the host)
+    ASSERT_NO_THROW(storage_service1 = simulation->add(
+            new wrench::SimpleStorageService(hostname, {"/"}, {}, {})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new MemoryManagerCacheTestWMS(this, test_name, {storage_service1}, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow));
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
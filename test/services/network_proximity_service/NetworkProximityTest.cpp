@@ -35,6 +35,8 @@ public:
 
     void do_ValidateProperties_Test();
 
+    void do_ManyDaemons_Test();
+
 protected:
     NetworkProximityTest() {
 
@@ -120,9 +122,25 @@ protected:
         fprintf(platform_file, "%s", xml.c_str());
         fclose(platform_file);
 
+        // Create a cluster platform file
+        std::string cluster_xml = "<?xml version='1.0'?>"
+                                  "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
+                                  "<platform version=\"4.1\">"
+                                  "   <zone id=\"AS0\" routing=\"Full\">"
+                                  "     <cluster id=\"cluster\" prefix=\"node_\" suffix=\"\" radical=\"0-31\""
+                                  "              core=\"1\" speed=\"1f\" bw=\"1000GBps\" lat=\"10us\">"
+                                  "         <prop id=\"ram\" value=\"1000B\"/>"
+                                  "     </cluster>"
+                                  "   </zone>"
+                                  "</platform>";
+
+        FILE *cluster_platform_file = fopen(cluster_platform_file_path.c_str(), "w");
+        fprintf(cluster_platform_file, "%s", cluster_xml.c_str());
+        fclose(cluster_platform_file);
     }
 
     std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    std::string cluster_platform_file_path = UNIQUE_TMP_PATH_PREFIX + "cluster_platform.xml";
     std::unique_ptr<wrench::Workflow> workflow;
 
 };
@@ -831,4 +849,121 @@ void NetworkProximityTest::do_ValidateProperties_Test() {
     for (int i=0; i < argc; i++)
      free(argv[i]);
     free(argv);
-}
\ No newline at end of file
+}
+
+/**********************************************************************/
+/**  MANY DAEMONS TEST                                               **/
+/**********************************************************************/
+
+class ManyDaemonsWMS : public wrench::WMS {
+public:
+    ManyDaemonsWMS(NetworkProximityTest *test,
+                   std::shared_ptr<wrench::NetworkProximityService> alltoall_service,
+                   std::shared_ptr<wrench::NetworkProximityService> vivaldi_service,
+                   std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {alltoall_service, vivaldi_service}, nullptr, hostname, "test") {
+        this->test = test;
+        this->alltoall_service = alltoall_service;
+        this->vivaldi_service = vivaldi_service;
+    }
+
+private:
+    NetworkProximityTest *test;
+    std::shared_ptr<wrench::NetworkProximityService> alltoall_service;
+    std::shared_ptr<wrench::NetworkProximityService> vivaldi_service;
+
+    int main() {
+
+        auto hosts = this->alltoall_service->getHostnameList();
+
+        // Every daemon should eventually have measured its proximity to every other daemon
+        bool all_measured = false;
+        for (int attempt = 0; (attempt < 20) and (not all_measured); attempt++) {
+            wrench::S4U_Simulation::sleep(500);
+            all_measured = true;
+            for (auto const &h1 : hosts) {
+                for (auto const &h2 : hosts) {
+                    if (this->alltoall_service->getHostPairDistance(std::make_pair(h1, h2)).first ==
+                        wrench::NetworkProximityService::NOT_AVAILABLE) {
+                        all_measured = false;
+                        break;
+                    }
+                }
+                if (not all_measured) {
+                    break;
+                }
+            }
+        }
+        if (not all_measured) {
+            throw std::runtime_error("Some pairs of hosts were never measured");
+        }
+
+        // Unknown hosts have no proximity values
+        if (this->alltoall_service->getHostPairDistance(std::make_pair(hosts[0], "bogus")).first !=
+            wrench::NetworkProximityService::NOT_AVAILABLE) {
+            throw std::runtime_error("Should not have a proximity value for an unknown host");
+        }
+
+        // Every daemon's coordinates should have been updated
+        for (auto const &h : hosts) {
+            auto coordinates = this->vivaldi_service->getHostCoordinate(h).first;
+            if ((coordinates.first == 0) and (coordinates.second == 0)) {
+                throw std::runtime_error("Vivaldi algorithm did not update the coordinates of host " + h);
+            }
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(NetworkProximityTest, ManyDaemonsTest) {
+    DO_TEST_WITH_FORK(do_ManyDaemons_Test);
+}
+
+void NetworkProximityTest::do_ManyDaemons_Test() {
+    // Create and initialize a simulation
+    auto simulation = new wrench::Simulation();
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(cluster_platform_file_path));
+
+    std::vector<std::string> hosts_in_network = wrench::Simulation::getHostnameList();
+    ASSERT_EQ(32, hosts_in_network.size());
+    std::string hostname = hosts_in_network[0];
+
+    std::shared_ptr<wrench::NetworkProximityService> alltoall_network_service = nullptr;
+    std::shared_ptr<wrench::NetworkProximityService> vivaldi_network_service = nullptr;
+
+    ASSERT_NO_THROW(alltoall_network_service = simulation->add(
+            new wrench::NetworkProximityService(hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "ALLTOALL"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD, "1"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD_MAX_NOISE, "0.1"}})));
+
+    ASSERT_NO_THROW(vivaldi_network_service = simulation->add(
+            new wrench::NetworkProximityService(hostname, hosts_in_network,
+                                                {{wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_SERVICE_TYPE, "VIVALDI"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_DAEMON_COMMUNICATION_COVERAGE, "0.1"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD, "1"},
+                                                 {wrench::NetworkProximityServiceProperty::NETWORK_PROXIMITY_MEASUREMENT_PERIOD_MAX_NOISE, "0.1"}})));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    ASSERT_NO_THROW(wms = simulation->add(
+            new ManyDaemonsWMS(this, alltoall_network_service, vivaldi_network_service, hostname)));
+
+    ASSERT_NO_THROW(wms->addWorkflow(workflow.get()));
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    for (int i=0; i < argc; i++)
+     free(argv[i]);
+    free(argv);
+}
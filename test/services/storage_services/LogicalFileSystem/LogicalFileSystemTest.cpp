@@ -13,6 +13,8 @@ public:
 
     void do_BasicTests();
 
+    void do_InternedPathsTest();
+
 protected:
     LogicalFileSystemTest() {
 
@@ -104,3 +106,67 @@ void LogicalFileSystemTest::do_BasicTests() {
         free(argv[i]);
     free(argv);
 }
+
+
+TEST_F(LogicalFileSystemTest, InternedPaths) {
+    DO_TEST_WITH_FORK(do_InternedPathsTest);
+}
+
+void LogicalFileSystemTest::do_InternedPathsTest() {
+    // Create and initialize the simulation
+    auto simulation = new wrench::Simulation();
+    auto workflow = new wrench::Workflow();
+
+    int argc = 1;
+    char **argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // set up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    std::shared_ptr<wrench::SimpleStorageService> storage_service;
+    ASSERT_NO_THROW(storage_service = simulation->add(
+            new wrench::SimpleStorageService("Host", {"/"})));
+
+    auto fs = new wrench::LogicalFileSystem("Host", storage_service.get(), "/tmp");
+    fs->init();
+
+    // Equivalent spellings of a directory path are interned as the same path
+    auto path_id = wrench::FileLocation::internPath("/a");
+    ASSERT_EQ(path_id, wrench::FileLocation::internPath("/a/"));
+    ASSERT_EQ(path_id, wrench::FileLocation::internPath("/a/./"));
+    ASSERT_NE(path_id, wrench::FileLocation::internPath("/b"));
+    ASSERT_EQ("/a/", wrench::FileLocation::getInternedPath(path_id));
+
+    // And the file system treats them as the same directory
+    auto file1 = workflow->addFile("file1", 100);
+    auto file2 = workflow->addFile("file2", 100);
+
+    ASSERT_FALSE(fs->doesDirectoryExist("/a/./"));
+    fs->storeFileInDirectory(file1, "/a");
+    ASSERT_TRUE(fs->doesDirectoryExist("/a/"));
+    ASSERT_TRUE(fs->doesDirectoryExist("/a/./"));
+    ASSERT_TRUE(fs->isFileInDirectory(file1, "/a/"));
+    ASSERT_TRUE(fs->isFileInDirectory(file1, "/a/./"));
+
+    fs->storeFileInDirectory(file2, "/a/./");
+    ASSERT_EQ(2, fs->listFilesInDirectory("/a").size());
+    ASSERT_EQ(2, fs->listFilesInDirectory("/a/").size());
+
+    fs->removeFileFromDirectory(file1, "/a/");
+    ASSERT_FALSE(fs->isFileInDirectory(file1, "/a"));
+    ASSERT_TRUE(fs->isFileInDirectory(file2, "/a"));
+    ASSERT_EQ(1, fs->listFilesInDirectory("/a/./").size());
+
+    fs->removeAllFilesInDirectory("/a/./");
+    ASSERT_TRUE(fs->isDirectoryEmpty("/a"));
+    fs->removeEmptyDirectory("/a/");
+    ASSERT_FALSE(fs->doesDirectoryExist("/a"));
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -14,7 +14,10 @@ public:
     std::shared_ptr<wrench::StorageService> storage_service_1 = nullptr;
     std::shared_ptr<wrench::StorageService> storage_service_2 = nullptr;
 
-    void do_ChunkingTest(std::string mode);
+    double file_size_0_transfer_time = -1.0;
+    double file_size_100_transfer_time = -1.0;
+
+    void do_ChunkingTest(std::string mode, unsigned long buffer_size);
 
 protected:
     SimpleStorageServiceChunkingTest() {
@@ -26,8 +29,9 @@ protected:
         file_size_100 = workflow->addFile("file_size_100", 100);
 
 
-        // Create a 2-host platform file
+        // Create a 3-host platform file, in which all transfers go over the same link
         // [WMSHost]-----[StorageHost]
+        //     |______[OtherStorageHost]
         std::string xml = "<?xml version='1.0'?>"
                           "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
                           "<platform version=\"4.1\"> "
@@ -37,16 +41,24 @@ protected:
                           "             <prop id=\"size\" value=\"1000B\"/>"
                           "             <prop id=\"mount\" value=\"/disk1\"/>"
                           "          </disk>"
+                          "       </host>"
+                          "       <host id=\"OtherStorageHost\" speed=\"1f\"> "
                           "          <disk id=\"disk2\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
                           "             <prop id=\"size\" value=\"1000B\"/>"
                           "             <prop id=\"mount\" value=\"/disk2\"/>"
                           "          </disk>"
                           "       </host>"
                           "       <host id=\"WMSHost\" speed=\"1f\"/> "
-                          "       <link id=\"link\" bandwidth=\"100Bps\" latency=\"100us\"/>"
+                          "       <link id=\"link\" bandwidth=\"100Bps\" latency=\"10ms\"/>"
                           "       <route src=\"WMSHost\" dst=\"StorageHost\">"
                           "         <link_ctn id=\"link\"/>"
                           "       </route>"
+                          "       <route src=\"WMSHost\" dst=\"OtherStorageHost\">"
+                          "         <link_ctn id=\"link\"/>"
+                          "       </route>"
+                          "       <route src=\"StorageHost\" dst=\"OtherStorageHost\">"
+                          "         <link_ctn id=\"link\"/>"
+                          "       </route>"
                           "   </zone> "
                           "</platform>";
         FILE *platform_file = fopen(platform_file_path.c_str(), "w");
@@ -79,74 +91,102 @@ private:
 
         auto data_movement_manager = this->createDataMovementManager();
 
+        this->test->file_size_0_transfer_time = this->transferFile(data_movement_manager, this->test->file_size_0);
+        this->test->file_size_100_transfer_time = this->transferFile(data_movement_manager, this->test->file_size_100);
+
+        return 0;
+    }
+
+    double transferFile(std::shared_ptr<wrench::DataMovementManager> data_movement_manager, wrench::WorkflowFile *file) {
+        double start = wrench::Simulation::getCurrentSimulatedDate();
+
         if (mode == "reading") {
             wrench::StorageService::readFile(
-                    this->test->file_size_0,
-                    wrench::FileLocation::LOCATION(this->test->storage_service_1));
-            wrench::StorageService::readFile(
-                    this->test->file_size_100,
+                    file,
                     wrench::FileLocation::LOCATION(this->test->storage_service_1));
 
         } else if (mode == "writing") {
             wrench::StorageService::writeFile(
-                    this->test->file_size_0,
-                    wrench::FileLocation::LOCATION(this->test->storage_service_2));
-            wrench::StorageService::writeFile(
-                    this->test->file_size_100,
+                    file,
                     wrench::FileLocation::LOCATION(this->test->storage_service_2));
 
         } else if (mode == "copying") {
-            data_movement_manager->doSynchronousFileCopy(this->test->file_size_0,
-                                                         wrench::FileLocation::LOCATION(this->test->storage_service_1),
-                                                         wrench::FileLocation::LOCATION(this->test->storage_service_2));
-            data_movement_manager->doSynchronousFileCopy(this->test->file_size_100,
+            data_movement_manager->doSynchronousFileCopy(file,
                                                          wrench::FileLocation::LOCATION(this->test->storage_service_1),
                                                          wrench::FileLocation::LOCATION(this->test->storage_service_2));
 
         }
 
-        return 0;
+        return wrench::Simulation::getCurrentSimulatedDate() - start;
     }
 };
 
 TEST_F(SimpleStorageServiceChunkingTest, ReadingFile) {
-    DO_TEST_WITH_FORK_ONE_ARG(do_ChunkingTest, "reading");
+    DO_TEST_WITH_FORK_TWO_ARGS(do_ChunkingTest, "reading", 5);
 }
 
 TEST_F(SimpleStorageServiceChunkingTest, WritingFile) {
-    DO_TEST_WITH_FORK_ONE_ARG(do_ChunkingTest, "writing");
+    DO_TEST_WITH_FORK_TWO_ARGS(do_ChunkingTest, "writing", 5);
 }
 
 TEST_F(SimpleStorageServiceChunkingTest, CopyingFile) {
-    DO_TEST_WITH_FORK_ONE_ARG(do_ChunkingTest, "copying");
+    DO_TEST_WITH_FORK_TWO_ARGS(do_ChunkingTest, "copying", 5);
 }
 
-void SimpleStorageServiceChunkingTest::do_ChunkingTest(std::string mode) {
+TEST_F(SimpleStorageServiceChunkingTest, ReadingFileZeroBuffer) {
+    DO_TEST_WITH_FORK_TWO_ARGS(do_ChunkingTest, "reading", 0);
+}
+
+TEST_F(SimpleStorageServiceChunkingTest, WritingFileZeroBuffer) {
+    DO_TEST_WITH_FORK_TWO_ARGS(do_ChunkingTest, "writing", 0);
+}
+
+TEST_F(SimpleStorageServiceChunkingTest, CopyingFileZeroBuffer) {
+    DO_TEST_WITH_FORK_TWO_ARGS(do_ChunkingTest, "copying", 0);
+}
+
+void SimpleStorageServiceChunkingTest::do_ChunkingTest(std::string mode, unsigned long buffer_size) {
 
     // Create and initialize the simulation
     auto simulation = new wrench::Simulation();
 
-    int argc = 1;
+    // Use a network model without bandwidth/latency correction factors, so that
+    // sending a message takes exactly latency + size / bandwidth
+    int argc = 3;
     char **argv = (char **) calloc(argc, sizeof(char *));
     argv[0] = strdup("unit_test");
+    argv[1] = strdup("--cfg=network/model:CM02");
+    argv[2] = strdup("--cfg=network/crosstraffic:0");
 
     ASSERT_NO_THROW(simulation->init(&argc, argv));
 
     // set up the platform
     ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
 
+    // Control messages that could be in flight during a file transfer take no bandwidth
+    std::map<std::string, double> messagepayload_list = {
+            {wrench::SimpleStorageServiceMessagePayload::FILE_READ_REQUEST_MESSAGE_PAYLOAD,  0},
+            {wrench::SimpleStorageServiceMessagePayload::FILE_READ_ANSWER_MESSAGE_PAYLOAD,   0},
+            {wrench::SimpleStorageServiceMessagePayload::FILE_WRITE_REQUEST_MESSAGE_PAYLOAD, 0},
+            {wrench::SimpleStorageServiceMessagePayload::FILE_WRITE_ANSWER_MESSAGE_PAYLOAD,  0},
+            {wrench::SimpleStorageServiceMessagePayload::FILE_COPY_REQUEST_MESSAGE_PAYLOAD,  0},
+            {wrench::SimpleStorageServiceMessagePayload::FILE_COPY_ANSWER_MESSAGE_PAYLOAD,   0},
+    };
+
     // Create One Storage Service
     ASSERT_NO_THROW(storage_service_1 = simulation->add(
             new wrench::SimpleStorageService("StorageHost", {"/disk1"},
-                                             {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "5"},
-                                              {wrench::SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS, "10"}}
+                                             {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, std::to_string(buffer_size)},
+                                              {wrench::SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS, "10"}},
+                                             messagepayload_list
             )));
 
-    // Create Another Storage Service
+    // Create Another Storage Service, with a different buffer size (unless it's zero)
     ASSERT_NO_THROW(storage_service_2 = simulation->add(
-            new wrench::SimpleStorageService("StorageHost", {"/disk2"},
-                                             {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, "10"},
-                                              {wrench::SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS, "10"}}
+            new wrench::SimpleStorageService("OtherStorageHost", {"/disk2"},
+                                             {{wrench::SimpleStorageServiceProperty::BUFFER_SIZE, std::to_string(2 * buffer_size)},
+                                              {wrench::SimpleStorageServiceProperty::MAX_NUM_CONCURRENT_DATA_CONNECTIONS, "10"}},
+                                             messagepayload_list
             )));
 
     // Create a file registry
@@ -166,6 +206,18 @@ void SimpleStorageServiceChunkingTest::do_ChunkingTest(std::string mode) {
 
     ASSERT_NO_THROW(simulation->launch());
 
+    // Both transfers exchange the same control messages, but under the ideal fluid model
+    // file_size_100 goes over the 100Bps link as a single message, so it takes 100 / 100 = 1 second
+    // longer than file_size_0 (which is sent as a 1-byte message, unless it is written)
+    double expected_difference = (mode == "writing") ? 1.0 : 0.99;
+    double difference = file_size_100_transfer_time - file_size_0_transfer_time;
+    if (buffer_size == 0) {
+        ASSERT_NEAR(expected_difference, difference, 0.001);
+    } else {
+        // Sending file_size_100 in (at least 10) chunks pays the 10ms link latency at least 9 more times
+        ASSERT_GT(difference, expected_difference + 0.05);
+    }
+
     delete simulation;
     for (int i=0; i < argc; i++)
      free(argv[i]);
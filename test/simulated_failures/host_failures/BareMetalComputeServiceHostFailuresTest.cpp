@@ -37,6 +37,7 @@ public:
     void do_BareMetalComputeServiceOneFailureCausingWorkUnitRestartOnSameHost_test();
     void do_BareMetalComputeServiceRandomFailures_test();
     void do_BareMetalComputeServiceFailureOnServiceThatTerminatesWhenAllItsResourcesAreDown_test();
+    void do_BareMetalComputeServiceSingleActivityOneFailure_test();
 
 protected:
 
@@ -89,6 +90,8 @@ protected:
                           "             <prop id=\"mount\" value=\"/scratch\"/>"
                           "          </disk>"
                           "       </host>  "
+                          "       <host id=\"FailedQuadCoreHost1\" speed=\"1f\" core=\"4\"/>  "
+                          "       <host id=\"FailedQuadCoreHost2\" speed=\"1f\" core=\"4\"/>  "
                           "       <link id=\"link1\" bandwidth=\"100kBps\" latency=\"0\"/>"
                           "       <route src=\"FailedHost1\" dst=\"StableHost\">"
                           "           <link_ctn id=\"link1\"/>"
@@ -96,6 +99,12 @@ protected:
                           "       <route src=\"FailedHost2\" dst=\"StableHost\">"
                           "           <link_ctn id=\"link1\"/>"
                           "       </route>"
+                          "       <route src=\"FailedQuadCoreHost1\" dst=\"StableHost\">"
+                          "           <link_ctn id=\"link1\"/>"
+                          "       </route>"
+                          "       <route src=\"FailedQuadCoreHost2\" dst=\"StableHost\">"
+                          "           <link_ctn id=\"link1\"/>"
+                          "       </route>"
                           "   </zone> "
                           "</platform>";
         FILE *platform_file = fopen(platform_file_path.c_str(), "w");
@@ -591,3 +600,155 @@ void BareMetalComputeServiceHostFailuresTest::do_BareMetalComputeServiceFailureO
      free(argv[i]);
     free(argv);
 }
+
+
+
+/**********************************************************************/
+/**    FAILURE DURING A COMPUTATION SIMULATED AS A SINGLE ACTIVITY   **/
+/**    (same behavior as with compute threads)                       **/
+/**********************************************************************/
+
+class BareMetalComputeServiceSingleActivityOneFailureTestWMS : public wrench::WMS {
+
+public:
+    BareMetalComputeServiceSingleActivityOneFailureTestWMS(BareMetalComputeServiceHostFailuresTest *test,
+                                                           std::string &hostname,
+                                                           std::shared_ptr<wrench::ComputeService> cs,
+                                                           std::shared_ptr<wrench::ComputeService> single_activity_cs) :
+            wrench::WMS(nullptr, nullptr, {cs, single_activity_cs}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+        this->single_activity_cs = single_activity_cs;
+    }
+
+private:
+
+    BareMetalComputeServiceHostFailuresTest *test;
+    std::shared_ptr<wrench::ComputeService> single_activity_cs;
+
+    std::vector<double> getTaskFailureDates(wrench::WorkflowTask *task) {
+        std::vector<double> dates;
+        for (auto const &timestamp : this->simulation->getOutput().getTrace<wrench::SimulationTimestampTaskFailure>()) {
+            if (timestamp->getContent()->getTask() == task) {
+                dates.push_back(timestamp->getDate());
+            }
+        }
+        return dates;
+    }
+
+    int main() override {
+
+        // Turn off both hosts at time 100, and back on at time 1000
+        for (auto const &hostname : {"FailedQuadCoreHost1", "FailedQuadCoreHost2"}) {
+            auto murderer = std::shared_ptr<wrench::ResourceSwitcher>(new wrench::ResourceSwitcher("StableHost", 100, hostname,
+                                                                                                   wrench::ResourceSwitcher::Action::TURN_OFF, wrench::ResourceSwitcher::ResourceType::HOST));
+            murderer->simulation = this->simulation;
+            murderer->start(murderer, true, false); // Daemonized, no auto-restart
+
+            auto resurector = std::shared_ptr<wrench::ResourceSwitcher>(new wrench::ResourceSwitcher("StableHost", 1000, hostname,
+                                                                                                     wrench::ResourceSwitcher::Action::TURN_ON, wrench::ResourceSwitcher::ResourceType::HOST));
+            resurector->simulation = this->simulation;
+            resurector->start(resurector, true, false); // Daemonized, no auto-restart
+        }
+
+        // Create a job manager
+        auto job_manager = this->createJobManager();
+
+        // One 3600-flop 4-core task per compute service
+        auto task = this->getWorkflow()->addTask("task_compute_threads", 3600, 4, 4, 0);
+        auto single_activity_task = this->getWorkflow()->addTask("task_single_activity", 3600, 4, 4, 0);
+
+        job_manager->submitJob(job_manager->createStandardJob(task), this->test->compute_service);
+        job_manager->submitJob(job_manager->createStandardJob(single_activity_task), this->single_activity_cs);
+
+        // Both work units are restarted once their host is back on
+        for (int i = 0; i < 2; i++) {
+            std::shared_ptr<wrench::WorkflowExecutionEvent> event = this->getWorkflow()->waitForNextExecutionEvent();
+            if (not std::dynamic_pointer_cast<wrench::StandardJobCompletedEvent>(event)) {
+                throw std::runtime_error("Unexpected workflow execution event: " + event->toString());
+            }
+        }
+
+        // The failure was seen in the same way in both modes
+        for (auto const &t : {task, single_activity_task}) {
+            auto failure_dates = getTaskFailureDates(t);
+            if ((failure_dates.size() != 1) or (std::fabs(failure_dates[0] - 100) > 0.001)) {
+                throw std::runtime_error("Task " + t->getID() + " should have one failure timestamp at time 100");
+            }
+            if (std::fabs(t->getFailureDate() - 100) > 0.001) {
+                throw std::runtime_error("Task " + t->getID() + " has an unexpected failure date (" +
+                                         std::to_string(t->getFailureDate()) + ")");
+            }
+            if (t->getStartDate() < 1000) {
+                throw std::runtime_error("Task " + t->getID() + " should have restarted after its host was turned back on");
+            }
+            if (std::fabs(t->getEndDate() - t->getStartDate() - 900) > 0.001) {
+                throw std::runtime_error("Task " + t->getID() + " has an unexpected execution time (" +
+                                         std::to_string(t->getEndDate() - t->getStartDate()) + ")");
+            }
+        }
+        if (task->getFailureCount() != single_activity_task->getFailureCount()) {
+            throw std::runtime_error("Both tasks should have the same failure count");
+        }
+        if (std::fabs(task->getEndDate() - single_activity_task->getEndDate()) > 0.001) {
+            throw std::runtime_error("Both tasks should complete at the same date (" +
+                                     std::to_string(task->getEndDate()) + " vs. " +
+                                     std::to_string(single_activity_task->getEndDate()) + ")");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(BareMetalComputeServiceHostFailuresTest, SingleActivityOneFailure) {
+    DO_TEST_WITH_FORK(do_BareMetalComputeServiceSingleActivityOneFailure_test);
+}
+
+void BareMetalComputeServiceHostFailuresTest::do_BareMetalComputeServiceSingleActivityOneFailure_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 2;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+    argv[1] = strdup("--wrench-host-shutdown-simulation");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    simulation->instantiatePlatform(platform_file_path);
+
+    // Get a hostname
+    std::string stable_host = "StableHost";
+
+    // Create a Compute Service that uses compute threads
+    compute_service = simulation->add(
+            new wrench::BareMetalComputeService(stable_host,
+                                                (std::map<std::string, std::tuple<unsigned long, double>>){
+                                                        std::make_pair("FailedQuadCoreHost1", std::make_tuple(wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM))
+                                                },
+                                                "",
+                                                {}));
+
+    // Create a Compute Service that simulates computations as single activities
+    auto single_activity_compute_service = simulation->add(
+            new wrench::BareMetalComputeService(stable_host,
+                                                (std::map<std::string, std::tuple<unsigned long, double>>){
+                                                        std::make_pair("FailedQuadCoreHost2", std::make_tuple(wrench::ComputeService::ALL_CORES, wrench::ComputeService::ALL_RAM))
+                                                },
+                                                "",
+                                                {{wrench::BareMetalComputeServiceProperty::SIMULATE_COMPUTATION_AS_SINGLE_ACTIVITY, "true"}}));
+
+    // Create a WMS
+    std::shared_ptr<wrench::WMS> wms = nullptr;;
+    wms = simulation->add(new BareMetalComputeServiceSingleActivityOneFailureTestWMS(this, stable_host, compute_service, single_activity_compute_service));
+
+    wms->addWorkflow(workflow);
+
+    // Running the simulation
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+     free(argv[i]);
+    free(argv);
+}
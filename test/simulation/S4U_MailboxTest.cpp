@@ -22,6 +22,7 @@ public:
     std::shared_ptr<wrench::WMS> wms1, wms2;
 
     void do_AsynchronousCommunication_test();
+    void do_TemporaryMailboxPool_test();
 
 protected:
     S4U_MailboxTest() {
@@ -263,4 +264,81 @@ void S4U_MailboxTest::do_AsynchronousCommunication_test() {
     for (int i=0; i < argc; i++)
      free(argv[i]);
     free(argv);
-}
\ No newline at end of file
+}
+
+/**********************************************************************/
+/**  TEMPORARY MAILBOX POOL TEST                                     **/
+/**********************************************************************/
+
+class TemporaryMailboxPoolTestWMS : public wrench::WMS {
+
+public:
+    TemporaryMailboxPoolTestWMS(S4U_MailboxTest *test,
+                                std::string hostname) :
+            wrench::WMS(nullptr, nullptr, {}, {}, {}, nullptr, hostname, "test") {
+        this->test = test;
+    }
+
+private:
+
+    S4U_MailboxTest *test;
+
+    int main() {
+
+        // Many request/answer exchanges should not create many mailboxes
+        auto num_mailboxes = wrench::S4U_Mailbox::getNumTemporaryMailboxes();
+        for (int i = 0; i < 1000; i++) {
+            auto mailbox = wrench::S4U_Mailbox::getTemporaryMailbox();
+            wrench::S4U_Mailbox::dputMessage(mailbox, new wrench::SimulationMessage("foo", 0));
+            wrench::S4U_Mailbox::getMessage(mailbox);
+            wrench::S4U_Mailbox::retireTemporaryMailbox(mailbox);
+        }
+        if (wrench::S4U_Mailbox::getNumTemporaryMailboxes() - num_mailboxes > 1) {
+            throw std::runtime_error("Temporary mailboxes should have been reused");
+        }
+
+        // A mailbox on which a message is still pending should not be reused
+        auto orphaned_mailbox = wrench::S4U_Mailbox::getTemporaryMailbox();
+        wrench::S4U_Mailbox::dputMessage(orphaned_mailbox, new wrench::SimulationMessage("foo", 0));
+        wrench::S4U_Mailbox::retireTemporaryMailbox(orphaned_mailbox);
+        if (wrench::S4U_Mailbox::getTemporaryMailbox() == orphaned_mailbox) {
+            throw std::runtime_error("A temporary mailbox with a pending message should not have been reused");
+        }
+
+        return 0;
+    }
+};
+
+TEST_F(S4U_MailboxTest, TemporaryMailboxPool) {
+    DO_TEST_WITH_FORK(do_TemporaryMailboxPool_test);
+}
+
+void S4U_MailboxTest::do_TemporaryMailboxPool_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    simulation->init(&argc, argv);
+
+    // Setting up the platform
+    simulation->instantiatePlatform(platform_file_path);
+
+    // Create the WMS
+    auto wms = simulation->add(new TemporaryMailboxPoolTestWMS(this, "Host1"));
+
+    // Create a bogus workflow
+    auto workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    wms->addWorkflow(workflow.get());
+
+    ASSERT_NO_THROW(simulation->launch());
+
+    delete simulation;
+
+    for (int i=0; i < argc; i++)
+     free(argv[i]);
+    free(argv);
+}
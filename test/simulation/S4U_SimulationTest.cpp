@@ -223,6 +223,27 @@ private:
         } catch (std::invalid_argument &e) {
         }
 
+        // Host registry
+        if (wrench::S4U_Simulation::getNumHosts() != 4) {
+            throw std::runtime_error("Host registry should contain four hosts");
+        }
+        auto host_info = wrench::S4U_Simulation::getHostInfo(wrench::S4U_Simulation::getHostID("Host1"));
+        if ((host_info.name != "Host1") or (host_info.num_cores != 10) or
+            (std::abs(host_info.memory_capacity - 1024) > 0.001) or (host_info.disks.size() != 2)) {
+            throw std::runtime_error("Got wrong host registry information for Host1");
+        }
+        try {
+            wrench::S4U_Simulation::getHostID("Bogus");
+            throw std::runtime_error("Shouldn't not be able to get the ID of a bogus host");
+        } catch (std::invalid_argument &e) {}
+        if (wrench::S4U_Simulation::getHost("Host1") != host_info.host) {
+            throw std::runtime_error("Got wrong S4U host for Host1");
+        }
+        try {
+            wrench::S4U_Simulation::getHost("Bogus");
+            throw std::runtime_error("Shouldn't not be able to get a bogus host");
+        } catch (std::invalid_argument &e) {}
+
         return 0;
     }
 };
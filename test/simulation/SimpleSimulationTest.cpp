@@ -394,6 +394,17 @@ void SimpleSimulationTest::do_getReadyTasksTest_test() {
     ASSERT_THROW(compute_service->getPropertyValueAsUnsignedLong(wrench::BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS), std::invalid_argument);
     ASSERT_THROW(compute_service->getPropertyValueAsBoolean(wrench::BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD), std::invalid_argument);
 
+    // Get the property with the typed accessor
+    ASSERT_EQ(false, compute_service->getPropertyValue<bool>(wrench::BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS));
+    ASSERT_EQ(0.0, compute_service->getPropertyValue<double>(wrench::BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD));
+    ASSERT_EQ(0, compute_service->getPropertyValue<unsigned long>(wrench::BareMetalComputeServiceProperty::TASK_STARTUP_OVERHEAD));
+    ASSERT_EQ("false", compute_service->getPropertyValue<std::string>(wrench::BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS));
+    ASSERT_THROW(compute_service->getPropertyValue<double>("BOGUS"), std::invalid_argument);
+    ASSERT_THROW(compute_service->getPropertyValueAsEnum<int>(wrench::BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS,
+                                                               {{"true", 1}}), std::invalid_argument);
+    ASSERT_EQ(0, compute_service->getPropertyValueAsEnum<int>(wrench::BareMetalComputeServiceProperty::SUPPORTS_PILOT_JOBS,
+                                                              {{"true", 1}, {"false", 0}}));
+
     // Try to get a message payload value, just for kicks
     ASSERT_NO_THROW(compute_service->getMessagePayloadValue(wrench::ServiceMessagePayload::STOP_DAEMON_MESSAGE_PAYLOAD));
 
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2021. The WRENCH Team.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ */
+
+#include <gtest/gtest.h>
+
+#include <wrench-dev.h>
+#include <wrench/simulation/SimulationMessageTypeSwitch.h>
+
+#include "../include/TestWithFork.h"
+
+/**********************************************************************/
+/**                      SimulationMessageTest                       **/
+/**********************************************************************/
+
+class SimulationMessageTest : public ::testing::Test {
+
+public:
+    void do_TypeSwitch_test();
+};
+
+/**********************************************************************/
+/**  TYPE SWITCH TEST (dispatch vs. a chain of dynamic casts)        **/
+/**********************************************************************/
+
+/** Message classes local to this test, in the style of a service's request messages */
+#define TEST_MESSAGE_CLASS(name) \
+class name : public wrench::SimulationMessage { \
+public: \
+    name() : wrench::SimulationMessage(#name, 0) {} \
+};
+
+TEST_MESSAGE_CLASS(TestMessage0)
+TEST_MESSAGE_CLASS(TestMessage1)
+TEST_MESSAGE_CLASS(TestMessage2)
+TEST_MESSAGE_CLASS(TestMessage3)
+TEST_MESSAGE_CLASS(TestMessage4)
+TEST_MESSAGE_CLASS(TestMessage5)
+TEST_MESSAGE_CLASS(TestMessage6)
+TEST_MESSAGE_CLASS(TestMessage7)
+TEST_MESSAGE_CLASS(TestMessage8)
+TEST_MESSAGE_CLASS(TestMessage9)
+TEST_MESSAGE_CLASS(TestMessage10)
+TEST_MESSAGE_CLASS(TestMessage11)
+TEST_MESSAGE_CLASS(TestUnknownMessage)
+
+class TestDerivedMessage : public TestMessage5 {
+};
+
+typedef wrench::SimulationMessageTypeSwitch<TestMessage0, TestMessage1, TestMessage2, TestMessage3,
+        TestMessage4, TestMessage5, TestMessage6, TestMessage7,
+        TestMessage8, TestMessage9, TestMessage10, TestMessage11> TestMessageTypes;
+
+static int dispatchWithDynamicCasts(wrench::SimulationMessage *message) {
+    if (dynamic_cast<TestMessage0 *>(message)) {
+        return 0;
+    } else if (dynamic_cast<TestMessage1 *>(message)) {
+        return 1;
+    } else if (dynamic_cast<TestMessage2 *>(message)) {
+        return 2;
+    } else if (dynamic_cast<TestMessage3 *>(message)) {
+        return 3;
+    } else if (dynamic_cast<TestMessage4 *>(message)) {
+        return 4;
+    } else if (dynamic_cast<TestMessage5 *>(message)) {
+        return 5;
+    } else if (dynamic_cast<TestMessage6 *>(message)) {
+        return 6;
+    } else if (dynamic_cast<TestMessage7 *>(message)) {
+        return 7;
+    } else if (dynamic_cast<TestMessage8 *>(message)) {
+        return 8;
+    } else if (dynamic_cast<TestMessage9 *>(message)) {
+        return 9;
+    } else if (dynamic_cast<TestMessage10 *>(message)) {
+        return 10;
+    } else if (dynamic_cast<TestMessage11 *>(message)) {
+        return 11;
+    } else {
+        return -1;
+    }
+}
+
+static int dispatchWithTypeSwitch(TestMessageTypes &message_types, wrench::SimulationMessage *message) {
+    switch (message_types.lookup(message)) {
+        case TestMessageTypes::indexOf<TestMessage0>():
+            return 0;
+        case TestMessageTypes::indexOf<TestMessage1>():
+            return 1;
+        case TestMessageTypes::indexOf<TestMessage2>():
+            return 2;
+        case TestMessageTypes::indexOf<TestMessage3>():
+            return 3;
+        case TestMessageTypes::indexOf<TestMessage4>():
+            return 4;
+        case TestMessageTypes::indexOf<TestMessage5>():
+            return 5;
+        case TestMessageTypes::indexOf<TestMessage6>():
+            return 6;
+        case TestMessageTypes::indexOf<TestMessage7>():
+            return 7;
+        case TestMessageTypes::indexOf<TestMessage8>():
+            return 8;
+        case TestMessageTypes::indexOf<TestMessage9>():
+            return 9;
+        case TestMessageTypes::indexOf<TestMessage10>():
+            return 10;
+        case TestMessageTypes::indexOf<TestMessage11>():
+            return 11;
+        default:
+            return -1;
+    }
+}
+
+TEST_F(SimulationMessageTest, TypeSwitch) {
+    DO_TEST_WITH_FORK(do_TypeSwitch_test);
+}
+
+void SimulationMessageTest::do_TypeSwitch_test() {
+
+    std::vector<std::unique_ptr<wrench::SimulationMessage>> messages;
+    messages.emplace_back(new TestMessage0());
+    messages.emplace_back(new TestMessage1());
+    messages.emplace_back(new TestMessage2());
+    messages.emplace_back(new TestMessage3());
+    messages.emplace_back(new TestMessage4());
+    messages.emplace_back(new TestMessage5());
+    messages.emplace_back(new TestMessage6());
+    messages.emplace_back(new TestMessage7());
+    messages.emplace_back(new TestMessage8());
+    messages.emplace_back(new TestMessage9());
+    messages.emplace_back(new TestMessage10());
+    messages.emplace_back(new TestMessage11());
+    messages.emplace_back(new TestUnknownMessage());
+    messages.emplace_back(new TestDerivedMessage());
+
+    // Type tags are distinct, and the same for the class and its instances
+    std::set<unsigned int> tags;
+    for (auto const &m : messages) {
+        tags.insert(m->getTypeTag());
+    }
+    ASSERT_EQ(messages.size(), tags.size());
+    ASSERT_EQ(wrench::SimulationMessage::getTypeTag<TestMessage3>(), messages[3]->getTypeTag());
+    ASSERT_EQ(wrench::SimulationMessage::getTypeTag<TestDerivedMessage>(), messages[13]->getTypeTag());
+    ASSERT_NE(wrench::SimulationMessage::getTypeTag<TestMessage5>(), messages[13]->getTypeTag());
+
+    // The type switch finds what the chain of dynamic casts finds, including for sub-classes
+    TestMessageTypes message_types;
+    for (int i = 0; i < 2; i++) {
+        for (auto const &m : messages) {
+            ASSERT_EQ(dispatchWithDynamicCasts(m.get()), dispatchWithTypeSwitch(message_types, m.get()));
+        }
+    }
+    ASSERT_EQ(TestMessageTypes::NO_MATCH, message_types.lookup(messages[12].get()));
+    ASSERT_EQ(5, message_types.lookup(messages[13].get()));
+}
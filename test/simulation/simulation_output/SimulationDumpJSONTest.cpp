@@ -17,6 +17,7 @@
 #include "../../include/UniqueTmpPathPrefix.h"
 
 #include <fstream>
+#include <sstream>
 
 #include <algorithm>
 
@@ -1968,6 +1969,22 @@ void SimulationDumpJSONTest::do_SimulationDumpUnifiedJSON_test() {
 
     EXPECT_TRUE(result_json == expected_json5);
 
+    // The same document streamed compactly to an std::ostream
+    std::stringstream compact_output;
+    EXPECT_NO_THROW(simulation->getOutput().dumpUnifiedJSON(workflow.get(), compact_output, true, true, true, false, false,
+                                                            false, false, false));
+    std::string compact_string = compact_output.str();
+    EXPECT_EQ(compact_string.find('\n'), compact_string.size() - 1);
+
+    std::ifstream pretty_json_file = std::ifstream(unified_json_file_path);
+    nlohmann::json pretty_json;
+    pretty_json_file >> pretty_json;
+    EXPECT_TRUE(nlohmann::json::parse(compact_string) == pretty_json);
+
+    std::stringstream no_workflow_output;
+    EXPECT_THROW(simulation->getOutput().dumpUnifiedJSON(nullptr, no_workflow_output), std::invalid_argument);
+    EXPECT_TRUE(no_workflow_output.str().empty());
+
 
     /*
     workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
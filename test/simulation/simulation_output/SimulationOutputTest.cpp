@@ -10,9 +10,14 @@
 #include <gtest/gtest.h>
 #include <wrench-dev.h>
 
+#include <nlohmann/json.hpp>
+
 #include "../../include/TestWithFork.h"
 #include "../../include/UniqueTmpPathPrefix.h"
 
+#include <algorithm>
+#include <fstream>
+
 class SimulationOutputTest : public ::testing::Test {
 
 public:
@@ -32,6 +37,10 @@ public:
     wrench::StorageService *storage_service = nullptr;
 
     void do_emptyTrace_test();
+    void do_binaryTrace_test();
+    void do_traceView_test();
+    void do_traceViewAlgorithms_test();
+    void do_dumpWorkflowExecutionJSONManyTasks_test();
 
 protected:
 
@@ -81,7 +90,12 @@ protected:
                           "<!DOCTYPE platform SYSTEM \"http://simgrid.gforge.inria.fr/simgrid/simgrid.dtd\">"
                           "<platform version=\"4.1\"> "
                           "   <zone id=\"AS0\" routing=\"Full\"> "
-                          "       <host id=\"DualCoreHost\" speed=\"1f\" core=\"2\"/> "
+                          "       <host id=\"DualCoreHost\" speed=\"1f\" core=\"2\"> "
+                          "         <disk id=\"large_disk\" read_bw=\"100MBps\" write_bw=\"100MBps\">"
+                          "                            <prop id=\"size\" value=\"5000GiB\"/>"
+                          "                            <prop id=\"mount\" value=\"/\"/>"
+                          "         </disk>"
+                          "       </host>"
                           "       <host id=\"QuadCoreHost\" speed=\"1f\" core=\"4\"/> "
                           "       <link id=\"1\" bandwidth=\"5000GBps\" latency=\"0us\"/>"
                           "       <route src=\"DualCoreHost\" dst=\"QuadCoreHost\"> <link_ctn id=\"1\"/> </route>"
@@ -93,6 +107,8 @@ protected:
     }
 
     std::string platform_file_path = UNIQUE_TMP_PATH_PREFIX + "platform.xml";
+    std::string binary_trace_file_path = UNIQUE_TMP_PATH_PREFIX + "trace.bin";
+    std::string execution_data_json_file_path = UNIQUE_TMP_PATH_PREFIX + "workflow_data.json";
 };
 
 /**********************************************************************/
@@ -172,3 +188,304 @@ void SimulationOutputTest::do_emptyTrace_test() {
         free(argv[i]);
     free(argv);
 }
+
+/**********************************************************************/
+/**            BINARY TRACE                                          **/
+/**********************************************************************/
+
+TEST_F(SimulationOutputTest, BinaryTraceTest) {
+    DO_TEST_WITH_FORK(do_binaryTrace_test);
+}
+
+void SimulationOutputTest::do_binaryTrace_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    auto task1 = workflow->addTask("task1", 1.0, 1, 1, 0.0);
+    auto task2 = workflow->addTask("task2", 1.0, 1, 1, 0.0);
+
+    simulation->getOutput().addTimestampTaskStart(task1);
+    simulation->getOutput().addTimestampTaskStart(task2);
+    simulation->getOutput().addTimestampTaskCompletion(task2);
+    simulation->getOutput().addTimestampTaskFailure(task1);
+    simulation->getOutput().addTimestampPstateSet("DualCoreHost", 1);
+
+    // Bogus path
+    ASSERT_THROW(simulation->getOutput().dumpBinaryTrace(""), std::invalid_argument);
+    ASSERT_THROW(wrench::SimulationTraceFile("/bogus/trace.bin"), std::invalid_argument);
+    ASSERT_THROW(wrench::SimulationTraceFile trace_file(platform_file_path), std::invalid_argument);
+
+    ASSERT_NO_THROW(simulation->getOutput().dumpBinaryTrace(binary_trace_file_path));
+
+    wrench::SimulationTraceFile trace_file(binary_trace_file_path);
+    ASSERT_EQ(5, trace_file.getNumEvents());
+    ASSERT_EQ(3, trace_file.getNumStrings());
+
+    // Events are grouped by kind, in insertion order within each kind
+    std::vector<wrench::SimulationTraceFile::Kind> expected_kinds = {
+            wrench::SimulationTraceFile::TASK_START,
+            wrench::SimulationTraceFile::TASK_START,
+            wrench::SimulationTraceFile::TASK_FAILURE,
+            wrench::SimulationTraceFile::TASK_COMPLETION,
+            wrench::SimulationTraceFile::PSTATE_SET};
+    std::vector<std::string> expected_subjects = {"task1", "task2", "task1", "task2", "DualCoreHost"};
+    std::vector<int64_t> expected_endpoints = {2, 3, 0, 1, -1};
+
+    for (size_t i = 0; i < trace_file.getNumEvents(); i++) {
+        ASSERT_EQ(expected_kinds[i], trace_file.getKinds()[i]);
+        ASSERT_EQ(expected_subjects[i], trace_file.getString(trace_file.getSubjects()[i]));
+        ASSERT_EQ(expected_endpoints[i], trace_file.getEndpoints()[i]);
+        ASSERT_DOUBLE_EQ(0.0, trace_file.getDates()[i]);
+    }
+    ASSERT_DOUBLE_EQ(1.0, trace_file.getValues()[4]);
+    ASSERT_THROW(trace_file.getString(3), std::invalid_argument);
+
+    // The in-memory trace is still accessible
+    ASSERT_EQ(2, simulation->getOutput().getTrace<wrench::SimulationTimestampTaskStart>().size());
+    ASSERT_EQ(task2, simulation->getOutput().getTrace<wrench::SimulationTimestampTaskStart>()[1]->getContent()->getTask());
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+/**********************************************************************/
+/**            TRACE VIEW                                            **/
+/**********************************************************************/
+
+TEST_F(SimulationOutputTest, TraceViewTest) {
+    DO_TEST_WITH_FORK(do_traceView_test);
+}
+
+void SimulationOutputTest::do_traceView_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Empty trace
+    auto empty_view = simulation->getOutput().getTraceView<wrench::SimulationTimestampTaskStart>();
+    ASSERT_TRUE(empty_view.empty());
+    ASSERT_EQ(0, empty_view.size());
+    ASSERT_TRUE(empty_view.begin() == empty_view.end());
+
+    std::vector<wrench::WorkflowTask *> tasks;
+    for (int i = 0; i < 100; i++) {
+        tasks.push_back(workflow->addTask("task" + std::to_string(i), 1.0, 1, 1, 0.0));
+        simulation->getOutput().addTimestampTaskStart(tasks.back());
+    }
+
+    auto view = simulation->getOutput().getTraceView<wrench::SimulationTimestampTaskStart>();
+    ASSERT_EQ(100, view.size());
+    ASSERT_EQ(100, std::distance(view.begin(), view.end()));
+
+    // The view sees the same timestamps as getTrace(), in the same order
+    auto trace = simulation->getOutput().getTrace<wrench::SimulationTimestampTaskStart>();
+    size_t index = 0;
+    for (auto const &timestamp : view) {
+        ASSERT_EQ(trace[index], timestamp);
+        ASSERT_EQ(tasks[index], view[index]->getContent()->getTask());
+        index++;
+    }
+
+    // A view is not a copy: it sees timestamps added after its creation
+    auto completion_view = simulation->getOutput().getTraceView<wrench::SimulationTimestampTaskCompletion>();
+    ASSERT_EQ(0, completion_view.size());
+    simulation->getOutput().addTimestampTaskCompletion(tasks[0]);
+    simulation->getOutput().addTimestampTaskCompletion(tasks[1]);
+    ASSERT_EQ(2, completion_view.size());
+    ASSERT_EQ(view[1]->getContent(), completion_view[1]->getContent()->getEndpoint());
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+/**********************************************************************/
+/**            TRACE VIEW WITH STANDARD ALGORITHMS                   **/
+/**********************************************************************/
+
+TEST_F(SimulationOutputTest, TraceViewAlgorithmsTest) {
+    DO_TEST_WITH_FORK(do_traceViewAlgorithms_test);
+}
+
+void SimulationOutputTest::do_traceViewAlgorithms_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    // Task names are zero-padded so that the trace is sorted by task name
+    std::vector<wrench::WorkflowTask *> tasks;
+    for (int i = 0; i < 100; i++) {
+        char name[16];
+        snprintf(name, sizeof(name), "task%03d", i);
+        tasks.push_back(workflow->addTask(name, 1.0, 1, 1, 0.0));
+        simulation->getOutput().addTimestampTaskStart(tasks.back());
+    }
+
+    auto view = simulation->getOutput().getTraceView<wrench::SimulationTimestampTaskStart>();
+
+    // Iterator arithmetic and comparisons
+    auto it = view.begin();
+    std::advance(it, 42);
+    ASSERT_EQ(tasks[42], it->getContent()->getTask());
+    ASSERT_EQ(tasks[42], (*it)->getContent()->getTask());
+    ASSERT_EQ(tasks[50], it[8]->getContent()->getTask());
+    ASSERT_EQ(42, std::distance(view.begin(), it));
+    ASSERT_TRUE(view.begin() < it);
+    ASSERT_TRUE(it > view.begin());
+    ASSERT_TRUE(it <= it);
+    ASSERT_TRUE(it >= it);
+    ASSERT_FALSE(view.end() <= it);
+
+    auto it2 = it++;
+    ASSERT_EQ(tasks[42], (*it2)->getContent()->getTask());
+    ASSERT_EQ(tasks[43], (*it)->getContent()->getTask());
+    it2 = it--;
+    ASSERT_EQ(tasks[43], (*it2)->getContent()->getTask());
+    ASSERT_EQ(tasks[42], (*it)->getContent()->getTask());
+    it += 10;
+    ASSERT_EQ(tasks[52], (*it)->getContent()->getTask());
+    it -= 20;
+    ASSERT_EQ(tasks[32], (*it)->getContent()->getTask());
+    ASSERT_EQ(tasks[30], (*(it - 2))->getContent()->getTask());
+    ASSERT_EQ(tasks[35], (*(3 + it))->getContent()->getTask());
+    ASSERT_TRUE(std::prev(view.end()) == view.begin() + 99);
+    ASSERT_TRUE(std::next(view.begin(), 100) == view.end());
+
+    // Binary search over a sorted view
+    auto found = std::lower_bound(view.begin(), view.end(), std::string("task077"),
+                                  [](wrench::SimulationTimestamp<wrench::SimulationTimestampTaskStart> *timestamp,
+                                     const std::string &name) {
+                                      return timestamp->getContent()->getTask()->getID() < name;
+                                  });
+    ASSERT_TRUE(found != view.end());
+    ASSERT_EQ(77, found - view.begin());
+    ASSERT_EQ(tasks[77], found->getContent()->getTask());
+
+    auto not_found = std::lower_bound(view.begin(), view.end(), std::string("task999"),
+                                      [](wrench::SimulationTimestamp<wrench::SimulationTimestampTaskStart> *timestamp,
+                                         const std::string &name) {
+                                          return timestamp->getContent()->getTask()->getID() < name;
+                                      });
+    ASSERT_TRUE(not_found == view.end());
+
+    // Non-modifying algorithms
+    auto found_if = std::find_if(view.begin(), view.end(),
+                                 [&tasks](wrench::SimulationTimestamp<wrench::SimulationTimestampTaskStart> *timestamp) {
+                                     return timestamp->getContent()->getTask() == tasks[13];
+                                 });
+    ASSERT_EQ(13, std::distance(view.begin(), found_if));
+    ASSERT_EQ(10, std::count_if(view.begin(), view.end(),
+                                [](wrench::SimulationTimestamp<wrench::SimulationTimestampTaskStart> *timestamp) {
+                                    return timestamp->getContent()->getTask()->getID().substr(0, 6) == "task00";
+                                }));
+
+    // Copy out of a view, and sort the copy
+    std::vector<wrench::SimulationTimestamp<wrench::SimulationTimestampTaskStart> *> copy(view.begin(), view.end());
+    ASSERT_EQ(100, copy.size());
+    std::sort(copy.begin(), copy.end(),
+              [](wrench::SimulationTimestamp<wrench::SimulationTimestampTaskStart> *lhs,
+                 wrench::SimulationTimestamp<wrench::SimulationTimestampTaskStart> *rhs) {
+                  return lhs->getContent()->getTask()->getID() > rhs->getContent()->getTask()->getID();
+              });
+    ASSERT_EQ(tasks[99], copy.front()->getContent()->getTask());
+    ASSERT_EQ(tasks[0], copy.back()->getContent()->getTask());
+    ASSERT_TRUE(std::equal(copy.rbegin(), copy.rend(), view.begin()));
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
+
+
+/**********************************************************************/
+/**            WORKFLOW EXECUTION JSON WITH MANY TASKS               **/
+/**********************************************************************/
+
+TEST_F(SimulationOutputTest, DumpWorkflowExecutionJSONManyTasksTest) {
+    DO_TEST_WITH_FORK(do_dumpWorkflowExecutionJSONManyTasks_test);
+}
+
+void SimulationOutputTest::do_dumpWorkflowExecutionJSONManyTasks_test() {
+
+    // Create and initialize a simulation
+    auto *simulation = new wrench::Simulation();
+    int argc = 1;
+    auto argv = (char **) calloc(argc, sizeof(char *));
+    argv[0] = strdup("unit_test");
+
+    ASSERT_NO_THROW(simulation->init(&argc, argv));
+
+    // Setting up the platform
+    ASSERT_NO_THROW(simulation->instantiatePlatform(platform_file_path));
+
+    std::shared_ptr<wrench::StorageService> storage_service;
+    ASSERT_NO_THROW(storage_service = simulation->add(new wrench::SimpleStorageService("DualCoreHost", {"/"})));
+    auto location = wrench::FileLocation::LOCATION(storage_service);
+
+    // Synthetic trace: each task reads one file and writes one file
+    const int num_tasks = 500;
+    for (int i = 0; i < num_tasks; i++) {
+        auto task = workflow->addTask("task_" + std::to_string(i), 1, 1, 1, 0);
+        auto input = workflow->addFile("input_" + std::to_string(i), 1);
+        auto output = workflow->addFile("output_" + std::to_string(i), 1);
+
+        task->setStartDate(i);
+        task->setEndDate(i + 1);
+        task->setExecutionHost("DualCoreHost");
+        task->setNumCoresAllocated(1);
+
+        simulation->getOutput().addTimestampFileReadStart(input, location.get(), storage_service.get(), task);
+        simulation->getOutput().addTimestampFileReadCompletion(input, location.get(), storage_service.get(), task);
+        simulation->getOutput().addTimestampFileWriteStart(output, location.get(), storage_service.get(), task);
+        simulation->getOutput().addTimestampFileWriteCompletion(output, location.get(), storage_service.get(), task);
+    }
+
+    ASSERT_NO_THROW(simulation->getOutput().dumpWorkflowExecutionJSON(workflow, execution_data_json_file_path));
+
+    // Each task is matched with its own file read and file write
+    std::ifstream json_file(execution_data_json_file_path);
+    nlohmann::json result_json;
+    json_file >> result_json;
+
+    ASSERT_EQ(num_tasks, result_json["workflow_execution"]["tasks"].size());
+    for (auto const &task_json : result_json["workflow_execution"]["tasks"]) {
+        ASSERT_EQ(1, task_json["read"].size());
+        ASSERT_EQ(1, task_json["write"].size());
+        ASSERT_EQ("input_" + task_json["task_id"].get<std::string>().substr(5), task_json["read"][0]["id"]);
+        ASSERT_EQ("output_" + task_json["task_id"].get<std::string>().substr(5), task_json["write"][0]["id"]);
+    }
+
+    delete simulation;
+    for (int i=0; i < argc; i++)
+        free(argv[i]);
+    free(argv);
+}
@@ -240,6 +240,191 @@ TEST_F(WorkflowTest, IsDone) {
     ASSERT_TRUE(workflow->isDone());
 }
 
+TEST_F(WorkflowTest, ReadyTasksAndClusters) {
+    // Initially, only the entry task is ready
+    ASSERT_EQ(1, workflow->getReadyTasks().size());
+    ASSERT_EQ(t1, workflow->getReadyTasks()[0]);
+    auto clusters = workflow->getReadyClusters();
+    ASSERT_EQ(1, clusters.size());
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({t1}), clusters["task-test-01"]);
+
+    // Complete the entry task, which makes its (clustered) children ready
+    t1->setInternalState(wrench::WorkflowTask::InternalState::TASK_COMPLETED);
+    t1->setState(wrench::WorkflowTask::State::COMPLETED);
+    for (auto task : {t2, t3}) {
+        task->setInternalState(wrench::WorkflowTask::InternalState::TASK_READY);
+        task->setState(wrench::WorkflowTask::State::READY);
+    }
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({t2, t3}), workflow->getReadyTasks());
+    clusters = workflow->getReadyClusters();
+    ASSERT_EQ(1, clusters.size());
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({t2, t3}), clusters["cluster-01"]);
+    ASSERT_FALSE(workflow->isDone());
+
+    // A non-ready task is part of a cluster only if it comes after a ready task of that cluster
+    t2->setState(wrench::WorkflowTask::State::PENDING);
+    t4->setClusterID("cluster-01");
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({t3}), workflow->getReadyTasks());
+    clusters = workflow->getReadyClusters();
+    ASSERT_EQ(1, clusters.size());
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({t3, t4}), clusters["cluster-01"]);
+
+    // Changing cluster IDs
+    t4->setClusterID("");
+    t3->setClusterID("cluster-02");
+    clusters = workflow->getReadyClusters();
+    ASSERT_EQ(1, clusters.size());
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({t3}), clusters["cluster-02"]);
+
+    // Removing tasks
+    workflow->removeTask(t3);
+    ASSERT_TRUE(workflow->getReadyTasks().empty());
+    ASSERT_TRUE(workflow->getReadyClusters().empty());
+    workflow->removeTask(t4);
+    workflow->removeTask(t2);
+    ASSERT_TRUE(workflow->isDone());
+    workflow->removeTask(t1);
+    ASSERT_TRUE(workflow->isDone());
+}
+
+TEST_F(WorkflowTest, BulkConstruction) {
+    auto bulk_workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    auto b1 = bulk_workflow->addTask("bulk-01", 1, 1, 1, 0);
+    auto b2 = bulk_workflow->addTask("bulk-02", 1, 1, 1, 0);
+    auto b3 = bulk_workflow->addTask("bulk-03", 1, 1, 1, 0);
+    auto b4 = bulk_workflow->addTask("bulk-04", 1, 1, 1, 0);
+    auto b5 = bulk_workflow->addTask("bulk-05", 1, 1, 1, 0);
+
+    bulk_workflow->beginBulkConstruction();
+    // Transitive dependencies are added before the paths that make them redundant
+    bulk_workflow->addControlDependency(b1, b4);
+    bulk_workflow->addControlDependency(b1, b3);
+    bulk_workflow->addControlDependency(b1, b2);
+    bulk_workflow->addControlDependency(b2, b3);
+    bulk_workflow->addControlDependency(b3, b4);
+    bulk_workflow->addControlDependency(b2, b3);
+    // This one is explicitly kept
+    bulk_workflow->addControlDependency(b2, b4, true);
+    bulk_workflow->addControlDependency(b4, b5);
+    bulk_workflow->endBulkConstruction();
+
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({b2}), bulk_workflow->getTaskChildren(b1));
+    ASSERT_EQ(2, bulk_workflow->getTaskNumberOfChildren(b2));
+    ASSERT_EQ(1, bulk_workflow->getTaskNumberOfParents(b3));
+    ASSERT_EQ(2, bulk_workflow->getTaskNumberOfParents(b4));
+    ASSERT_TRUE(bulk_workflow->pathExists(b1, b5));
+    ASSERT_FALSE(bulk_workflow->pathExists(b5, b1));
+
+    ASSERT_EQ(0, b1->getTopLevel());
+    ASSERT_EQ(1, b2->getTopLevel());
+    ASSERT_EQ(2, b3->getTopLevel());
+    ASSERT_EQ(3, b4->getTopLevel());
+    ASSERT_EQ(4, b5->getTopLevel());
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({b1}), bulk_workflow->getReadyTasks());
+
+    // Back to incremental mode
+    bulk_workflow->addControlDependency(b1, b5);
+    ASSERT_EQ(1, bulk_workflow->getTaskNumberOfChildren(b1));
+    bulk_workflow->addControlDependency(b1, b5, true);
+    ASSERT_EQ(2, bulk_workflow->getTaskNumberOfChildren(b1));
+}
+
+TEST_F(WorkflowTest, BulkConstructionWithRemovals) {
+    auto bulk_workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    auto c1 = bulk_workflow->addTask("removal-01", 1, 1, 1, 0);
+    auto c2 = bulk_workflow->addTask("removal-02", 1, 1, 1, 0);
+    auto c3 = bulk_workflow->addTask("removal-03", 1, 1, 1, 0);
+    auto c4 = bulk_workflow->addTask("removal-04", 1, 1, 1, 0);
+
+    bulk_workflow->beginBulkConstruction();
+    bulk_workflow->addControlDependency(c1, c3);
+    bulk_workflow->addControlDependency(c1, c2);
+    bulk_workflow->addControlDependency(c2, c3);
+    bulk_workflow->addControlDependency(c2, c4);
+    bulk_workflow->addControlDependency(c3, c4);
+    bulk_workflow->addControlDependency(c1, c4);
+    // Removing a task forgets its pending dependencies (c1->c3 is no longer redundant)
+    bulk_workflow->removeTask(c2);
+    // Removing a dependency forgets it, so that it can be added back as explicitly kept
+    bulk_workflow->removeControlDependency(c1, c4);
+    bulk_workflow->addControlDependency(c1, c4, true);
+    ASSERT_NO_THROW(bulk_workflow->endBulkConstruction());
+
+    ASSERT_EQ(3, bulk_workflow->getNumberOfTasks());
+    ASSERT_EQ(2, bulk_workflow->getTaskNumberOfChildren(c1));
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({c1}), bulk_workflow->getTaskParents(c3));
+    ASSERT_EQ(2, bulk_workflow->getTaskNumberOfParents(c4));
+    ASSERT_EQ(0, c1->getTopLevel());
+    ASSERT_EQ(1, c3->getTopLevel());
+    ASSERT_EQ(2, c4->getTopLevel());
+}
+
+TEST_F(WorkflowTest, TopLevelsLongChain) {
+    auto chain_workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    const unsigned long chain_length = 10000;
+
+    std::vector<wrench::WorkflowTask *> chain;
+    for (unsigned long i = 0; i < chain_length; i++) {
+        chain.push_back(chain_workflow->addTask("chain-" + std::to_string(i), 1, 1, 1, 0));
+    }
+    // Adding dependencies from the end of the chain is the worst case for eager top-level updates
+    for (unsigned long i = chain_length - 1; i > 0; i--) {
+        chain_workflow->addControlDependency(chain[i - 1], chain[i], true);
+    }
+
+    for (unsigned long i = 0; i < chain_length; i++) {
+        ASSERT_EQ(i, chain[i]->getTopLevel());
+    }
+    ASSERT_EQ(chain_length, chain_workflow->getNumLevels());
+    ASSERT_EQ(1, chain_workflow->getTasksInTopLevelRange(chain_length - 1, chain_length - 1).size());
+
+    // Top-levels are updated after the DAG changes
+    chain_workflow->removeControlDependency(chain[0], chain[1]);
+    ASSERT_EQ(0, chain[1]->getTopLevel());
+    ASSERT_EQ(chain_length - 2, chain[chain_length - 1]->getTopLevel());
+    chain_workflow->removeTask(chain[1]);
+    ASSERT_EQ(0, chain[2]->getTopLevel());
+}
+
+TEST_F(WorkflowTest, ChildrenAndParentsViews) {
+    auto view_workflow = std::unique_ptr<wrench::Workflow>(new wrench::Workflow());
+    auto v1 = view_workflow->addTask("view-01", 1, 1, 1, 0);
+    auto v2 = view_workflow->addTask("view-02", 1, 1, 1, 0);
+    auto v3 = view_workflow->addTask("view-03", 1, 1, 1, 0);
+    auto v4 = view_workflow->addTask("view-04", 1, 1, 1, 0);
+    auto v5 = view_workflow->addTask("view-05", 1, 1, 1, 0);
+
+    view_workflow->beginBulkConstruction();
+    view_workflow->addControlDependency(v1, v2);
+    view_workflow->addControlDependency(v1, v3);
+    view_workflow->addControlDependency(v2, v4);
+    view_workflow->addControlDependency(v3, v4);
+    view_workflow->endBulkConstruction();
+
+    // Views of the compacted DAG
+    auto children = view_workflow->getTaskChildrenView(v1);
+    ASSERT_EQ(2, children.size());
+    ASSERT_EQ(v2, children[0]);
+    ASSERT_EQ(v3, children[1]);
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({v2, v3}), std::vector<wrench::WorkflowTask *>(children));
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({v2, v3}), v4->getParents());
+    ASSERT_TRUE(view_workflow->getTaskParentsView(v1).empty());
+    ASSERT_THROW(view_workflow->getTaskChildrenView(nullptr), std::invalid_argument);
+
+    // The DAG can still be modified
+    view_workflow->addControlDependency(v4, v5);
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({v5}), view_workflow->getTaskChildren(v4));
+    ASSERT_EQ(3, v5->getTopLevel());
+
+    // Removing a task keeps the remaining tasks (and their dependencies) consistent
+    view_workflow->removeTask(v2);
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({v3}), view_workflow->getTaskChildren(v1));
+    ASSERT_EQ(std::vector<wrench::WorkflowTask *>({v3}), view_workflow->getTaskParents(v4));
+    ASSERT_TRUE(view_workflow->pathExists(v1, v5));
+    ASSERT_FALSE(view_workflow->pathExists(v5, v1));
+    ASSERT_EQ(3, v5->getTopLevel());
+}
+
 TEST_F(WorkflowTest, SumFlops) {
 
     double sum_flops = 0;
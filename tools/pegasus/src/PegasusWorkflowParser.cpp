@@ -12,6 +12,7 @@
 #include <wrench/util/UnitParser.h>
 
 #include <iostream>
+#include <memory>
 #include <vector>
 #include <fstream>
 #include <pugixml.hpp>
@@ -37,7 +38,8 @@ namespace wrench {
         std::set<std::string> ignored_auxiliary_jobs;
         std::set<std::string> ignored_transfer_jobs;
 
-        auto *workflow = new Workflow();
+        std::unique_ptr<Workflow> workflow(new Workflow());
+        workflow->beginBulkConstruction();
 
         double flop_rate;
 
@@ -183,7 +185,9 @@ namespace wrench {
         }
         file.close();
 
-        return workflow;
+        workflow->endBulkConstruction();
+
+        return workflow.release();
     }
 
 
@@ -209,7 +213,8 @@ namespace wrench {
 
         pugi::xml_document dax_tree;
 
-        auto *workflow = new Workflow();
+        std::unique_ptr<Workflow> workflow(new Workflow());
+        workflow->beginBulkConstruction();
 
         double flop_rate;
 
@@ -299,7 +304,9 @@ namespace wrench {
             }
         }
 
-        return workflow;
+        workflow->endBulkConstruction();
+
+        return workflow.release();
     }
 
 };